@@ -55,6 +55,18 @@ macro(global_set_flags)
         add_definitions(-DRS2_USE_CUDA)
     endif()
 
+    if (BUILD_WITH_NEON_TEMPORAL_FILTER)
+        add_definitions(-DRS2_USE_NEON_TEMPORAL_FILTER)
+    endif()
+
+    if (BUILD_WITH_LIBJPEG_TURBO)
+        add_definitions(-DRS2_USE_LIBJPEG_TURBO)
+    endif()
+
+    if (BUILD_WITH_ZSTD)
+        add_definitions(-DRS2_USE_ZSTD)
+    endif()
+
     if (BUILD_SHARED_LIBS)
         add_definitions(-DBUILD_SHARED_LIBS)
     endif()
@@ -91,6 +103,16 @@ endmacro()
 macro(global_target_config)
     target_link_libraries(${LRS_TARGET} PRIVATE realsense-file ${CMAKE_THREAD_LIBS_INIT})
 
+    if (BUILD_WITH_NEON_TEMPORAL_FILTER)
+        add_definitions(-DRS2_USE_NEON_TEMPORAL_FILTER)
+    endif()
+
+    if (BUILD_WITH_LIBJPEG_TURBO)
+        find_package(JPEG REQUIRED)
+        target_include_directories(${LRS_TARGET} PRIVATE ${JPEG_INCLUDE_DIR})
+        target_link_libraries(${LRS_TARGET} PRIVATE ${JPEG_LIBRARIES})
+    endif()
+
     set_target_properties (${LRS_TARGET} PROPERTIES FOLDER Library)
 
     target_include_directories(${LRS_TARGET}
@@ -2,6 +2,9 @@ option(ENABLE_CCACHE "Build with ccache." ON)
 option(BUILD_WITH_CUDA "Enable CUDA" OFF)
 option(BUILD_GLSL_EXTENSIONS "Build GLSL extensions API" ON)
 option(BUILD_WITH_OPENMP "Use OpenMP" OFF)
+option(BUILD_WITH_ZSTD "Support Zstandard compressed recordings, using the system libzstd" OFF)
+option(BUILD_WITH_NEON_TEMPORAL_FILTER "Use the NEON Z16 temporal filter on ARM, which is not covered by the unit tests" OFF)
+option(BUILD_WITH_LIBJPEG_TURBO "Decode MJPEG frames with the system libjpeg-turbo instead of the bundled stb_image" OFF)
 option(BUILD_EASYLOGGINGPP "Build EasyLogging++ as a part of the build" ON)
 option(BUILD_WITH_STATIC_CRT "Build with static link CRT" ON)
 option(HWM_OVER_XU "Send HWM commands over UVC XU control" ON)
@@ -811,6 +811,7 @@ namespace rs2
         _hidden_options.emplace(RS2_OPTION_STREAM_FORMAT_FILTER);
         _hidden_options.emplace(RS2_OPTION_STREAM_INDEX_FILTER);
         _hidden_options.emplace(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        _hidden_options.emplace(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK);
         _hidden_options.emplace(RS2_OPTION_SENSOR_MODE);
         _hidden_options.emplace(RS2_OPTION_NOISE_ESTIMATION);
     }
@@ -163,6 +163,18 @@ extern "C" {
     */
     void rs2_config_disable_all_streams(rs2_config* config, rs2_error ** error);
 
+    /**
+    * Request that the pipeline keep only the newest complete frames set for wait_for_frames, poll_for_frames and
+    * try_wait_for_frames, and never block the device to wait for the application to take it. Frames sets the
+    * application did not take in time are dropped, including in non-realtime playback, which would otherwise wait.
+    * Meant for applications that care about the latency of the frames more than about getting all of them.
+    *
+    * \param[in] config    A pointer to an instance of a config
+    * \param[in] enable    Non-zero to keep only the newest frames set, zero for the default behavior
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_enable_low_latency(rs2_config* config, int enable, rs2_error ** error);
+
     /**
     * Resolve the configuration filters, to find a matching device and streams profiles.
     * The method resolves the user configuration filters for the device and streams, and combines them with the requirements of
@@ -22,6 +22,22 @@ extern "C" {
 */
 rs2_context* rs2_create_context(int api_version, rs2_error** error);
 
+/**
+* \brief Creates RealSense context with settings, given as a JSON object. The supported settings are:
+*     "thread-pool": the threads the processing blocks and format converters of all contexts split their frames between:
+*         "size": number of threads (by default, one less than the CPUs)
+*         "cpus": array of the CPUs the threads may run on (by default, any)
+*         "priority": real-time priority of the threads, or 0 for normal (the default)
+*         "converter-threads": number of threads each format conversion is split between (by default 1, for none)
+*     e.g., { "thread-pool": { "size": 8, "cpus": [ 4, 5, 6, 7, 8, 9, 10, 11 ], "converter-threads": 2 } }
+* The thread pool is shared by all contexts, so its settings apply to all of them.
+* \param[in] api_version Users are expected to pass their version of \c RS2_API_VERSION to make sure they are running the correct librealsense version.
+* \param[in] json_settings  Settings as a JSON object, or null for the defaults
+* \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
+* \return            Context object
+*/
+rs2_context* rs2_create_context_ex(int api_version, const char* json_settings, rs2_error** error);
+
 /**
 * \brief Frees the relevant context object.
 * \param[in] context Object that is no longer needed
@@ -222,6 +222,7 @@ void rs2_keep_frame(rs2_frame* frame);
 /**
 * When called on Points frame type, this method returns a pointer to an array of 3D vertices of the model
 * The coordinate system is: X right, Y up, Z away from the camera. Units: Meters
+* Only valid for RS2_FORMAT_XYZ32F points; other formats (see RS2_OPTION_VERTEX_FORMAT) start the frame data
 * \param[in] frame       Points frame
 * \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
 * \return                Pointer to an array of vertices, lifetime is managed by the frame
@@ -242,10 +243,22 @@ void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* tex
 * Each coordinate represent a (u,v) pair within [0,1] range, to be mapped to texture image
 * \param[in] frame       Points frame
 * \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
-* \return                Pointer to an array of texture coordinates, lifetime is managed by the frame
+* \return                Pointer to an array of texture coordinates, lifetime is managed by the frame, or null if the
+*                        pointcloud did not compute them (RS2_OPTION_TEXTURE_COORDINATES)
 */
 rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error** error);
 
+/**
+* When called on Points frame type holding only the points with depth (RS2_OPTION_VALID_POINTS_ONLY), this method
+* returns a bitmask of the depth pixels they come from: bit (i % 8) of byte (i / 8) is set when pixel i (in row-major
+* order) has a point. The points are in the order of their pixels.
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to (width * height + 7) / 8 bytes, lifetime is managed by the frame, or null if the frame
+*                        holds a point for every pixel
+*/
+const unsigned char* rs2_get_frame_points_mask(const rs2_frame* frame, rs2_error** error);
+
 /**
 * When called on Points frame type, this method returns the number of vertices in the frame
 * \param[in] frame       Points frame
@@ -117,6 +117,16 @@ extern "C" {
         RS2_OPTION_AUTO_GAIN_LIMIT_TOGGLE, /**< Enable / disable color image auto-gain*/
         RS2_OPTION_EMITTER_FREQUENCY, /**< Select emitter (laser projector) frequency, see rs2_emitter_frequency for values */
         RS2_OPTION_DEPTH_AUTO_EXPOSURE_MODE, /**< Select depth sensor auto exposure mode see rs2_depth_auto_exposure_mode for values  */
+        RS2_OPTION_ZERO_COPY_FRAMES, /**< Number of frames that may hold the backend (kernel) buffer directly instead of a copy of it. 0 disables zero-copy delivery. Takes effect on the next stream open */
+        RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK, /**< Max size, in MB, of the idle frame buffers kept for reuse. Buffers released beyond it are freed */
+        RS2_OPTION_PROCESSING_THREADS, /**< Number of threads a processing block splits each frame between. 1 processes frames on the calling thread only */
+        RS2_OPTION_VERTEX_FORMAT, /**< Format of the vertices a pointcloud outputs: 0 - RS2_FORMAT_XYZ32F, 1 - RS2_FORMAT_XYZ16F, 2 - RS2_FORMAT_XYZ16 */
+        RS2_OPTION_VALID_POINTS_ONLY, /**< Enable / disable outputting only the points with depth, followed by a bitmask of the pixels they come from (see rs2_get_frame_points_mask) */
+        RS2_OPTION_TEXTURE_COORDINATES, /**< Enable / disable computing the texture coordinates of a pointcloud. Disabling it also skips the occlusion removal */
+        RS2_OPTION_SYNC_TOLERANCE, /**< Max difference, in milliseconds, between the timestamps of frames from different devices synced into one frameset. 0 allows half the frame interval */
+        RS2_OPTION_SYNC_FRAMESETS, /**< Number of framesets a syncer has released */
+        RS2_OPTION_SYNC_INCOMPLETE_FRAMESETS, /**< Number of framesets a syncer has released without a frame from every device it syncs */
+        RS2_OPTION_SYNC_LATENCY, /**< Average time, in milliseconds, from the arrival of the oldest frame of a frameset until a syncer releases it */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
@@ -91,6 +91,26 @@ extern "C" {
     */
     int rs2_pipeline_try_wait_for_frames(rs2_pipeline* pipe, rs2_frame** output_frame, unsigned int timeout_ms, rs2_error ** error);
 
+    /**
+    * Return the end-to-end latency of the frames set last returned by wait_for_frames, poll_for_frames or try_wait_for_frames:
+    * the time from the backend timestamp of its oldest frame (or the time it was received, when the backend has no timestamp)
+    * until the frames set was returned.
+    * \param[in] pipe           the pipeline
+    * \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return latency in milliseconds, or 0 if no frames set was returned since the pipeline was started
+    */
+    rs2_time_t rs2_pipeline_get_frames_latency(rs2_pipeline* pipe, rs2_error ** error);
+
+    /**
+    * Return the number of frames sets the pipeline dropped since it was started, as of the frames set last returned by
+    * wait_for_frames, poll_for_frames or try_wait_for_frames, because a newer frames set replaced them before the
+    * application took them.
+    * \param[in] pipe           the pipeline
+    * \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return number of dropped frames sets
+    */
+    unsigned long long rs2_pipeline_get_dropped_framesets(rs2_pipeline* pipe, rs2_error ** error);
+
     /**
     * Delete a pipeline instance.
     * Upon destruction, the pipeline will implicitly stop itself
@@ -35,6 +35,17 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates a Sync processing block for the frames of several devices. Each device's frames are first synced as by the
+* Sync processing block, and the resulting framesets of the different devices are then matched into one composite
+* frame by host time: frames in the global-time domain (see RS2_OPTION_GLOBAL_TIME_ENABLED) by their timestamps, other
+* frames by when they arrived. RS2_OPTION_SYNC_TOLERANCE sets how far apart matched frames may be; the
+* RS2_OPTION_SYNC_FRAMESETS, RS2_OPTION_SYNC_INCOMPLETE_FRAMESETS and RS2_OPTION_SYNC_LATENCY read-only options report
+* what the block has released
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -139,6 +150,28 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
 */
 void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* queue, rs2_error** error);
 
+/**
+* Direct the processing block to allocate the payload of its output frames through the given allocator.
+* Frames already allocated are released through the allocator they came from
+* \param[in] block          Processing block
+* \param[in] allocator      Allocator object, or null to go back to the library's own allocation
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error);
+
+/**
+* Direct the processing block to allocate the payload of its output frames through the given callbacks.
+* Frames already allocated are released through the allocator they came from
+* \param[in] block          Processing block
+* \param[in] allocate       Returns a buffer of at least the given size, 64-byte aligned; the library allocates the buffer
+*                           itself when null or a misaligned buffer (given right back to free) is returned
+* \param[in] free           Releases a buffer returned by allocate, with the same size
+* \param[in] user           User context for the callbacks (can be anything or null)
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator_fptr(rs2_processing_block* block, rs2_frame_allocate_callback_ptr allocate,
+    rs2_frame_free_callback_ptr free, void* user, rs2_error** error);
+
 /**
 * This method is used to pass frame into a processing block
 * \param[in] block          Processing block
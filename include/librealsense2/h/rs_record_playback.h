@@ -29,6 +29,39 @@ const char* rs2_playback_status_to_string(rs2_playback_status status);
 
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
+/** \brief Compression of the data of a recording, traded against the CPU it takes to record */
+typedef enum rs2_record_compression
+{
+    RS2_RECORD_COMPRESSION_NONE,   /**< Not compressed */
+    RS2_RECORD_COMPRESSION_LZ4,    /**< LZ4: fast, for live recording */
+    RS2_RECORD_COMPRESSION_LZ4_HC, /**< LZ4-HC: a better ratio than LZ4 at a higher CPU cost, read as fast; level 1 to 12, 0 for 9 */
+    RS2_RECORD_COMPRESSION_ZSTD,   /**< Zstandard: the best ratio, for long-term logging; level 1 to 22, 0 for 3. Only when built with BUILD_WITH_ZSTD, and not readable by older versions */
+    RS2_RECORD_COMPRESSION_COUNT
+} rs2_record_compression;
+
+const char* rs2_record_compression_to_string(rs2_record_compression compression);
+
+/** \brief Read-ahead counters of a playback device, for tuning the read-ahead depth */
+typedef struct rs2_playback_read_ahead_stats
+{
+    int queued_frames;                /**< Number of frames read ahead and waiting to be played */
+    unsigned long long queued_bytes;  /**< Bytes of frame data read ahead and waiting to be played */
+    unsigned long long stalls;        /**< Number of times playback had to wait for the file to be read */
+    unsigned long long full;          /**< Number of times reading ahead paused because the read-ahead depth was reached */
+} rs2_playback_read_ahead_stats;
+
+/** \brief Write counters of a recording device, showing whether the disk keeps up with the recording */
+typedef struct rs2_record_write_stats
+{
+    int pending_chunks;                /**< Number of filled chunks of the file waiting to be compressed and written */
+    unsigned long long chunks_written; /**< Number of chunks written to the file */
+    unsigned long long bytes_in;       /**< Bytes of chunk data written, before compression */
+    unsigned long long bytes_written;  /**< Bytes of chunk data written, after compression */
+    unsigned long long stalls;         /**< Number of times recording had to wait for pending chunks to be written */
+    double stall_ms;                   /**< Time recording spent waiting for pending chunks to be written */
+    double write_ms;                   /**< Time spent writing chunks to the file */
+} rs2_record_write_stats;
+
 /**
  * Creates a recording device to record the given device and save it to the given file
  * \param[in]  device    The device to record
@@ -48,6 +81,17 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 */
 rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
 
+/**
+* Creates a recording device to record the given device and save it to the given file, with the given compression
+* \param[in]  device      The device to record
+* \param[in]  file        The desired path to which the recorder should save the data
+* \param[in]  compression The compression codec
+* \param[in]  level       The compression level, for LZ4-HC and Zstandard; 0 for the codec's default
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return A pointer to a device that records its data to file, or null in case of failure
+*/
+rs2_device* rs2_create_record_device_with_compression(const rs2_device* device, const char* file, rs2_record_compression compression, int level, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
@@ -71,6 +115,16 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Retrieve the write counters of a recording device
+* Chunks of the file are compressed and written on the library's shared threads. Stalls mean the disk (or
+* compression) does not keep up with the recording.
+* \param[in] device    A recording device
+* \param[out] stats    Receives the counters
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_write_stats(const rs2_device* device, rs2_record_write_stats* stats, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -186,6 +240,28 @@ void rs2_playback_device_set_playback_speed(const rs2_device* device, float spee
 */
 void rs2_playback_device_stop(const rs2_device* device, rs2_error** error);
 
+/**
+* Read the file ahead of playback
+*
+* The file is read, decompressed and turned into frames on other threads, while the frames already
+* read are played. This keeps real time playback of compressed files from stuttering, and lets non
+* real time playback read the file as fast as the disk and the CPU allow.
+* Frames read ahead count against the frames a stream may hold at once, so at most 16 may be read ahead.
+* \param[in] device    A playback device
+* \param[in] frames    Maximum number of frames to read ahead; 0 to read each frame when it is played (the default)
+* \param[in] megabytes Maximum frame data to read ahead, in megabytes; 0 for no limit
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_playback_device_set_read_ahead(const rs2_device* device, int frames, int megabytes, rs2_error** error);
+
+/**
+* Retrieve the read-ahead counters of a playback device
+* \param[in] device    A playback device
+* \param[out] stats    Receives the counters
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_playback_device_get_read_ahead_stats(const rs2_device* device, rs2_playback_read_ahead_stats* stats, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -89,6 +89,8 @@ typedef enum rs2_format
     RS2_FORMAT_Z16H            , /**< DEPRECATED! - Variable-length Huffman-compressed 16-bit depth values. */
     RS2_FORMAT_FG              , /**< 16-bit per-pixel frame grabber format. */
     RS2_FORMAT_Y411            , /**< 12-bit per-pixel. */
+    RS2_FORMAT_XYZ16F          , /**< 16-bit half-precision floating point 3D coordinates, in meters. */
+    RS2_FORMAT_XYZ16           , /**< 16-bit signed integer 3D coordinates, in millimeters. */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -100,6 +102,14 @@ typedef struct rs2_extrinsics
     float translation[3]; /**< Three-element translation vector, in meters */
 } rs2_extrinsics;
 
+/** \brief Frame buffer pool counters of a sensor: how often frame payloads are recycled rather than allocated */
+typedef struct rs2_frame_pool_stats
+{
+    unsigned long long hits;           /**< Number of frame buffers taken from the pool */
+    unsigned long long misses;         /**< Number of frame buffers that had to be allocated */
+    unsigned long long bytes_resident; /**< Bytes held by the pool in idle buffers */
+} rs2_frame_pool_stats;
+
 /**
 * Deletes sensors list, any sensors created from this list will remain unaffected
 * \param[in] info_list list to delete
@@ -485,6 +495,43 @@ void rs2_register_extrinsics(const rs2_stream_profile* from,
 */
 void rs2_override_extrinsics( const rs2_sensor* sensor, const rs2_extrinsics* extrinsics, rs2_error** error );
 
+/**
+ * \brief Retrieve the counters of the pools the sensor allocates frame buffers from.
+ *
+ * The number of idle bytes a pool may hold is set with RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK
+ *
+* \param[in] sensor       The sensor
+* \param[out] stats       Counters accumulated since the sensor was created
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_pool_stats( const rs2_sensor* sensor, rs2_frame_pool_stats* stats, rs2_error** error );
+
+/**
+ * \brief Allocate the payload of the sensor frames through user callbacks, e.g. in memory shared with another process.
+ *
+ * Covers the raw frames of the sensor as well as the frames it converts them to. Buffers are recycled between frames,
+ * so allocate is called with a few distinct sizes (the frame size rounded up); they are released, through free, when the
+ * sensor stops. The sensor must not be streaming.
+ *
+* \param[in] sensor       The sensor
+* \param[in] allocate     Returns a buffer of at least the given size, 64-byte aligned; the library allocates the buffer itself
+*                         when null or a misaligned buffer (given right back to free) is returned
+* \param[in] free         Releases a buffer returned by allocate, with the same size
+* \param[in] user         User context for the callbacks (can be anything or null)
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator( const rs2_sensor* sensor, rs2_frame_allocate_callback_ptr allocate,
+                              rs2_frame_free_callback_ptr free, void* user, rs2_error** error );
+
+/**
+ * \brief Allocate the payload of the sensor frames through a user allocator object, see rs2_set_frame_allocator.
+ *
+* \param[in] sensor       The sensor
+* \param[in] allocator    Allocator object, or null to go back to the library's own allocation
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp( const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error );
+
 /**
  * When called on a video profile, returns the intrinsics of specific stream configuration
  * \param[in] mode          input stream profile
@@ -269,6 +269,7 @@ typedef struct rs2_stream_profile_list rs2_stream_profile_list;
 typedef struct rs2_processing_block_list rs2_processing_block_list;
 typedef struct rs2_stream_profile rs2_stream_profile;
 typedef struct rs2_frame_callback rs2_frame_callback;
+typedef struct rs2_frame_allocator rs2_frame_allocator;
 typedef struct rs2_log_callback rs2_log_callback;
 typedef struct rs2_syncer rs2_syncer;
 typedef struct rs2_device_serializer rs2_device_serializer;
@@ -296,6 +297,8 @@ typedef void(*rs2_software_device_destruction_callback_ptr)(void*);
 typedef void (*rs2_devices_changed_callback_ptr)(rs2_device_list*, rs2_device_list*, void*);
 typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame*, rs2_source*, void*);
+typedef void* (*rs2_frame_allocate_callback_ptr)(int size, void* user);
+typedef void (*rs2_frame_free_callback_ptr)(void* buffer, int size, void* user);
 typedef void(*rs2_update_progress_callback_ptr)(const float, void*);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
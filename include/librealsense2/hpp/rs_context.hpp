@@ -105,6 +105,19 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * create a context with settings, given as a JSON object; see rs2_create_context_ex for the supported settings
+        * \param[in] json_settings   e.g., { "thread-pool": { "size": 8, "cpus": [ 4, 5, 6, 7, 8, 9, 10, 11 ] } }
+        */
+        explicit context( std::string const & json_settings )
+        {
+            rs2_error* e = nullptr;
+            _context = std::shared_ptr<rs2_context>(
+                rs2_create_context_ex(RS2_API_VERSION, json_settings.c_str(), &e),
+                rs2_delete_context);
+            error::handle(e);
+        }
+
         /**
         * create a static snapshot of all connected devices at the time of the call
         * \return            the list of devices connected devices at the time of the call
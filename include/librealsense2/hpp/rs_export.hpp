@@ -5,6 +5,12 @@
 #define LIBREALSENSE_RS2_EXPORT_HPP
 
 #include <map>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cstring>
 #include <fstream>
 #include <cmath>
 #include <sstream>
@@ -33,97 +39,320 @@ namespace rs2
 
     class save_to_ply : public filter
     {
+        class writer;
+
     public:
         static const auto OPTION_IGNORE_COLOR = rs2_option(RS2_OPTION_COUNT + 10);
         static const auto OPTION_PLY_MESH = rs2_option(RS2_OPTION_COUNT + 11);
         static const auto OPTION_PLY_BINARY = rs2_option(RS2_OPTION_COUNT + 12);
         static const auto OPTION_PLY_NORMALS = rs2_option(RS2_OPTION_COUNT + 13);
         static const auto OPTION_PLY_THRESHOLD = rs2_option(RS2_OPTION_COUNT + 14);
+        // Export on a background thread, each frame to "<filename><frame number>.ply", so a sequence of frames
+        // can be saved without holding up the thread that processes them. Up to MAX_PENDING frames wait their
+        // turn; beyond that, processing waits too.
+        static const auto OPTION_PLY_ASYNC = rs2_option(RS2_OPTION_COUNT + 15);
+        static const size_t MAX_PENDING = 8;
+
+        // RS2_OPTION_PROCESSING_THREADS (1 by default) sets how many threads put each file together
+        save_to_ply(std::string filename = "RealSense Pointcloud ", pointcloud pc = pointcloud())
+            : save_to_ply(std::make_shared<writer>(std::move(filename), std::move(pc)))
+        {
+        }
 
-        save_to_ply(std::string filename = "RealSense Pointcloud ", pointcloud pc = pointcloud()) : filter([this](frame f, frame_source& s) { func(f, s); }),
-            _pc(std::move(pc)), fname(filename)
+        // Wait for the frames queued by OPTION_PLY_ASYNC to be saved, and throw if saving any of them failed
+        void flush() { _writer->flush(); }
+
+    private:
+        explicit save_to_ply(std::shared_ptr<writer> w) : filter([w](frame f, frame_source& s) { w->process(f, s); }),
+            _writer(w)
         {
             register_simple_option(OPTION_IGNORE_COLOR, option_range{ 0, 1, 0, 1 });
             register_simple_option(OPTION_PLY_MESH, option_range{ 0, 1, 1, 1 });
             register_simple_option(OPTION_PLY_NORMALS, option_range{ 0, 1, 0, 1 });
             register_simple_option(OPTION_PLY_BINARY, option_range{ 0, 1, 1, 1 });
             register_simple_option(OPTION_PLY_THRESHOLD, option_range{ 0, 1, 0.05f, 0 });
+            register_simple_option(OPTION_PLY_ASYNC, option_range{ 0, 1, 0, 1 });
+            register_simple_option(RS2_OPTION_PROCESSING_THREADS, option_range{ 1, 32, 1, 1 });
+            _writer->set_options(*this);
         }
 
-    private:
-        void func(frame data, frame_source& source)
+        struct settings
         {
-            frame depth, color;
-            if (auto fs = data.as<frameset>()) {
-                for (auto f : fs) {
-                    if (f.is<points>()) depth = f;
-                    else if (!depth && f.is<depth_frame>()) depth = f;
-                    else if (!color && f.is<video_frame>()) color = f;
+            bool use_texcoords, mesh, binary, use_normals;
+            float threshold;
+            size_t threads;
+            std::string fname;
+        };
+
+        struct job
+        {
+            frame depth;
+            frame color;
+            settings how;
+        };
+
+        // The state of the filter, owned by its processing function so that copies of the filter share it. The
+        // background thread of OPTION_PLY_ASYNC is joined when the last copy goes, after saving the frames still
+        // pending; a failure to save them is logged, as there is no one left to throw it to.
+        class writer
+        {
+        public:
+            writer(std::string filename, pointcloud pc) : _fname(std::move(filename)), _pc(std::move(pc)) {}
+
+            ~writer()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stopping = true;
                 }
-            } else if (data.is<depth_frame>() || data.is<points>()) {
-                depth = data;
+                _cv.notify_all();
+                if (_thread.joinable())
+                    _thread.join();
+                if (_error)
+                    log_error(_error);
+            }
+
+            void set_options(const options& opts) { _options.reset(new options(opts)); }
+
+            void flush()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this] { return _pending.empty() && !_writing; });
+                rethrow_error(lock);
+            }
+
+            void process(frame data, frame_source& source)
+            {
+                frame depth, color;
+                if (auto fs = data.as<frameset>()) {
+                    for (auto f : fs) {
+                        if (f.is<points>()) depth = f;
+                        else if (!depth && f.is<depth_frame>()) depth = f;
+                        else if (!color && f.is<video_frame>()) color = f;
+                    }
+                } else if (data.is<depth_frame>() || data.is<points>()) {
+                    depth = data;
+                }
+
+                if (!depth) throw std::runtime_error("Need depth data to save PLY");
+
+                settings how;
+                how.use_texcoords = color && !_options->get_option(OPTION_IGNORE_COLOR);
+                how.mesh = _options->get_option(OPTION_PLY_MESH) != 0;
+                how.binary = _options->get_option(OPTION_PLY_BINARY) != 0;
+                how.use_normals = _options->get_option(OPTION_PLY_NORMALS) != 0;
+                how.threshold = _options->get_option(OPTION_PLY_THRESHOLD);
+                how.threads = size_t(_options->get_option(RS2_OPTION_PROCESSING_THREADS));
+                how.fname = _fname;
+
+                if (_options->get_option(OPTION_PLY_ASYNC) != 0)
+                {
+                    how.fname += std::to_string(depth.get_frame_number()) + ".ply";
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    rethrow_error(lock);
+                    _cv.wait(lock, [this] { return _pending.size() < MAX_PENDING; });
+                    _pending.push_back({ depth, color, how });
+                    if (!_thread.joinable())
+                        _thread = std::thread([this] { write_pending(); });
+                    lock.unlock();
+                    _cv.notify_all();
+                }
+                else
+                {
+                    flush();
+                    save(depth, color, how);
+                }
+
+                source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
+            }
+
+        private:
+            void save(frame depth, const frame& color, const settings& how)
+            {
+                if (!depth.is<points>()) {
+                    if (color) _pc.map_to(color);
+                    depth = _pc.calculate(depth);
+                }
+                export_to_ply(depth, color, how);
+            }
+
+            void write_pending()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (true)
+                {
+                    _cv.wait(lock, [this] { return !_pending.empty() || _stopping; });
+                    if (_pending.empty())
+                        return;
+                    job next = std::move(_pending.front());
+                    _pending.pop_front();
+                    _writing = true;
+                    lock.unlock();
+                    _cv.notify_all();
+
+                    std::exception_ptr error;
+                    try
+                    {
+                        save(next.depth, next.color, next.how);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+
+                    lock.lock();
+                    _writing = false;
+                    if (error)
+                        _error = error;
+                    _cv.notify_all();
+                }
+            }
+
+            void rethrow_error(std::unique_lock<std::mutex>& lock)
+            {
+                if (!_error)
+                    return;
+                auto error = _error;
+                _error = nullptr;
+                lock.unlock();
+                std::rethrow_exception(error);
             }
 
-            if (!depth) throw std::runtime_error("Need depth data to save PLY");
-            if (!depth.is<points>()) {
-                if (color) _pc.map_to(color);
-                depth = _pc.calculate(depth);
+            static void log_error(std::exception_ptr error)
+            {
+                std::string message = "save_to_ply: ";
+                try
+                {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& ex)
+                {
+                    message += ex.what();
+                }
+                catch (...)
+                {
+                    message += "unknown error";
+                }
+                rs2_error* e = nullptr;
+                rs2_log(RS2_LOG_SEVERITY_ERROR, message.c_str(), &e);
+                if (e)
+                    rs2_free_error(e);
             }
 
-            export_to_ply(depth, color);
-            source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
+            std::string _fname;
+            pointcloud _pc;
+            std::unique_ptr<options> _options;
+
+            std::mutex _mutex;
+            std::condition_variable _cv;
+            std::deque<job> _pending;
+            bool _writing = false;
+            bool _stopping = false;
+            std::exception_ptr _error;
+            std::thread _thread;
+        };
+
+        // Calls fn(band) for each of 'bands' bands, on as many threads
+        template<class F>
+        static void for_each_band(size_t bands, const F& fn)
+        {
+            if (!bands)
+                return;
+            std::vector<std::thread> threads;
+            for (size_t band = 1; band < bands; ++band)
+                threads.emplace_back([&fn, band] { fn(band); });
+            fn(0);
+            for (auto& t : threads)
+                t.join();
         }
 
-        void export_to_ply(points p, video_frame color) {
-            const bool use_texcoords  = color && !get_option(OPTION_IGNORE_COLOR);
-            bool mesh = get_option(OPTION_PLY_MESH) != 0;
-            bool binary = get_option(OPTION_PLY_BINARY) != 0;
-            bool use_normals = get_option(OPTION_PLY_NORMALS) != 0;
+        // One band per thread, and a single band, on the calling thread, unless more threads were asked for
+        static size_t get_band_count(size_t count, size_t threads)
+        {
+            return std::max(size_t(1), std::min(count, threads));
+        }
+
+        static void export_to_ply(points p, video_frame color, const settings& how) {
+            const bool use_texcoords = how.use_texcoords;
+            const bool mesh = how.mesh;
+            const bool binary = how.binary;
+            const bool use_normals = how.use_normals;
             const auto verts = p.get_vertices();
             const auto texcoords = p.get_texture_coordinates();
-            const uint8_t* texture_data;
+            const uint8_t* texture_data = nullptr;
+            int texture_width = 0, texture_height = 0, texture_bpp = 0, texture_stride = 0;
             if (use_texcoords) // texture might be on the gpu, get pointer to data before for-loop to avoid repeated access
+            {
                 texture_data = reinterpret_cast<const uint8_t*>(color.get_data());
-            std::vector<rs2::vertex> new_verts;
-            std::vector<vec3d> normals;
-            std::vector<std::array<uint8_t, 3>> new_tex;
-            std::map<size_t, size_t> idx_map;
-            std::map<size_t, std::vector<vec3d>> index_to_normals;
-
-            new_verts.reserve(p.size());
-            if (use_texcoords) new_tex.reserve(p.size());
+                texture_width = color.get_width();
+                texture_height = color.get_height();
+                texture_bpp = color.get_bytes_per_pixel();
+                texture_stride = color.get_stride_in_bytes();
+            }
 
             static const auto min_distance = 1e-6;
 
-            for (size_t i = 0; i < p.size(); ++i) {
-                if (fabs(verts[i].x) >= min_distance || fabs(verts[i].y) >= min_distance ||
-                    fabs(verts[i].z) >= min_distance)
+            // The points that are not at the origin, in order: each band counts its own, then writes them after
+            // the ones of the bands before it. 'idx_map' maps each pixel to its point, or -1.
+            const size_t count = p.size();
+            const size_t bands = get_band_count(count, how.threads);
+            const size_t band_size = (count + bands - 1) / bands;
+            std::vector<int> idx_map(count);
+            std::vector<size_t> band_first(bands + 1, 0);
+            for_each_band(bands, [&](size_t band) {
+                size_t n = 0;
+                for (size_t i = band * band_size; i < std::min(count, (band + 1) * band_size); ++i)
+                {
+                    bool valid = fabs(verts[i].x) >= min_distance || fabs(verts[i].y) >= min_distance ||
+                        fabs(verts[i].z) >= min_distance;
+                    idx_map[i] = valid ? int(n++) : -1;
+                }
+                band_first[band + 1] = n;
+            });
+            for (size_t band = 0; band < bands; ++band)
+                band_first[band + 1] += band_first[band];
+
+            std::vector<rs2::vertex> new_verts(band_first[bands]);
+            std::vector<std::array<uint8_t, 3>> new_tex(use_texcoords ? new_verts.size() : 0);
+            for_each_band(bands, [&](size_t band) {
+                const int first = int(band_first[band]);
+                for (size_t i = band * band_size; i < std::min(count, (band + 1) * band_size); ++i)
                 {
-                    idx_map[int(i)] = int(new_verts.size());
-                    new_verts.push_back({ verts[i].x, -1 * verts[i].y, -1 * verts[i].z });
+                    if (idx_map[i] < 0)
+                        continue;
+                    idx_map[i] += first;
+                    new_verts[idx_map[i]] = { verts[i].x, -1 * verts[i].y, -1 * verts[i].z };
                     if (use_texcoords)
                     {
-                        auto rgb = get_texcolor(color, texture_data, texcoords[i].u, texcoords[i].v);
-                        new_tex.push_back(rgb);
+                        int x = std::min(std::max(int(texcoords[i].u * texture_width + .5f), 0), texture_width - 1);
+                        int y = std::min(std::max(int(texcoords[i].v * texture_height + .5f), 0), texture_height - 1);
+                        auto rgb = texture_data + x * texture_bpp + y * texture_stride;
+                        new_tex[idx_map[i]] = { rgb[0], rgb[1], rgb[2] };
                     }
                 }
-            }
+            });
 
+            // Two faces per square of close-enough points, in the order of the squares' columns: each band of
+            // columns collects its own. The normals of the squares are kept to sum up at their corners.
             auto profile = p.get_profile().as<video_stream_profile>();
-            auto width = profile.width(), height = profile.height();
-            static const auto threshold = get_option(OPTION_PLY_THRESHOLD);
-            std::vector<std::array<size_t, 3>> faces;
-            if (mesh)
-            {
-                for (size_t x = 0; x < width - 1; ++x) {
-                    for (size_t y = 0; y < height - 1; ++y) {
+            const size_t width = profile.width(), height = profile.height();
+            const auto threshold = how.threshold;
+            const size_t columns = width - 1, rows = height - 1;
+            const size_t face_bands = mesh ? get_band_count(columns, how.threads) : 0;
+            const size_t face_band_size = mesh ? (columns + face_bands - 1) / face_bands : 0;
+            std::vector<std::vector<std::array<int, 3>>> band_faces(face_bands);
+            std::vector<uint8_t> square_used(mesh && use_normals ? columns * rows : 0);
+            std::vector<std::array<vec3d, 2>> square_normals(square_used.size());
+            for_each_band(face_bands, [&](size_t band) {
+                auto& faces = band_faces[band];
+                for (size_t x = band * face_band_size; x < std::min(columns, (band + 1) * face_band_size); ++x) {
+                    for (size_t y = 0; y < rows; ++y) {
                         auto a = y * width + x, b = y * width + x + 1, c = (y + 1)*width + x, d = (y + 1)*width + x + 1;
                         if (verts[a].z && verts[b].z && verts[c].z && verts[d].z
                             && fabs(verts[a].z - verts[b].z) < threshold && fabs(verts[a].z - verts[c].z) < threshold
                             && fabs(verts[b].z - verts[d].z) < threshold && fabs(verts[c].z - verts[d].z) < threshold)
                         {
-                            if (idx_map.count(a) == 0 || idx_map.count(b) == 0 || idx_map.count(c) == 0 ||
-                                idx_map.count(d) == 0)
+                            if (idx_map[a] < 0 || idx_map[b] < 0 || idx_map[c] < 0 || idx_map[d] < 0)
                                 continue;
                             faces.push_back({ idx_map[a], idx_map[d], idx_map[b] });
                             faces.push_back({ idx_map[d], idx_map[a], idx_map[c] });
@@ -135,40 +364,45 @@ namespace rs2
                                 vec3d point_c = { verts[c].x ,  -1 * verts[c].y,  -1 * verts[c].z };
                                 vec3d point_d = { verts[d].x ,  -1 * verts[d].y,  -1 * verts[d].z };
 
-                                auto n1 = cross(point_d - point_a, point_b - point_a);
-                                auto n2 = cross(point_c - point_a, point_d - point_a);
-
-                                index_to_normals[idx_map[a]].push_back(n1);
-                                index_to_normals[idx_map[a]].push_back(n2);
-
-                                index_to_normals[idx_map[b]].push_back(n1);
-
-                                index_to_normals[idx_map[c]].push_back(n2);
-
-                                index_to_normals[idx_map[d]].push_back(n1);
-                                index_to_normals[idx_map[d]].push_back(n2);
+                                square_used[y * columns + x] = 1;
+                                square_normals[y * columns + x] = { cross(point_d - point_a, point_b - point_a),
+                                                                    cross(point_c - point_a, point_d - point_a) };
                             }
                         }
                     }
                 }
-            }
+            });
 
-            if (mesh && use_normals)
-            {
-                for (size_t i = 0; i < new_verts.size(); ++i)
+            // The normal of each point sums those of the squares around it, in the order the squares were found
+            std::vector<vec3d> normals(mesh && use_normals ? new_verts.size() : 0);
+            for_each_band(normals.empty() ? 0 : bands, [&](size_t band) {
+                for (size_t i = band * band_size; i < std::min(count, (band + 1) * band_size); ++i)
                 {
-                    auto normals_vec = index_to_normals[i];
+                    if (idx_map[i] < 0)
+                        continue;
+                    const size_t x = i % width, y = i / width;
                     vec3d sum = { 0, 0, 0 };
-                    for (auto& n : normals_vec)
-                        sum = sum + n;
-                    if (normals_vec.size() > 0)
-                        normals.push_back((sum.normalize()));
-                    else
-                        normals.push_back({ 0, 0, 0 });
+                    bool found = false;
+                    auto add = [&](size_t sx, size_t sy, int first, int last) {
+                        if (sx >= columns || sy >= rows || !square_used[sy * columns + sx])
+                            return;
+                        for (int n = first; n <= last; ++n)
+                            sum = sum + square_normals[sy * columns + sx][n];
+                        found = true;
+                    };
+                    add(x - 1, y - 1, 0, 1); // as its 'd' corner
+                    add(x - 1, y, 0, 0);     // 'b'
+                    add(x, y - 1, 1, 1);     // 'c'
+                    add(x, y, 0, 1);         // 'a'
+                    normals[idx_map[i]] = found ? sum.normalize() : vec3d{ 0, 0, 0 };
                 }
-            }
+            });
 
-            std::ofstream out(fname);
+            size_t face_count = 0;
+            for (auto& faces : band_faces)
+                face_count += faces.size();
+
+            std::ofstream out(how.fname);
             out << "ply\n";
             if (binary)
                 out << "format binary_little_endian 1.0\n";
@@ -193,7 +427,7 @@ namespace rs2
             }
             if (mesh)
             {
-                out << "element face " << faces.size() << "\n";
+                out << "element face " << face_count << "\n";
                 out << "property list uchar int vertex_indices\n";
             }
             out << "end_header\n";
@@ -201,38 +435,41 @@ namespace rs2
             if (binary)
             {
                 out.close();
-                out.open(fname, std::ios_base::app | std::ios_base::binary);
-                for (size_t i = 0; i < new_verts.size(); ++i)
-                {
-                    // we assume little endian architecture on your device
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].x)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].y)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].z)), sizeof(float));
-
-                    if (mesh && use_normals)
+                out.open(how.fname, std::ios_base::app | std::ios_base::binary);
+
+                // we assume little endian architecture on your device
+                // The body is put together in memory, and written in a few large writes
+                const size_t vertex_size = 3 * sizeof(float) + (mesh && use_normals ? 3 * sizeof(float) : 0) + (use_texcoords ? 3 : 0);
+                std::vector<char> body(new_verts.size() * vertex_size);
+                for_each_band(bands, [&](size_t band) {
+                    for (size_t i = band_first[band]; i < band_first[band + 1]; ++i)
                     {
-                        out.write(reinterpret_cast<const char*>(&(normals[i].x)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].y)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].z)), sizeof(float));
+                        char* v = body.data() + i * vertex_size;
+                        memcpy(v, &new_verts[i].x, 3 * sizeof(float));
+                        v += 3 * sizeof(float);
+                        if (mesh && use_normals)
+                        {
+                            memcpy(v, &normals[i].x, 3 * sizeof(float));
+                            v += 3 * sizeof(float);
+                        }
+                        if (use_texcoords)
+                            memcpy(v, new_tex[i].data(), 3);
                     }
+                });
+                out.write(body.data(), body.size());
 
-                    if (use_texcoords)
-                    {
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][0])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][1])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][2])), sizeof(uint8_t));
-                    }
-                }
-                if (mesh)
+                const size_t face_size = 1 + 3 * sizeof(int);
+                for (auto& faces : band_faces)
                 {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        static const int three = 3;
-                        out.write(reinterpret_cast<const char*>(&three), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][0])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][1])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][2])), sizeof(int));
+                    body.resize(faces.size() * face_size);
+                    char* face = body.data();
+                    for (auto& f : faces)
+                    {
+                        *face = 3;
+                        memcpy(face + 1, f.data(), 3 * sizeof(int));
+                        face += face_size;
                     }
+                    out.write(body.data(), body.size());
                 }
             }
             else
@@ -260,32 +497,22 @@ namespace rs2
                         out << "\n";
                     }
                 }
-                if (mesh)
-                {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
+                for (auto& faces : band_faces) {
+                    for (auto& f : faces) {
                         int three = 3;
                         out << three << " ";
-                        out << std::get<0>(faces[i]) << " ";
-                        out << std::get<1>(faces[i]) << " ";
-                        out << std::get<2>(faces[i]) << " ";
+                        out << std::get<0>(f) << " ";
+                        out << std::get<1>(f) << " ";
+                        out << std::get<2>(f) << " ";
                         out << "\n";
                     }
                 }
             }
+            if (!out)
+                throw std::runtime_error("Failed to write " + how.fname);
         }
 
-        std::array<uint8_t, 3> get_texcolor(const video_frame& texture, const uint8_t* texture_data, float u, float v)
-        {
-            const int w = texture.get_width(), h = texture.get_height();
-            int x = std::min(std::max(int(u*w + .5f), 0), w - 1);
-            int y = std::min(std::max(int(v*h + .5f), 0), h - 1);
-            int idx = x * texture.get_bytes_per_pixel() + y * texture.get_stride_in_bytes();
-            return { texture_data[idx], texture_data[idx + 1], texture_data[idx + 2] };
-        }
-
-        std::string fname;
-        pointcloud _pc;
+        std::shared_ptr<writer> _writer;
     };
 
     class save_single_frameset : public filter {
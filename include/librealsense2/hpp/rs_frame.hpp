@@ -801,6 +801,18 @@ namespace rs2
             return (const texture_coordinate*)res;
         }
 
+        /**
+        * Retrieve which depth pixels the points come from, when the pointcloud outputs only the points with depth
+        * \return const uint8_t* - bit (i % 8) of byte (i / 8) is set when pixel i has a point, or null
+        */
+        const uint8_t* get_points_mask() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_points_mask(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
         size_t size() const
         {
             return _size;
@@ -1180,5 +1192,19 @@ namespace rs2
 
         void release() override { delete this; }
     };
+
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        D deallocate_function;
+    public:
+        frame_allocator(A allocate, D deallocate) : allocate_function(allocate), deallocate_function(deallocate) {}
+
+        void* allocate(int size) override { return allocate_function(size); }
+        void deallocate(void* buffer, int size) override { deallocate_function(buffer, size); }
+
+        void release() override { delete this; }
+    };
 }
 #endif // LIBREALSENSE_RS2_FRAME_HPP
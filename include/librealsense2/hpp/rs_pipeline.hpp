@@ -293,6 +293,20 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Keep only the newest complete frames set for \c wait_for_frames(), \c poll_for_frames() and \c try_wait_for_frames(),
+        * dropping the ones the application did not take in time rather than ever blocking the device for them.
+        * Meant for applications that care about the latency of the frames more than about getting all of them.
+        *
+        * \param[in] enable    True to keep only the newest frames set, false for the default behavior
+        */
+        void enable_low_latency(bool enable = true)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_enable_low_latency(_config.get(), enable, &e);
+            error::handle(e);
+        }
+
         /**
         * Resolve the configuration filters, to find a matching device and streams profiles.
         * The method resolves the user configuration filters for the device and streams, and combines them with the requirements
@@ -559,6 +573,32 @@ namespace rs2
             return res > 0;
         }
 
+        /**
+        * Return the end-to-end latency of the frames set last returned by \c wait_for_frames(), \c poll_for_frames() or
+        * \c try_wait_for_frames(): the time from the backend timestamp of its oldest frame until it was returned.
+        *
+        * \return  Latency in milliseconds, or 0 if no frames set was returned since \c start()
+        */
+        double get_frames_latency() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_pipeline_get_frames_latency(_pipeline.get(), &e);
+            error::handle(e);
+            return res;
+        }
+
+        /**
+        * Return the number of frames sets dropped since \c start(), as of the frames set last returned, because a newer
+        * frames set replaced them before the application took them.
+        */
+        unsigned long long get_dropped_framesets() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_pipeline_get_dropped_framesets(_pipeline.get(), &e);
+            error::handle(e);
+            return res;
+        }
+
         /**
         * Return the active device and streams profiles, used by the pipeline.
         * The pipeline streams profiles are selected during \c start(). The method returns a valid result only when the pipeline is active -
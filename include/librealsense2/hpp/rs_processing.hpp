@@ -278,6 +278,19 @@ namespace rs2
             return on_frame;
         }
         /**
+        * Allocate the payload of the output frames through the given functions
+        *
+        * \param[in] allocate     void*(int size) returning a buffer of at least size bytes, 64-byte aligned (or null to have the library allocate it)
+        * \param[in] deallocate   void(void* buffer, int size) releasing a buffer returned by allocate
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_processing_block_frame_allocator(get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+        /**
         * Ask processing block to process the frame
         *
         * \param[in] on_frame      frame to be processed.
@@ -702,6 +715,98 @@ namespace rs2
         frame_queue _results;
     };
 
+    class asynchronous_multi_device_syncer : public processing_block
+    {
+    public:
+        /**
+        * Real asynchronous syncer within multi_device_syncer class
+        */
+        asynchronous_multi_device_syncer() : processing_block(init()) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_multi_device_sync_processing_block(&e),
+                rs2_delete_processing_block);
+
+            error::handle(e);
+            return block;
+        }
+    };
+
+    class multi_device_syncer
+    {
+    public:
+        /**
+        * Sync instance to match the frames of several devices, by their global timestamps, into one frameset.
+        * Start the sensors of every device with it.
+        */
+        multi_device_syncer(int queue_size = 1)
+            :_results(queue_size)
+        {
+            _sync.start(_results);
+        }
+
+        /**
+        * Wait until coherent set of frames becomes available
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return Set of coherent frames
+        */
+        frameset wait_for_frames(unsigned int timeout_ms = 5000) const
+        {
+            return frameset(_results.wait_for_frame(timeout_ms));
+        }
+
+        /**
+        * Check if a coherent set of frames is available
+        * \param[out] fs      New coherent frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool poll_for_frames(frameset* fs) const
+        {
+            frame result;
+            if (_results.poll_for_frame(&result))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * Wait until coherent set of frames becomes available
+        * \param[in] timeout_ms     Max time in milliseconds to wait until an available frame
+        * \param[out] fs            New coherent frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool try_wait_for_frames(frameset* fs, unsigned int timeout_ms = 5000) const
+        {
+            frame result;
+            if (_results.try_wait_for_frame(&result, timeout_ms))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * The tolerance (RS2_OPTION_SYNC_TOLERANCE) and the statistics (RS2_OPTION_SYNC_FRAMESETS,
+        * RS2_OPTION_SYNC_INCOMPLETE_FRAMESETS, RS2_OPTION_SYNC_LATENCY) of the syncer
+        */
+        const options& get_options() const { return _sync; }
+
+        void operator()(frame f) const
+        {
+            _sync.invoke(std::move(f));
+        }
+    private:
+        asynchronous_multi_device_syncer _sync;
+        frame_queue _results;
+    };
+
     /**
     Auxiliary processing block that performs image alignment using depth data and camera calibration
     */
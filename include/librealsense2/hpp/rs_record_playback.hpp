@@ -137,6 +137,31 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Read the file ahead of playback, on other threads, while the frames already read are played
+        * \param[in] frames    Maximum number of frames to read ahead (up to 16); 0 to stop reading ahead
+        * \param[in] megabytes Maximum frame data to read ahead, in megabytes; 0 for no limit
+        */
+        void set_read_ahead(int frames, int megabytes = 0) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_read_ahead(_dev.get(), frames, megabytes, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Retrieve the read-ahead counters, for tuning the read-ahead depth
+        * \return How much is read ahead, and how often playback waited for the file or reading ahead waited for playback
+        */
+        rs2_playback_read_ahead_stats get_read_ahead_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_read_ahead_stats stats;
+            rs2_playback_device_get_read_ahead_stats(_dev.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
         /**
         * Start passing frames into user provided callback
         * \param[in] callback   Stream callback, can be any callable object accepting rs2::frame
@@ -234,6 +259,22 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device to record the given device and save it to the given file as rosbag format
+        * \param[in]  file         The desired path to which the recorder should save the data
+        * \param[in]  device       The device to record
+        * \param[in]  compression  The compression codec
+        * \param[in]  level        The compression level, for LZ4-HC and Zstandard; 0 for the codec's default
+        */
+        recorder(const std::string& file, rs2::device dev, rs2_record_compression compression, int level = 0)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                rs2_create_record_device_with_compression(dev.get().get(), file.c_str(), compression, level, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
+
 
         /**
         * Pause the recording device without stopping the actual device from streaming.
@@ -266,6 +307,20 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Retrieve the write counters of the recorder
+        * Stalls mean the disk (or compression) does not keep up with the recording.
+        * \return The counters
+        */
+        rs2_record_write_stats get_write_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_write_stats stats;
+            rs2_record_device_get_write_stats(_dev.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
@@ -266,6 +266,43 @@ namespace rs2
             return results;
         }
 
+        /**
+        * retrieve the counters of the pools the sensor allocates frame buffers from
+        * \return   frame buffer pool counters
+        */
+        rs2_frame_pool_stats get_frame_pool_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame_pool_stats stats;
+            rs2_get_frame_pool_stats(_sensor.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * allocate the payload of the sensor frames through the given functions
+        * must not be called while streaming
+        * \param[in] allocate     void*(int size) returning a buffer of at least size bytes, 64-byte aligned (or null to have the library allocate it)
+        * \param[in] deallocate   void(void* buffer, int size) releasing a buffer returned by allocate
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * go back to the library's own allocation of frame payloads
+        */
+        void reset_frame_allocator() const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), nullptr, &e);
+            error::handle(e);
+        }
+
         /**
         * get the recommended list of filters by the sensor
         * \return   list of filters that recommended by sensor
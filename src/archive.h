@@ -11,6 +11,7 @@
 namespace librealsense
 {
     struct frame_additional_data;
+    class frame_buffer_pool;
 
     class archive_interface : public sensor_part
     {
@@ -21,6 +22,9 @@ namespace librealsense
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
+        // Frames allocated from now on take their payload from this pool
+        virtual void set_frame_buffer_pool(std::shared_ptr<frame_buffer_pool> pool) = 0;
+
         virtual void flush() = 0;
 
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
@@ -31,6 +35,7 @@ namespace librealsense
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
+        std::shared_ptr<frame_buffer_pool> pool,
         std::shared_ptr<platform::time_service> ts,
         std::shared_ptr<metadata_parser_map> parsers);
 
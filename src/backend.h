@@ -27,6 +27,7 @@
 
 const uint16_t MAX_RETRIES                 = 100;
 const uint8_t  DEFAULT_V4L2_FRAME_BUFFERS  = 4;
+const uint8_t  MAX_ZERO_COPY_FRAMES        = 16;
 const uint16_t DELAY_FOR_RETRIES           = 10;
 const uint16_t DELAY_FOR_CONNECTION        = 50;
 const int      DISCONNECT_PERIOD_MS        = 6000;
@@ -363,6 +364,10 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            // True when the frame buffers passed to the frame callback stay valid until the
+            // continuation is invoked, so frames may reference them instead of copying
+            virtual bool supports_zero_copy() const { return false; }
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -488,6 +493,11 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            bool supports_zero_copy() const override
+            {
+                return _dev->supports_zero_copy();
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -750,6 +760,14 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            bool supports_zero_copy() const override
+            {
+                for (auto&& dev : _dev)
+                    if (!dev->supports_zero_copy())
+                        return false;
+                return true;
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
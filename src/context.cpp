@@ -13,12 +13,14 @@
 #include "l500/l500-factory.h"
 #include "ds/ds-timestamp.h"
 #include "backend.h"
-#include <media/ros/ros_reader.h>
+#include <media/ros/ros_reader_factory.h>
 #include "types.h"
 #include "stream.h"
 #include "environment.h"
 #include "context.h"
 #include "fw-update/fw-update-factory.h"
+#include "../third-party/json.hpp"
+#include <rsutils/string/from.h>
 
 template<>
 bool contains(const std::shared_ptr<librealsense::device_info>& first,
@@ -71,9 +73,49 @@ namespace librealsense
         {rs_fourcc('M','J','P','G'), RS2_STREAM_COLOR},
     };
 
-    context::context( backend_type type )
+    namespace
+    {
+        void apply_thread_pool_settings( nlohmann::json const & j )
+        {
+            auto & env = environment::get_instance();
+            auto pool = env.get_task_pool();
+            auto s = pool->get_settings();
+            auto it = j.find( "size" );
+            if( it != j.end() )
+                s.size = it->get< size_t >();
+            it = j.find( "cpus" );
+            if( it != j.end() )
+                s.cpus = it->get< std::vector< int > >();
+            it = j.find( "priority" );
+            if( it != j.end() )
+                s.priority = it->get< int >();
+            if( ! pool->configure( s ) )
+                LOG_WARNING( "Failed to apply the CPUs or priority of the thread pool; its threads run without them" );
+
+            it = j.find( "converter-threads" );
+            if( it != j.end() )
+                env.set_converter_threads( std::max( it->get< size_t >(), size_t( 1 ) ) );
+        }
+    }
+
+    context::context( backend_type type, std::string const & json_settings )
         : _devices_changed_callback(nullptr, [](rs2_devices_changed_callback*){})
     {
+        if( ! json_settings.empty() )
+        {
+            try
+            {
+                auto settings = nlohmann::json::parse( json_settings );
+                auto it = settings.find( "thread-pool" );
+                if( it != settings.end() )
+                    apply_thread_pool_settings( *it );
+            }
+            catch( nlohmann::json::exception const & e )
+            {
+                throw invalid_value_exception( rsutils::string::from() << "invalid context settings: " << e.what() );
+            }
+        }
+
         static bool version_logged=false;
         if (!version_logged)
         {
@@ -234,7 +276,7 @@ namespace librealsense
             register_info(RS2_CAMERA_INFO_PRODUCT_ID, pid_str);
 
             color_ep->register_processing_block(processing_block_factory::create_pbf_vector<yuy2_converter>(RS2_FORMAT_YUYV, map_supported_color_formats(RS2_FORMAT_YUYV), RS2_STREAM_COLOR));
-            color_ep->register_processing_block({ {RS2_FORMAT_MJPEG} }, { {RS2_FORMAT_RGB8, RS2_STREAM_COLOR} }, []() { return std::make_shared<mjpeg_converter>(RS2_FORMAT_RGB8); });
+            color_ep->register_processing_block(processing_block_factory::create_pbf_vector<mjpeg_converter>(RS2_FORMAT_MJPEG, map_supported_color_formats(RS2_FORMAT_MJPEG), RS2_STREAM_COLOR));
             color_ep->register_processing_block(processing_block_factory::create_id_pbf(RS2_FORMAT_MJPEG, RS2_STREAM_COLOR));
 
             // Timestamps are given in units set by device which may vary among the OEM vendors.
@@ -512,7 +554,7 @@ namespace librealsense
             throw librealsense::invalid_value_exception( rsutils::string::from()
                                                          << "File \"" << file << "\" already loaded to context" );
         }
-        auto playback_dev = std::make_shared<playback_device>(shared_from_this(), std::make_shared<ros_reader>(file, shared_from_this()));
+        auto playback_dev = std::make_shared<playback_device>(shared_from_this(), make_ros_reader(file, shared_from_this()));
         auto dinfo = std::make_shared<playback_device_info>(playback_dev);
         auto prev_playback_devices = _playback_devices;
         _playback_devices[file] = dinfo;
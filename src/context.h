@@ -103,7 +103,10 @@ namespace librealsense
     class context : public std::enable_shared_from_this<context>
     {
     public:
-        explicit context( backend_type type );
+        // The settings are a JSON object, e.g.:
+        //     { "thread-pool": { "size": 8, "cpus": [ 4, 5, 6, 7 ], "priority": 10, "converter-threads": 2 } }
+        // The thread pool is shared by all contexts, so its settings apply to all of them.
+        explicit context( backend_type type, std::string const & json_settings = std::string() );
 
         void stop() { _device_watcher->stop(); }
         ~context();
@@ -35,9 +35,11 @@ namespace librealsense
 
         virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) = 0;
 
+        // 'size' of 0 holds a float3 vertex and a float2 texture coordinate per pixel
         virtual frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, 
-            rs2_extension frame_type = RS2_EXTENSION_POINTS) = 0;
+            rs2_extension frame_type = RS2_EXTENSION_POINTS,
+            size_t size = 0) = 0;
 
         virtual void frame_ready(frame_holder result) = 0;
         virtual rs2_source* get_c_wrapper() = 0;
@@ -50,6 +52,7 @@ namespace librealsense
         virtual void set_output_callback(frame_callback_ptr callback) = 0;
         virtual void invoke(frame_holder frame) = 0;
         virtual synthetic_source_interface& get_source() = 0;
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
 
         virtual ~processing_block_interface() = default;
     };
@@ -330,6 +330,7 @@ namespace librealsense
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual const std::string& get_file_name() const = 0;
+            virtual rs2_record_write_stats get_write_stats() const { return {}; }
             virtual ~writer() = default;
         };
 
@@ -346,6 +347,8 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            // Decompress up to this many chunks of the file ahead of the one being read, on other threads
+            virtual void set_chunk_read_ahead(size_t chunks) {}
         };
     }
 }
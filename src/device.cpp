@@ -332,6 +332,13 @@ std::vector<rs2_format> device::map_supported_color_formats(rs2_format source_fo
     case RS2_FORMAT_UYVY:
         target_formats.push_back(RS2_FORMAT_UYVY);
         break;
+    case RS2_FORMAT_MJPEG:
+#ifdef RS2_USE_LIBJPEG_TURBO
+        target_formats.push_back(RS2_FORMAT_Y8);
+#else
+        target_formats = { RS2_FORMAT_RGB8 }; // stb_image decodes to RGB only
+#endif
+        break;
     default:
         LOG_ERROR("Format is not supported for mapping");
     }
@@ -223,7 +223,7 @@ namespace librealsense
         
         if (_pid == ds::RS465_PID)
         {
-            color_ep.register_processing_block({ {RS2_FORMAT_MJPEG} }, { {RS2_FORMAT_RGB8, RS2_STREAM_COLOR} }, []() { return std::make_shared<mjpeg_converter>(RS2_FORMAT_RGB8); });
+            color_ep.register_processing_block(processing_block_factory::create_pbf_vector<mjpeg_converter>(RS2_FORMAT_MJPEG, map_supported_color_formats(RS2_FORMAT_MJPEG), RS2_STREAM_COLOR));
             color_ep.register_processing_block(processing_block_factory::create_id_pbf(RS2_FORMAT_MJPEG, RS2_STREAM_COLOR));
         }
     }
@@ -4,6 +4,7 @@
 #pragma once
 #include "core/streaming.h"
 #include "types.h"
+#include <rsutils/concurrency/task-pool.h>
 #include <memory>
 #include <mutex>
 
@@ -101,6 +102,13 @@ namespace librealsense
         void set_time_service(std::shared_ptr<platform::time_service> ts);
         std::shared_ptr<platform::time_service> get_time_service();
 
+        // The threads processing blocks and format converters of all devices split their frames between
+        std::shared_ptr<task_pool> get_task_pool() { return _task_pool; }
+
+        // Number of threads each format conversion is split between (1 for none)
+        void set_converter_threads(size_t threads) { _converter_threads = threads; }
+        size_t get_converter_threads() const { return _converter_threads; }
+
         environment(const environment&) = delete;
         environment(const environment&&) = delete;
         environment operator=(const environment&) = delete;
@@ -110,8 +118,10 @@ namespace librealsense
         extrinsics_graph _extrinsics;
         std::atomic<int> _stream_id;
         std::shared_ptr<platform::time_service> _ts;
+        std::shared_ptr<task_pool> _task_pool;
+        std::atomic<size_t> _converter_threads;
 
-        environment(){_stream_id = 0;}
+        environment() : _task_pool(std::make_shared<task_pool>()), _converter_threads(1) {_stream_id = 0;}
 
     };
 }
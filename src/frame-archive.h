@@ -16,8 +16,7 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
-        std::atomic<bool> recycle_frames;
+        std::shared_ptr<frame_buffer_pool> _pool; // frame payloads are returned here when frames are released
         int pending_frames = 0;
         std::recursive_mutex mutex;
         std::shared_ptr<platform::time_service> _time_service;
@@ -29,35 +28,11 @@ namespace librealsense
         T alloc_frame(const size_t size, const frame_additional_data& additional_data, bool requires_memory)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
-                {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
-                }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
-                }
-            }
-
             if (requires_memory)
             {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                // The buffer is not zero-filled: whoever allocates a frame writes all of it, and a composite frame
+                // nulls its embedded frames before it holds any
+                backbuffer.data = frame_buffer(size, frame_buffer_allocator<byte>(std::atomic_load(&_pool)));
             }
             backbuffer.additional_data = additional_data;
             return backbuffer;
@@ -83,16 +58,10 @@ namespace librealsense
             if (frame)
             {
                 auto f = (T*)frame;
-                std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 frame->keep();
 
-                if (recycle_frames)
-                {
-                    freelist.push_back(std::move(*f));
-                }
-                lock.unlock();
-
+                // Destroying the frame data returns it to the pool
                 if (f->is_fixed())
                     published_frames.deallocate(f);
                 else
@@ -137,14 +106,17 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        void set_frame_buffer_pool(std::shared_ptr<frame_buffer_pool> pool) override { std::atomic_store(&_pool, pool); }
+
         friend class frame;
 
     public:
         explicit frame_archive(std::atomic<uint32_t>* in_max_frame_queue_size,
+            std::shared_ptr<frame_buffer_pool> pool,
             std::shared_ptr<platform::time_service> ts,
             std::shared_ptr<metadata_parser_map> parsers)
             : max_frame_queue_size(in_max_frame_queue_size),
-            recycle_frames(true), mutex(), _time_service(ts),
+            _pool(pool), mutex(), _time_service(ts),
             _metadata_parsers(parsers)
         {
             published_frames_count = 0;
@@ -170,7 +142,6 @@ namespace librealsense
         {
             published_frames.stop_allocation();
             callback_inflight.stop_allocation();
-            recycle_frames = false;
 
             auto callbacks_inflight = callback_inflight.get_size();
             if (callbacks_inflight > 0)
@@ -180,11 +151,6 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
-
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
             {
@@ -0,0 +1,60 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "frame-buffer-lender.h"
+
+namespace librealsense
+{
+    frame_buffer_lender::frame_buffer_lender()
+        : _generation( 0 )
+        , _max_lent( 0 )
+        , _lent( 0 )
+    {
+    }
+
+    void frame_buffer_lender::open( int max_lent )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_generation;
+        _max_lent = max_lent;
+        _lent = 0;
+    }
+
+    void frame_buffer_lender::close()
+    {
+        // Waits for any buffer being given back right now, so none is queued once this returns
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_generation;
+        _max_lent = 0;
+        _lent = 0;
+    }
+
+    std::function< void() > frame_buffer_lender::lend( std::function< void() > give_back )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( _lent >= _max_lent )
+            return nullptr;
+        ++_lent;
+
+        auto self = shared_from_this();
+        auto const generation = _generation;
+        return [self, generation, give_back]() {
+            self->give_back( generation, give_back );
+        };
+    }
+
+    void frame_buffer_lender::give_back( uint64_t generation, std::function< void() > const & give_back )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( generation != _generation )
+            return;  // the stream was closed and its buffers taken back
+        --_lent;
+        give_back();
+    }
+
+    int frame_buffer_lender::lent() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _lent;
+    }
+}
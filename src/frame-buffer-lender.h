@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace librealsense
+{
+    // Keeps track of the backend buffers a sensor lends to its frames (zero-copy), and gives each back
+    // to the backend when its frame is released -- but only if the stream it came from is still open.
+    //
+    // Frames may outlive their stream: once the stream is closed, the backend takes back whatever is
+    // still lent (see v4l_uvc_device::close), and giving those buffers back late would queue a buffer
+    // of the old stream on the reopened one. Each stream is a new generation of lent buffers, and
+    // buffers of a previous generation are dropped instead of given back.
+    class frame_buffer_lender : public std::enable_shared_from_this< frame_buffer_lender >
+    {
+    public:
+        frame_buffer_lender();
+
+        // A stream was opened, which lends up to 'max_lent' buffers
+        void open( int max_lent );
+        // The stream was closed: buffers still lent are never given back
+        void close();
+
+        // Lend a buffer, given back to the backend by 'give_back'
+        // Returns what to call once the frame is done with the buffer, or nullptr when the stream lends
+        // all it may already (the frame should then copy the buffer).
+        std::function< void() > lend( std::function< void() > give_back );
+
+        // Buffers of the current stream that were lent and not given back yet
+        int lent() const;
+
+    private:
+        void give_back( uint64_t generation, std::function< void() > const & give_back );
+
+        mutable std::mutex _mutex;
+        uint64_t _generation;
+        int _max_lent;
+        int _lent;
+    };
+}
@@ -0,0 +1,161 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "frame-buffer-pool.h"
+
+#include <cstdint>
+#include <cstdlib>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace librealsense
+{
+    frame_buffer_pool::frame_buffer_pool( std::shared_ptr< const std::atomic< uint32_t > > high_water_mark_mb,
+                                          std::shared_ptr< rs2_frame_allocator > allocator )
+        : _high_water_mark_mb( std::move( high_water_mark_mb ) )
+        , _allocator( std::move( allocator ) )
+        , _recycle( true )
+        , _hits( 0 )
+        , _misses( 0 )
+        , _bytes_resident( 0 )
+    {
+    }
+
+    frame_buffer_pool::~frame_buffer_pool()
+    {
+        flush();
+    }
+
+    size_t frame_buffer_pool::size_class( size_t size )
+    {
+        // Small buffers (motion, metadata-only) are packed tighter than images, which are rounded up
+        // to a page: frames of the same stream always fall in the same class
+        size_t const granularity = size <= 4096 ? ALIGNMENT : 4096;
+        return ( size + granularity - 1 ) / granularity * granularity;
+    }
+
+    void * frame_buffer_pool::aligned_alloc( size_t size )
+    {
+        size = size_class( size );
+#ifdef _WIN32
+        return _aligned_malloc( size, ALIGNMENT );
+#else
+        void * buffer = nullptr;
+        if( posix_memalign( &buffer, ALIGNMENT, size ) )
+            return nullptr;
+        return buffer;
+#endif
+    }
+
+    void frame_buffer_pool::aligned_free( void * buffer )
+    {
+#ifdef _WIN32
+        _aligned_free( buffer );
+#else
+        free( buffer );
+#endif
+    }
+
+    void * frame_buffer_pool::allocate_buffer( size_t size )
+    {
+        if( ! _allocator )
+            return aligned_alloc( size );
+
+        void * buffer = _allocator->allocate( static_cast< int >( size ) );
+        if( buffer && reinterpret_cast< uintptr_t >( buffer ) % ALIGNMENT == 0 )
+            return buffer;
+        if( buffer )
+            _allocator->deallocate( buffer, static_cast< int >( size ) );
+
+        // Fall back to the heap for this buffer
+        buffer = aligned_alloc( size );
+        if( buffer )
+        {
+            std::lock_guard< std::mutex > lock( _heap_buffers_mutex );
+            _heap_buffers.insert( buffer );
+        }
+        return buffer;
+    }
+
+    void frame_buffer_pool::free_buffer( void * buffer, size_t size )
+    {
+        if( _allocator )
+        {
+            std::lock_guard< std::mutex > lock( _heap_buffers_mutex );
+            if( ! _heap_buffers.erase( buffer ) )
+            {
+                _allocator->deallocate( buffer, static_cast< int >( size ) );
+                return;
+            }
+        }
+        aligned_free( buffer );
+    }
+
+    void * frame_buffer_pool::acquire( size_t size )
+    {
+        auto const cls = size_class( size );
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            auto it = _free_lists.find( cls );
+            if( it != _free_lists.end() && ! it->second.empty() )
+            {
+                void * buffer = it->second.back();
+                it->second.pop_back();
+                _bytes_resident -= cls;
+                ++_hits;
+                return buffer;
+            }
+        }
+        ++_misses;
+        return allocate_buffer( cls );
+    }
+
+    void frame_buffer_pool::release( void * buffer, size_t size )
+    {
+        if( ! buffer )
+            return;
+
+        auto const cls = size_class( size );
+        if( _recycle )
+        {
+            unsigned long long const high_water_mark
+                = ( _high_water_mark_mb ? _high_water_mark_mb->load() : DEFAULT_HIGH_WATER_MARK_MB ) * 1024ULL * 1024ULL;
+
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _bytes_resident + cls <= high_water_mark )
+            {
+                _free_lists[cls].push_back( buffer );
+                _bytes_resident += cls;
+                return;
+            }
+        }
+        free_buffer( buffer, cls );
+    }
+
+    void frame_buffer_pool::flush()
+    {
+        _recycle = false;
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto & kvp : _free_lists )
+            for( auto buffer : kvp.second )
+                free_buffer( buffer, kvp.first );
+        _free_lists.clear();
+        _bytes_resident = 0;
+    }
+
+    void frame_buffer_pool::start()
+    {
+        _recycle = true;
+    }
+
+    rs2_frame_pool_stats frame_buffer_pool::get_stats() const
+    {
+        rs2_frame_pool_stats stats;
+        stats.hits = _hits;
+        stats.misses = _misses;
+        stats.bytes_resident = _bytes_resident;
+        return stats;
+    }
+}
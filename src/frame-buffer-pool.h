@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <librealsense2/hpp/rs_types.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace librealsense
+{
+    // Recycles frame payload buffers between frames of a frame_source.
+    //
+    // Buffers are rounded up to a size class and kept in one free list per class, so acquiring and
+    // releasing a buffer are both O(1). All buffers are 64-byte aligned, for the benefit of the
+    // vectorized processing blocks. Released buffers are freed instead of recycled once the idle
+    // bytes held by the pool would go beyond the high-water mark.
+    //
+    // Memory comes from the heap, unless the user provided an allocator for the frames of the source
+    // (rs2_set_frame_allocator). The pool then holds on to the allocator for as long as any of its
+    // buffers is alive. A buffer the allocator cannot provide (null) or does not align is taken from
+    // the heap instead, and the pool remembers to free it there.
+    class frame_buffer_pool
+    {
+    public:
+        static const size_t ALIGNMENT = 64;
+        static const uint32_t DEFAULT_HIGH_WATER_MARK_MB = 256;
+
+        // The high-water mark, in MB, is set by the frame_source (and exposed as an option); the pool shares
+        // it because it may outlive the source, held by the frames it allocated
+        explicit frame_buffer_pool( std::shared_ptr< const std::atomic< uint32_t > > high_water_mark_mb,
+                                    std::shared_ptr< rs2_frame_allocator > allocator = nullptr );
+        ~frame_buffer_pool();
+
+        frame_buffer_pool( const frame_buffer_pool & ) = delete;
+        frame_buffer_pool & operator=( const frame_buffer_pool & ) = delete;
+
+        // Returns a buffer of at least 'size' bytes; its content is undefined
+        void * acquire( size_t size );
+        // Returns a buffer obtained from acquire() with the same size
+        void release( void * buffer, size_t size );
+
+        // Free all idle buffers and stop recycling the ones released from now on (when streaming stops)
+        void flush();
+        // Resume recycling (when streaming starts)
+        void start();
+
+        rs2_frame_pool_stats get_stats() const;
+
+        static size_t size_class( size_t size );
+
+        static void * aligned_alloc( size_t size );
+        static void aligned_free( void * buffer );
+
+    private:
+        void * allocate_buffer( size_t size );
+        void free_buffer( void * buffer, size_t size );
+
+        std::shared_ptr< const std::atomic< uint32_t > > _high_water_mark_mb;
+        std::shared_ptr< rs2_frame_allocator > _allocator;
+        std::atomic< bool > _recycle;
+
+        mutable std::mutex _mutex;
+        std::unordered_map< size_t, std::vector< void * > > _free_lists;
+
+        std::atomic< unsigned long long > _hits;
+        std::atomic< unsigned long long > _misses;
+        std::atomic< unsigned long long > _bytes_resident;
+
+        // Buffers allocated from the heap although there is a user allocator
+        std::mutex _heap_buffers_mutex;
+        std::unordered_set< void * > _heap_buffers;
+    };
+
+    // Standard allocator that takes its memory from a frame_buffer_pool (or from the heap, when
+    // there is none), and that default-initializes elements so frame buffers are not zero-filled
+    // before being overwritten
+    template< class T >
+    class frame_buffer_allocator
+    {
+    public:
+        typedef T value_type;
+
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        frame_buffer_allocator() = default;
+        explicit frame_buffer_allocator( std::shared_ptr< frame_buffer_pool > pool )
+            : _pool( std::move( pool ) )
+        {
+        }
+        template< class U >
+        frame_buffer_allocator( const frame_buffer_allocator< U > & other )
+            : _pool( other.get_pool() )
+        {
+        }
+
+        T * allocate( size_t n )
+        {
+            auto size = n * sizeof( T );
+            void * buffer = _pool ? _pool->acquire( size ) : frame_buffer_pool::aligned_alloc( size );
+            if( ! buffer )
+                throw std::bad_alloc();
+            return static_cast< T * >( buffer );
+        }
+
+        void deallocate( T * p, size_t n )
+        {
+            if( _pool )
+                _pool->release( p, n * sizeof( T ) );
+            else
+                frame_buffer_pool::aligned_free( p );
+        }
+
+        template< class U >
+        void construct( U * p )
+        {
+            ::new( static_cast< void * >( p ) ) U;
+        }
+        template< class U, class... Args >
+        void construct( U * p, Args &&... args )
+        {
+            ::new( static_cast< void * >( p ) ) U( std::forward< Args >( args )... );
+        }
+
+        const std::shared_ptr< frame_buffer_pool > & get_pool() const { return _pool; }
+
+        template< class U >
+        bool operator==( const frame_buffer_allocator< U > & other ) const { return _pool == other.get_pool(); }
+        template< class U >
+        bool operator!=( const frame_buffer_allocator< U > & other ) const { return _pool != other.get_pool(); }
+
+    private:
+        std::shared_ptr< frame_buffer_pool > _pool;
+    };
+}
@@ -156,6 +156,10 @@ bool frame::supports_frame_metadata( const rs2_frame_metadata_value & frame_meta
 
 int frame::get_frame_data_size() const
 {
+    // Frames lent a backend buffer (zero-copy) do not own any data of their own
+    if( on_release.get_data() && on_release.get_size() )
+        return (int)on_release.get_size();
+
     return (int)data.size();
 }
 
@@ -6,6 +6,7 @@
 #include "types.h"
 #include "depth-sensor.h"
 #include "core/extension.h"
+#include "frame-buffer-pool.h"
 #include <atomic>
 #include <array>
 #include <math.h>
@@ -194,11 +195,14 @@ struct LRS_EXTENSION_API frame_holder
 };
 
 
+// Frame payloads are taken from the frame_buffer_pool of the archive that allocates the frame
+typedef std::vector< byte, frame_buffer_allocator< byte > > frame_buffer;
+
 // Define a movable but explicitly noncopyable buffer type to hold our frame data
 class LRS_EXTENSION_API frame : public frame_interface
 {
 public:
-    std::vector< byte > data;
+    frame_buffer data;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
     explicit frame()
@@ -51,6 +51,8 @@ namespace librealsense
         case RS2_FORMAT_Z16H: return 16;
         case RS2_FORMAT_FG: return 16;
         case RS2_FORMAT_Y411: return 12;
+        case RS2_FORMAT_XYZ16F: return 6 * 8;
+        case RS2_FORMAT_XYZ16: return 6 * 8;
         default: assert(false); return 0;
         }
     }
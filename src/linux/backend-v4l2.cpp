@@ -530,7 +530,8 @@ namespace librealsense
                 throw linux_backend_exception(rsutils::string::from() << "xioctl(VIDIOC_STREAMOFF) failed for buf_type=" << type);
         }
 
-        void req_io_buff(int fd, uint32_t count, std::string dev_name,
+        // Returns false when the buffers could not be released because they are still mapped
+        bool req_io_buff(int fd, uint32_t count, std::string dev_name,
                         v4l2_memory mem_type, v4l2_buf_type type)
         {
             struct v4l2_requestbuffers req = { count, type, mem_type, {}};
@@ -539,11 +540,14 @@ namespace librealsense
             {
                 if(errno == EINVAL)
                     LOG_ERROR(dev_name + " does not support memory mapping");
+                else if(errno == EBUSY && !count)
+                    return false;
                 else
-                    return;
+                    return true;
                     //D457 - fails on close (when num = 0)
                     //throw linux_backend_exception("xioctl(VIDIOC_REQBUFS) failed");
             }
+            return true;
         }
 
         std::vector<std::string> v4l_uvc_device::get_video_paths()
@@ -1192,7 +1196,15 @@ namespace librealsense
                 allocate_io_buffers(0);
 
                 // Release IO
-                negotiate_kernel_buffers(0);
+                // Frames lent to the user (zero-copy) keep their buffers mapped, and the kernel then refuses
+                // to release them: opening the device again takes them back, the old buffers being freed
+                // along with the last frame that maps them
+                if (!negotiate_kernel_buffers(0))
+                {
+                    LOG_DEBUG("Kernel buffers of " << _name << " are still held by frames; reopening the device");
+                    unmap_device_descriptor();
+                    map_device_descriptor();
+                }
 
                 _callback = nullptr;
             }
@@ -1962,9 +1974,9 @@ namespace librealsense
             stream_off(_fd);
         }
 
-        void v4l_uvc_device::negotiate_kernel_buffers(size_t num) const
+        bool v4l_uvc_device::negotiate_kernel_buffers(size_t num) const
         {
-            req_io_buff(_fd, num, _name,
+            return req_io_buff(_fd, num, _name,
                         _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR,
                         V4L2_BUF_TYPE_VIDEO_CAPTURE);
         }
@@ -2149,18 +2161,18 @@ namespace librealsense
             }
         }
 
-        void v4l_uvc_meta_device::negotiate_kernel_buffers(size_t num) const
+        bool v4l_uvc_meta_device::negotiate_kernel_buffers(size_t num) const
         {
-            v4l_uvc_device::negotiate_kernel_buffers(num);
+            bool released = v4l_uvc_device::negotiate_kernel_buffers(num);
 
             if (_md_fd == -1)
             {
                 // D457 development - added for mipi device, for IR because no metadata there
-                return;
+                return released;
             }
-            req_io_buff(_md_fd, num, _name,
+            return req_io_buff(_md_fd, num, _name,
                         _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR,
-                        LOCAL_V4L2_BUF_TYPE_META_CAPTURE);
+                        LOCAL_V4L2_BUF_TYPE_META_CAPTURE) && released;
         }
 
         void v4l_uvc_meta_device::allocate_io_buffers(size_t buffers)
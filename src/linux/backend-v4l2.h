@@ -240,7 +240,7 @@ namespace librealsense
 
             virtual void streamon() const = 0;
             virtual void streamoff() const = 0;
-            virtual void negotiate_kernel_buffers(size_t num) const = 0;
+            virtual bool negotiate_kernel_buffers(size_t num) const = 0;  // false when the buffers are still mapped
 
             virtual void allocate_io_buffers(size_t num) = 0;
             virtual void map_device_descriptor() = 0;
@@ -370,6 +370,9 @@ namespace librealsense
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
 
+            // Kernel buffers are re-queued (VIDIOC_QBUF) only when the frame continuation is invoked
+            bool supports_zero_copy() const override { return true; }
+
         protected:
             virtual uint32_t get_cid(rs2_option option) const;
 
@@ -379,7 +382,7 @@ namespace librealsense
 
             virtual void streamon() const override;
             virtual void streamoff() const override;
-            virtual void negotiate_kernel_buffers(size_t num) const override;
+            virtual bool negotiate_kernel_buffers(size_t num) const override;
 
             virtual void allocate_io_buffers(size_t num) override;
             virtual void map_device_descriptor() override;
@@ -438,7 +441,7 @@ namespace librealsense
 
             void streamon() const;
             void streamoff() const;
-            void negotiate_kernel_buffers(size_t num) const;
+            bool negotiate_kernel_buffers(size_t num) const;
             void allocate_io_buffers(size_t num);
             void map_device_descriptor();
             void unmap_device_descriptor();
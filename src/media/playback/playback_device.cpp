@@ -35,6 +35,7 @@ playback_device::playback_device(std::shared_ptr<context> ctx, std::shared_ptr<d
     }
 
     m_reader = serializer;
+    m_read_ahead = std::make_shared<playback_read_ahead>(m_reader);
     (*m_read_thread)->start();
 
     //Read header and build device from recorded device snapshot
@@ -123,6 +124,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                m_read_ahead->stop(true);
                 m_reader->enable_stream(filters);
             });
         };
@@ -131,6 +133,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                m_read_ahead->stop(true);
                 m_reader->disable_stream(filters);
             });
         };
@@ -183,6 +186,7 @@ playback_device::~playback_device()
     }
 
     (*m_read_thread)->stop();
+    m_read_ahead->stop(false);
 }
 
 std::shared_ptr<context> playback_device::get_context() const
@@ -268,6 +272,7 @@ void playback_device::seek_to_time(std::chrono::nanoseconds time)
     (*m_read_thread)->invoke([this, time](dispatcher::cancellable_timer t)
     {
         LOG_INFO("Seek to time: " << time.count());
+        m_read_ahead->stop(false);
         m_reader->seek_to_time(time);
         m_device_description = m_reader->query_device_description(time);
         update_extensions(m_device_description);
@@ -369,6 +374,7 @@ void playback_device::resume()
         auto total_duration = m_reader->query_duration();
         if (m_last_published_timestamp >= total_duration)
             m_last_published_timestamp = device_serializer::nanoseconds(0);
+        m_read_ahead->stop(false);
         m_reader->reset();
         m_reader->seek_to_time(m_last_published_timestamp);
         while (m_last_published_timestamp != device_serializer::nanoseconds(0) && !m_reader->read_next_data()->is<serialized_frame>());
@@ -397,6 +403,29 @@ bool playback_device::is_real_time() const
     return m_real_time;
 }
 
+void playback_device::set_read_ahead(size_t frames, size_t bytes)
+{
+    LOG_INFO("Set read-ahead to " << frames << " frames, " << bytes << " bytes");
+    (*m_read_thread)->invoke([this, frames, bytes](dispatcher::cancellable_timer t)
+    {
+        // What was read ahead is read again with the new settings
+        m_read_ahead->stop(true);
+        m_read_ahead->configure(frames, bytes);
+        // A few chunks are enough to keep decompression ahead of the reader
+        m_reader->set_chunk_read_ahead(frames ? 4 : 0);
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for set_read_ahead, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+}
+
+rs2_playback_read_ahead_stats playback_device::get_read_ahead_stats() const
+{
+    return m_read_ahead->get_stats();
+}
+
 platform::backend_device_group playback_device::get_device_data() const
 {
     return platform::backend_device_group({ platform::playback_device_info{ m_reader->get_file_name() } });
@@ -500,6 +529,7 @@ void playback_device::stop_internal()
     m_is_started = false;
     m_is_paused = false;
 
+    m_read_ahead->stop(false);
     m_reader->reset();
     m_prev_timestamp = std::chrono::nanoseconds(0);
     catch_up();
@@ -593,7 +623,7 @@ void playback_device::try_looping()
 
         //Read next data from the serializer, on success: 'obj' will be a valid object that came from
         // sensor number 'sensor_index' with a timestamp equal to 'timestamp'
-        std::shared_ptr<serialized_data> data = m_reader->read_next_data();
+        std::shared_ptr<serialized_data> data = m_read_ahead->read_next_data();
         if (data->as<serialized_end_of_file>())
         {
             LOG_INFO("End of file reached");
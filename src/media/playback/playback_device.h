@@ -10,6 +10,7 @@
 #include "../../archive.h"
 #include "../../sensor.h"
 #include "playback_sensor.h"
+#include "playback_read_ahead.h"
 
 namespace librealsense
 {
@@ -41,6 +42,8 @@ namespace librealsense
         bool is_real_time() const;
         const std::string& get_file_name() const;
         uint64_t get_position() const;
+        void set_read_ahead(size_t frames, size_t bytes);
+        rs2_playback_read_ahead_stats get_read_ahead_stats() const;
         signal<playback_device, rs2_playback_status> playback_status_changed;
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
@@ -77,6 +80,7 @@ namespace librealsense
         lazy<std::shared_ptr<dispatcher>> m_read_thread;
         std::shared_ptr<context> m_context;
         std::shared_ptr<device_serializer::reader> m_reader;
+        std::shared_ptr<playback_read_ahead> m_read_ahead;
         device_serializer::device_snapshot m_device_description;
         std::atomic_bool m_is_started;
         std::atomic_bool m_is_paused;
@@ -0,0 +1,193 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "playback_read_ahead.h"
+#include "../../frame.h"
+
+namespace librealsense
+{
+    const size_t playback_read_ahead::max_frames;
+
+    playback_read_ahead::playback_read_ahead(std::shared_ptr<device_serializer::reader> reader)
+        : _reader(reader),
+        _max_frames(0),
+        _max_bytes(0),
+        _bytes(0),
+        _stopping(false),
+        _done(false),
+        _stalls(0),
+        _full(0),
+        _played_time(0),
+        _skip_time(0),
+        _skipping(false)
+    {
+    }
+
+    playback_read_ahead::~playback_read_ahead()
+    {
+        stop(false);
+    }
+
+    void playback_read_ahead::configure(size_t frames, size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _max_frames = std::min(frames, max_frames);
+        _max_bytes = bytes;
+    }
+
+    std::shared_ptr<device_serializer::serialized_data> playback_read_ahead::read_next_data()
+    {
+        auto data = read_next();
+        // After a rewind, what was played before the data it rewound to is read again first
+        while (_skipping)
+        {
+            if (data->is<device_serializer::serialized_end_of_file>() || data->get_timestamp() > _skip_time)
+                _skipping = false;
+            else if (data->get_timestamp() < _skip_time || _skip.erase(get_key(*data)))
+                data = read_next();
+            else
+                break;
+        }
+
+        if (!data->is<device_serializer::serialized_end_of_file>())
+        {
+            if (data->get_timestamp() != _played_time)
+            {
+                _played_time = data->get_timestamp();
+                _played.clear();
+            }
+            _played.insert(get_key(*data));
+        }
+        return data;
+    }
+
+    std::shared_ptr<device_serializer::serialized_data> playback_read_ahead::read_next()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        // Once the read-ahead thread is done, the reader returns what it would have (e.g., the end of file again)
+        if (!_max_frames || (_done && _queue.empty()))
+        {
+            lock.unlock();
+            return _reader->read_next_data();
+        }
+
+        if (!_thread.joinable())
+            _thread = std::thread([this]() { read_ahead(); });
+
+        if (_queue.empty())
+        {
+            ++_stalls;
+            _data_cv.wait(lock, [this]() { return !_queue.empty(); });
+        }
+        auto next = std::move(_queue.front());
+        _queue.pop_front();
+        _bytes -= next.bytes;
+        lock.unlock();
+        _space_cv.notify_one();
+
+        if (next.error)
+            std::rethrow_exception(next.error);
+        return next.data;
+    }
+
+    playback_read_ahead::data_key playback_read_ahead::get_key(const device_serializer::serialized_data& data)
+    {
+        if (auto frame = data.as<device_serializer::serialized_frame>())
+            return data_key(1, frame->stream_id.device_index, frame->stream_id.sensor_index, frame->stream_id.stream_type,
+                frame->stream_id.stream_index, frame->frame ? frame->frame->get_frame_number() : 0);
+        if (auto option = data.as<device_serializer::serialized_option>())
+            return data_key(2, option->sensor_id.device_index, option->sensor_id.sensor_index, option->option_id, 0, 0);
+        if (auto notification = data.as<device_serializer::serialized_notification>())
+            return data_key(3, notification->sensor_id.device_index, notification->sensor_id.sensor_index,
+                notification->notif.category, notification->notif.type, 0);
+        return data_key(0, 0, 0, 0, 0, 0);
+    }
+
+    void playback_read_ahead::read_ahead()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;)
+        {
+            auto has_room = [this]() {
+                return _queue.size() < _max_frames && (!_max_bytes || _bytes < _max_bytes);
+            };
+            if (!has_room())
+            {
+                ++_full;
+                _space_cv.wait(lock, [&]() { return _stopping || has_room(); });
+            }
+            if (_stopping)
+                break;
+            lock.unlock();
+
+            item next{ nullptr, nullptr, 0 };
+            try
+            {
+                next.data = _reader->read_next_data();
+                auto frame = next.data->as<device_serializer::serialized_frame>();
+                if (frame && frame->frame)
+                    next.bytes = frame->frame->get_frame_data_size();
+            }
+            catch (...)
+            {
+                next.error = std::current_exception();
+            }
+            bool const last = next.error || next.data->is<device_serializer::serialized_end_of_file>();
+
+            lock.lock();
+            _bytes += next.bytes;
+            _queue.push_back(std::move(next));
+            _data_cv.notify_one();
+            if (last)
+            {
+                _done = true;
+                break;
+            }
+        }
+    }
+
+    void playback_read_ahead::stop(bool rewind)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _space_cv.notify_all();
+        if (_thread.joinable())
+            _thread.join();
+
+        std::deque<item> dropped;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            dropped.swap(_queue);
+            _bytes = 0;
+            _stopping = false;
+            _done = false;
+        }
+
+        _skipping = false;
+        if (rewind && !dropped.empty() && dropped.front().data && !dropped.front().data->is<device_serializer::serialized_end_of_file>())
+        {
+            // Seeking is limited to the duration of the recording, which ends before its last timestamp unless it
+            // starts at 0, so the reader may be sent back a little before the data it is meant to read again
+            auto const time = dropped.front().data->get_timestamp();
+            _reader->seek_to_time(std::min(time, _reader->query_duration()));
+            _skip_time = time;
+            _skip = time == _played_time ? _played : std::set<data_key>();
+            _skipping = true;
+        }
+        else if (!rewind)
+            _played.clear();
+    }
+
+    rs2_playback_read_ahead_stats playback_read_ahead::get_stats() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        rs2_playback_read_ahead_stats stats;
+        stats.queued_frames = int(_queue.size());
+        stats.queued_bytes = _bytes;
+        stats.stalls = _stalls;
+        stats.full = _full;
+        return stats;
+    }
+}
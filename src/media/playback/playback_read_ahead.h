@@ -0,0 +1,87 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../../core/serialization.h"
+#include <librealsense2/h/rs_record_playback.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
+
+namespace librealsense
+{
+    // Reads a playback file ahead of playing it, on a thread of its own, so reading the file, decompressing
+    // it and building frames overlap with playing the frames already read. Data is played in the order it
+    // was read, which is timestamp order.
+    //
+    // Nothing but the read-ahead thread may use the reader while reading ahead: stop() first.
+    class playback_read_ahead
+    {
+    public:
+        // Frames read ahead are held by the reader's frame archive, which holds few (see ros_reader)
+        static const size_t max_frames = 16;
+
+        explicit playback_read_ahead(std::shared_ptr<device_serializer::reader> reader);
+        ~playback_read_ahead();
+
+        // Read ahead up to the number of frames and bytes of frame data (0 for any); 0 frames to read each
+        // frame when it is played
+        // Must be called while stopped.
+        void configure(size_t frames, size_t bytes);
+
+        // The next data in the file; waits for the read-ahead thread, which is started if needed
+        std::shared_ptr<device_serializer::serialized_data> read_next_data();
+
+        // Stop reading ahead, and drop what was read ahead but not played
+        // With rewind, the reader is sent back to the first data dropped so it is read again; what was played
+        // before it is skipped.
+        void stop(bool rewind);
+
+        rs2_playback_read_ahead_stats get_stats() const;
+
+    private:
+        struct item
+        {
+            std::shared_ptr<device_serializer::serialized_data> data;
+            std::exception_ptr error;
+            size_t bytes;
+        };
+
+        // What tells data apart from other data of the same timestamp: its kind, sensor, stream and frame number
+        // (option or notification category for the ones that are not frames)
+        typedef std::tuple<int, uint32_t, uint32_t, int, uint32_t, unsigned long long> data_key;
+        static data_key get_key(const device_serializer::serialized_data& data);
+
+        std::shared_ptr<device_serializer::serialized_data> read_next();
+        void read_ahead();
+
+        std::shared_ptr<device_serializer::reader> _reader;
+        size_t _max_frames;
+        size_t _max_bytes;
+
+        mutable std::mutex _mutex;
+        std::condition_variable _data_cv;    // notified when there's more read ahead
+        std::condition_variable _space_cv;   // notified when there's room to read ahead more
+        std::deque<item> _queue;
+        size_t _bytes;
+        std::thread _thread;
+        bool _stopping;
+        bool _done;                          // the file was read to its end, or failed
+        unsigned long long _stalls;
+        unsigned long long _full;
+
+        // The data of the latest timestamp that was played, and after a rewind, the timestamp to skip until and
+        // the data of that timestamp to skip as well; used by the playing thread only
+        device_serializer::nanoseconds _played_time;
+        std::set<data_key> _played;
+        device_serializer::nanoseconds _skip_time;
+        std::set<data_key> _skip;
+        bool _skipping;
+    };
+}
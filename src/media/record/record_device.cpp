@@ -442,6 +442,10 @@ const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
 }
+rs2_record_write_stats librealsense::record_device::get_write_stats() const
+{
+    return m_ros_writer->get_write_stats();
+}
 platform::backend_device_group record_device::get_device_data() const
 {
     return m_device->get_device_data();
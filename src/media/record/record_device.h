@@ -39,6 +39,7 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        rs2_record_write_stats get_write_stats() const;
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -41,6 +41,72 @@ enum ros_file_versions
 };
 
 
+namespace sensor_msgs
+{
+    // A sensor_msgs/Image read without copying its pixels out of the bag: data points into the
+    // bag's chunk buffer, and is valid only until the bag reads another message
+    struct ImageView
+    {
+        typedef std::shared_ptr<ImageView> Ptr;
+        typedef std::shared_ptr<ImageView const> ConstPtr;
+
+        std_msgs::Header header;
+        uint32_t height = 0;
+        uint32_t width = 0;
+        std::string encoding;
+        uint8_t is_bigendian = 0;
+        uint32_t step = 0;
+        const uint8_t* data = nullptr;
+        uint32_t data_size = 0;
+        float depth_units = 0;
+    };
+}
+
+namespace rs2rosinternal
+{
+    namespace message_traits
+    {
+        template<> struct MD5Sum<sensor_msgs::ImageView>
+        {
+            static const char* value() { return MD5Sum<sensor_msgs::Image>::value(); }
+            static const char* value(const sensor_msgs::ImageView&) { return value(); }
+        };
+
+        template<> struct DataType<sensor_msgs::ImageView>
+        {
+            static const char* value() { return DataType<sensor_msgs::Image>::value(); }
+            static const char* value(const sensor_msgs::ImageView&) { return value(); }
+        };
+
+        template<> struct Definition<sensor_msgs::ImageView>
+        {
+            static const char* value() { return Definition<sensor_msgs::Image>::value(); }
+            static const char* value(const sensor_msgs::ImageView&) { return value(); }
+        };
+    }
+
+    namespace serialization
+    {
+        template<> struct Serializer<sensor_msgs::ImageView>
+        {
+            template<typename Stream> inline static void read(Stream& stream, sensor_msgs::ImageView& m)
+            {
+                stream.next(m.header);
+                stream.next(m.height);
+                stream.next(m.width);
+                stream.next(m.encoding);
+                stream.next(m.is_bigendian);
+                stream.next(m.step);
+                stream.next(m.data_size);
+                m.data = stream.advance(m.data_size);
+                if (!m.header.version.compare("1"))
+                    stream.next(m.depth_units);
+            }
+        };
+    }
+}
+
+
 namespace librealsense
 {
     inline void convert(rs2_format source, std::string& target)
@@ -539,6 +605,15 @@ namespace librealsense
         }
     };
 
+    class FrameMetadataQuery : public RegexTopicQuery
+    {
+    public:
+        FrameMetadataQuery()
+            : RegexTopicQuery( R"RRR(/device_\d+/sensor_\d+/.*_\d+/.*/metadata$)RRR" )
+        {
+        }
+    };
+
     class ExtrinsicsQuery : public RegexTopicQuery
     {
     public:
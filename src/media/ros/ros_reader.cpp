@@ -2,7 +2,10 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 
 #include <cstring>
+#include <algorithm>
 #include "ros_reader.h"
+#include "ros_reader_factory.h"
+#include "environment.h"
 #include "ds/ds-device-common.h"
 #include "ds/d400/d400-private.h"
 #include "ivcam/sr300.h"
@@ -25,6 +28,11 @@ namespace librealsense
 {
     using namespace device_serializer;
 
+    std::shared_ptr<reader> make_ros_reader(const std::string& file, const std::shared_ptr<context>& ctx)
+    {
+        return std::make_shared<ros_reader>(file, ctx);
+    }
+
     ros_reader::ros_reader(const std::string& file, const std::shared_ptr<context>& ctx) :
         m_metadata_parser_map(md_constant_parser::create_metadata_parser_map()),
         m_total_duration(0),
@@ -155,6 +163,13 @@ namespace librealsense
         return m_total_duration;
     }
 
+    void ros_reader::set_chunk_read_ahead(size_t chunks)
+    {
+        // Chunks are decompressed on the library's shared threads
+        auto pool = environment::get_instance().get_task_pool();
+        m_file.setChunkReadAhead(uint32_t(chunks), [pool](std::function<void()> decompress) { pool->submit(std::move(decompress)); });
+    }
+
     void ros_reader::reset()
     {
         m_file.close();
@@ -163,6 +178,7 @@ namespace librealsense
         m_samples_view = nullptr;
         m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
         m_frame_source->init(m_metadata_parser_map);
+        index_frame_metadata();
         m_initial_device_description = read_device_description(get_static_file_info_timestamp(), true);
     }
 
@@ -354,19 +370,49 @@ namespace librealsense
         }
     }
 
-    std::map<std::string, std::string> ros_reader::get_frame_metadata(const rosbag::Bag& bag,
-        const std::string& topic,
-        const device_serializer::stream_identifier& stream_id,
+    void ros_reader::index_frame_metadata()
+    {
+        m_metadata_index.clear();
+        if (m_version == legacy_file_format::file_version())
+            return;
+
+        // Only the bag's index is read here; the messages themselves are read with their frames
+        rosbag::View metadata_view(m_file, FrameMetadataQuery());
+        for (auto&& message_instance : metadata_view)
+            m_metadata_index[message_instance.getTopic()].messages.push_back(message_instance);
+    }
+
+    std::map<std::string, std::string> ros_reader::get_frame_metadata(const std::string& topic,
         const rosbag::MessageInstance &msg,
-        frame_additional_data& additional_data)
+        frame_additional_data& additional_data) const
     {
         uint32_t total_md_size = 0;
         std::map<std::string, std::string> remaining;
-        rosbag::View frame_metadata_view(bag, rosbag::TopicQuery(topic), msg.getTime(), msg.getTime());
 
-        for (auto message_instance : frame_metadata_view)
+        auto it = m_metadata_index.find(topic);
+        if (it == m_metadata_index.end())
         {
-            auto key_val_msg = instantiate_msg<diagnostic_msgs::KeyValue>(message_instance);
+            additional_data.metadata_size = 0;
+            return remaining;
+        }
+        auto& index = it->second;
+        auto const& time = msg.getTime();
+        auto by_time = [](const rosbag::MessageInstance& m, const rs2rosinternal::Time& t) { return m.getTime() < t; };
+
+        // Frames are usually read in order, so the metadata starts where the last frame's ended; after a seek, search for it
+        auto first = index.messages.begin() + std::min(index.cursor, index.messages.size());
+        if (first != index.messages.begin() && (first - 1)->getTime() >= time)
+            first = std::lower_bound(index.messages.begin(), first, time, by_time);
+        else
+            first = std::lower_bound(first, index.messages.end(), time, by_time);
+        auto last = first;
+        while (last != index.messages.end() && last->getTime() == time)
+            ++last;
+        index.cursor = last - index.messages.begin();
+
+        for (auto message_instance = first; message_instance != last; ++message_instance)
+        {
+            auto key_val_msg = instantiate_msg<diagnostic_msgs::KeyValue>(*message_instance);
             if (key_val_msg->key == TIMESTAMP_DOMAIN_MD_STR)
             {
                 if (!safe_convert(key_val_msg->value, additional_data.timestamp_domain))
@@ -414,17 +460,10 @@ namespace librealsense
     frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
-        auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
         frame_additional_data additional_data{};
-        std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
-        additional_data.timestamp = timestamp_ms.count();
-        additional_data.frame_number = msg->header.seq;
         additional_data.fisheye_ae_mode = false;
-        if (msg->depth_units)
-            additional_data.depth_units = msg->depth_units;
-        else
-            additional_data.depth_units = m_legacy_depth_units; // for old rosbag
 
+        // The metadata is read first: the image is read in place, and only until the bag reads another message
         stream_identifier stream_id;
         if (m_version == legacy_file_format::file_version())
         {
@@ -437,11 +476,20 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(image_data.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
+            get_frame_metadata(info_topic, image_data, additional_data);
         }
 
+        auto msg = instantiate_msg<sensor_msgs::ImageView>(image_data);
+        std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
+        additional_data.timestamp = timestamp_ms.count();
+        additional_data.frame_number = msg->header.seq;
+        if (msg->depth_units)
+            additional_data.depth_units = msg->depth_units;
+        else
+            additional_data.depth_units = m_legacy_depth_units; // for old rosbag
+
         frame_interface* frame = m_frame_source->alloc_frame((stream_id.stream_type == RS2_STREAM_DEPTH) ? RS2_EXTENSION_DEPTH_FRAME : RS2_EXTENSION_VIDEO_FRAME,
-            msg->data.size(), additional_data, true);
+            msg->data_size, additional_data, true);
         if (frame == nullptr)
         {
             LOG_WARNING("Failed to allocate new frame");
@@ -456,7 +504,7 @@ namespace librealsense
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
+        std::copy(msg->data, msg->data + msg->data_size, video_frame->data.begin());
         librealsense::frame_holder fh{ video_frame };
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
@@ -487,7 +535,7 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(motion_data.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, motion_data, additional_data);
+            get_frame_metadata(info_topic, motion_data, additional_data);
         }
 
         frame_interface* frame = m_frame_source->alloc_frame(RS2_EXTENSION_MOTION_FRAME, 3 * sizeof(float), additional_data, true);
@@ -610,7 +658,7 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(msg.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            auto remaining = get_frame_metadata(m_file, info_topic, stream_id, msg, additional_data);
+            auto remaining = get_frame_metadata(info_topic, msg, additional_data);
             for (auto&& kvp : remaining)
             {
                 if (kvp.first == MAPPER_CONFIDENCE_MD_STR)
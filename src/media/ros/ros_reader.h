@@ -27,6 +27,7 @@ namespace librealsense
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
+        void set_chunk_read_ahead(size_t chunks) override;
 
     private:
 
@@ -66,11 +67,10 @@ namespace librealsense
             return ret;
         }
 
-        static std::map<std::string, std::string> get_frame_metadata(const rosbag::Bag& bag,
-            const std::string& topic,
-            const device_serializer::stream_identifier& stream_id,
+        std::map<std::string, std::string> get_frame_metadata(const std::string& topic,
             const rosbag::MessageInstance &msg,
-            frame_additional_data& additional_data);
+            frame_additional_data& additional_data) const;
+        void index_frame_metadata();
         frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
@@ -146,6 +146,15 @@ namespace librealsense
         std::vector<std::string>                m_enabled_streams_topics;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
+
+        // The metadata messages of each stream, by topic and in time order, so a frame's metadata is found
+        // without a new view per frame; the cursor is where the last lookup ended, as frames are read in order
+        struct metadata_index
+        {
+            std::vector<rosbag::MessageInstance> messages;
+            size_t cursor = 0;
+        };
+        mutable std::map<std::string, metadata_index> m_metadata_index;
         float                                   m_legacy_depth_units;
     };
 }
@@ -0,0 +1,14 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../../core/serialization.h"
+
+namespace librealsense
+{
+    class context;
+
+    // Opens a recording for reading, without exposing the rosbag headers ros_reader.h depends on
+    std::shared_ptr<device_serializer::reader> make_ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
+}
@@ -11,6 +11,8 @@
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
 #include "ros_writer.h"
+#include "ros_writer_factory.h"
+#include "environment.h"
 #include "l500/l500-motion.h"
 #include "l500/l500-depth.h"
 
@@ -20,13 +22,60 @@ namespace librealsense
 {
     using namespace device_serializer;
 
-    ros_writer::ros_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
+    ros_writer::ros_writer(const std::string& file, bool compress_while_record)
+        : ros_writer(file, compress_while_record ? RS2_RECORD_COMPRESSION_LZ4 : RS2_RECORD_COMPRESSION_NONE, 0)
     {
-        LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
+    }
+
+    std::shared_ptr<writer> make_ros_writer(const std::string& file, rs2_record_compression compression, int level, uint32_t pending_chunks)
+    {
+        return std::make_shared<ros_writer>(file, compression, level, pending_chunks);
+    }
+
+    ros_writer::ros_writer(const std::string& file, rs2_record_compression compression, int level, uint32_t pending_chunks) : m_file_path(file)
+    {
+        // Levels are checked before the file is created
+        switch (compression)
+        {
+        case RS2_RECORD_COMPRESSION_LZ4_HC:
+            if (level < 0 || level > 12)
+                throw invalid_value_exception(rsutils::string::from() << "LZ4-HC compression level " << level << " is out of range [0, 12] (0 for the default, 9)");
+            if (!level)
+                level = 9;
+            break;
+        case RS2_RECORD_COMPRESSION_ZSTD:
+            if (!rosbag::Bag::isCompressionSupported(rosbag::CompressionType::ZSTD))
+                throw not_implemented_exception("Zstandard compression is not supported by this build (see BUILD_WITH_ZSTD)");
+            if (level < 0 || level > 22)
+                throw invalid_value_exception(rsutils::string::from() << "Zstandard compression level " << level << " is out of range [0, 22] (0 for the default, 3)");
+            if (!level)
+                level = 3;
+            break;
+        default:
+            level = 0;  // LZ4 and no compression have no levels
+        }
+        LOG_INFO("Compression while record is set to " << compression << (level ? " level " + std::to_string(level) : ""));
+
         m_bag.open(file, rosbag::BagMode::Write);
-        if (compress_while_record)
+        switch (compression)
         {
+        case RS2_RECORD_COMPRESSION_LZ4:
+        case RS2_RECORD_COMPRESSION_LZ4_HC:
             m_bag.setCompression(rosbag::CompressionType::LZ4);
+            break;
+        case RS2_RECORD_COMPRESSION_ZSTD:
+            m_bag.setCompression(rosbag::CompressionType::ZSTD);
+            break;
+        default:
+            break;
+        }
+        m_bag.setCompressionLevel(level);
+        // Filled chunks are compressed and written on the library's shared threads; recording waits only when
+        // too many are pending, i.e. when the disk does not keep up
+        if (pending_chunks)
+        {
+            auto pool = environment::get_instance().get_task_pool();
+            m_bag.setChunkWriteBehind(pending_chunks, [pool](std::function<void()> write) { pool->submit(std::move(write)); });
         }
         write_file_version();
     }
@@ -83,6 +132,20 @@ namespace librealsense
         return m_file_path;
     }
 
+    rs2_record_write_stats ros_writer::get_write_stats() const
+    {
+        auto bag_stats = m_bag.getWriteStats();
+        rs2_record_write_stats stats;
+        stats.pending_chunks = int(bag_stats.pending_chunks);
+        stats.chunks_written = bag_stats.chunks_written;
+        stats.bytes_in = bag_stats.bytes_in;
+        stats.bytes_written = bag_stats.bytes_out;
+        stats.stalls = bag_stats.stalls;
+        stats.stall_ms = bag_stats.stall_ns / 1e6;
+        stats.write_ms = bag_stats.write_ns / 1e6;
+        return stats;
+    }
+
     void ros_writer::write_file_version()
     {
         std_msgs::UInt32 msg;
@@ -15,12 +15,20 @@ namespace librealsense
     class ros_writer: public writer
     {
     public:
+        // Filled chunks that may wait to be compressed and written. A chunk is filled once past 768KB, so it holds
+        // at least one frame: 8 chunks of 1280x720 RGB frames (2.7MB each) are over 20MB
+        static const uint32_t max_pending_chunks = 8;
+
         explicit ros_writer(const std::string& file, bool compress_while_record);
+        // With no pending chunks, each chunk is compressed and written as it is filled, on the recording thread
+        ros_writer(const std::string& file, rs2_record_compression compression, int level,
+            uint32_t pending_chunks = max_pending_chunks);
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
+        rs2_record_write_stats get_write_stats() const override;
 
     private:
         void write_file_version();
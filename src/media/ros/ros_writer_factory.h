@@ -0,0 +1,15 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../../core/serialization.h"
+#include <librealsense2/h/rs_record_playback.h>
+
+namespace librealsense
+{
+    // Creates a recording, without exposing the rosbag headers ros_writer.h depends on; with no pending chunks,
+    // each chunk is written as it is filled (see ros_writer)
+    std::shared_ptr<device_serializer::writer> make_ros_writer(const std::string& file, rs2_record_compression compression,
+        int level, uint32_t pending_chunks);
+}
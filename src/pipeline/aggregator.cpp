@@ -9,13 +9,21 @@ namespace librealsense
 {
     namespace pipeline
     {
-        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
+        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync,
+                               bool low_latency) :
             processing_block("aggregator"),
-            _queue(new single_consumer_frame_queue<frame_holder>(1)),
             _streams_to_aggregate_ids(streams_to_aggregate),
             _streams_to_sync_ids(streams_to_sync),
-            _accepting(true)
+            _accepting(true),
+            _low_latency(low_latency),
+            _dropped(0)
         {
+            _queue.reset(new single_consumer_frame_queue<frame_holder>(1, [this](frame_holder const &)
+            {
+                if (_accepting)
+                    ++_dropped;
+            }));
+
             auto processing_callback = [&](frame_holder frame, synthetic_source_interface* source)
             {
                 handle_frame(std::move(frame), source);
@@ -77,7 +85,7 @@ namespace librealsense
                 source->frame_ready(async_fref.clone());
 
                 // for sync pipeline usage - push the aggregated to the output queue
-                _queue->enqueue(sync_fref.clone());
+                publish(std::move(sync_fref));
             }
             else
             {
@@ -97,11 +105,20 @@ namespace librealsense
                         return;
                     }
                     // for sync pipeline usage - push the aggregated to the output queue
-                    _queue->enqueue(sync_fref.clone());
+                    publish(std::move(sync_fref));
                 }
             }
         }
 
+        void aggregator::publish(frame_holder frameset)
+        {
+            // The queue holds a single frameset: a newer one pushes out the one the consumer did not take yet,
+            // unless it is blocking, in which case we'd wait for the consumer
+            if (_low_latency)
+                frameset->set_blocking(false);
+            _queue->enqueue(std::move(frameset));
+        }
+
         bool aggregator::dequeue(frame_holder* item, unsigned int timeout_ms)
         {
             return _queue->dequeue(item, timeout_ms);
@@ -19,13 +19,22 @@ namespace librealsense
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
             std::atomic<bool> _accepting;
+            bool _low_latency;
+            std::atomic<unsigned long long> _dropped;
             void handle_frame(frame_holder frame, synthetic_source_interface* source);
+            void publish(frame_holder frameset);
         public:
-            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync);
+            // In low-latency mode, publishing a frameset never blocks the sensor callback: it replaces whatever the
+            // consumer did not yet take, even when the frames were marked as blocking (non-realtime playback)
+            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync,
+                       bool low_latency = false);
             bool dequeue(frame_holder* item, unsigned int timeout_ms);
             bool try_dequeue(frame_holder* item);
             void start();
             void stop();
+
+            // Number of complete framesets replaced before the consumer took them
+            unsigned long long get_dropped_framesets() const { return _dropped; }
         };
     }
 }
@@ -61,6 +61,13 @@ namespace librealsense
             _device_request.record_output = file;
         }
 
+        void config::enable_low_latency(bool enable)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            // Affects only how framesets are handed to the consumer, so a resolved profile remains valid
+            _low_latency = enable;
+        }
+
         std::shared_ptr<profile> config::get_cached_resolved_profile()
         {
             std::lock_guard<std::mutex> lock(_mtx);
@@ -332,5 +339,9 @@ namespace librealsense
         bool config::get_repeat_playback() {
             return _playback_loop;
         }
+
+        bool config::get_low_latency() {
+            return _low_latency;
+        }
     }
 }
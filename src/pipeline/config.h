@@ -24,11 +24,13 @@ namespace librealsense
             void enable_device(const std::string& serial);
             void enable_device_from_file(const std::string& file, bool repeat_playback);
             void enable_record_to_file(const std::string& file);
+            void enable_low_latency(bool enable);
             void disable_stream(rs2_stream stream, int index = -1);
             void disable_all_streams();
             std::shared_ptr<profile> resolve(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout = std::chrono::milliseconds(0));
             bool can_resolve(std::shared_ptr<pipeline> pipe);
             bool get_repeat_playback();
+            bool get_low_latency();
 
             //Non top level API
             std::shared_ptr<profile> get_cached_resolved_profile();
@@ -41,6 +43,7 @@ namespace librealsense
                 _stream_requests = other._stream_requests;
                 _resolved_profile = nullptr;
                 _playback_loop = other._playback_loop;
+                _low_latency = other._low_latency;
             }
         private:
             struct device_request
@@ -61,6 +64,7 @@ namespace librealsense
             bool _enable_all_streams = false;
             std::shared_ptr<profile> _resolved_profile;
             bool _playback_loop = false;
+            bool _low_latency = false;
             std::vector<std::pair<rs2_stream, int>> _streams_to_disable;
         };
     }
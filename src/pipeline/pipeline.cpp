@@ -6,6 +6,7 @@
 #include "stream.h"
 #include "media/record/record_device.h"
 #include "media/ros/ros_writer.h"
+#include "environment.h"
 
 #include <rsutils/string/from.h>
 
@@ -14,11 +15,25 @@ namespace librealsense
 {
     namespace pipeline
     {
+        namespace
+        {
+            // The host time at which the frame was received by the backend; its backend timestamp is on the system
+            // clock, same as the system time, but not all backends provide it
+            rs2_time_t backend_time(frame_header const & h)
+            {
+                if (h.backend_timestamp > 0 && h.backend_timestamp <= h.system_time)
+                    return h.backend_timestamp;
+                return h.system_time;
+            }
+        }
+
         pipeline::pipeline(std::shared_ptr<librealsense::context> ctx) :
             _ctx(ctx),
             _dispatcher(10),
             _hub(ctx, RS2_PRODUCT_LINE_ANY_INTEL),
-            _synced_streams({ RS2_STREAM_COLOR, RS2_STREAM_DEPTH, RS2_STREAM_INFRARED, RS2_STREAM_FISHEYE })
+            _synced_streams({ RS2_STREAM_COLOR, RS2_STREAM_DEPTH, RS2_STREAM_INFRARED, RS2_STREAM_FISHEYE }),
+            _frames_latency(0),
+            _dropped_framesets(0)
         {}
 
         pipeline::~pipeline()
@@ -88,7 +103,7 @@ namespace librealsense
             if (!profile->_multistream.get_profiles().size())
                 throw librealsense::wrong_api_call_sequence_exception("No streams are selected!");
 
-            auto synced_streams_ids = on_start(profile);
+            auto synced_streams_ids = on_start(profile, conf->get_low_latency());
 
             frame_callback_ptr callbacks = get_callback(synced_streams_ids);
 
@@ -170,7 +185,7 @@ namespace librealsense
             return _ctx;
         }
 
-        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile)
+        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile, bool low_latency)
         {
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
@@ -189,7 +204,9 @@ namespace librealsense
             }
 
             _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
-            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids));
+            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids, low_latency));
+            _frames_latency = 0;
+            _dropped_framesets = 0;
 
             if (_streams_callback)
                 _aggregator->set_output_callback(_streams_callback);
@@ -243,6 +260,7 @@ namespace librealsense
             frame_holder f;
             if (_aggregator->dequeue(&f, timeout_ms))
             {
+                on_frames_returned(f);
                 return f;
             }
 
@@ -257,6 +275,7 @@ namespace librealsense
 
                     if (_aggregator->dequeue(&f, timeout_ms))
                     {
+                        on_frames_returned(f);
                         return f;
                     }
 
@@ -285,6 +304,7 @@ namespace librealsense
 
             if (_aggregator->try_dequeue(frame))
             {
+                on_frames_returned(*frame);
                 return true;
             }
             return false;
@@ -304,6 +324,7 @@ namespace librealsense
 
             if (_aggregator->dequeue(frame, timeout_ms))
             {
+                on_frames_returned(*frame);
                 return true;
             }
 
@@ -315,7 +336,10 @@ namespace librealsense
                     auto prev_conf = _prev_conf;
                     unsafe_stop();
                     unsafe_start(prev_conf);
-                    return _aggregator->dequeue(frame, timeout_ms);
+                    if (!_aggregator->dequeue(frame, timeout_ms))
+                        return false;
+                    on_frames_returned(*frame);
+                    return true;
                 }
                 catch (const std::exception& e)
                 {
@@ -325,5 +349,32 @@ namespace librealsense
             }
             return false;
         }
+
+        void pipeline::on_frames_returned(frame_holder const & frames)
+        {
+            auto const now = environment::get_instance().get_time_service()->get_time();
+            auto oldest = now;
+            if (auto comp = dynamic_cast<composite_frame*>(frames.frame))
+            {
+                for (size_t i = 0; i < comp->get_embedded_frames_count(); i++)
+                    if (auto f = comp->get_frame(int(i)))
+                        oldest = std::min(oldest, backend_time(f->get_header()));
+            }
+            else
+                oldest = std::min(oldest, backend_time(frames->get_header()));
+
+            _frames_latency = now - oldest;
+            _dropped_framesets = _aggregator->get_dropped_framesets();
+        }
+
+        rs2_time_t pipeline::get_frames_latency() const
+        {
+            return _frames_latency;
+        }
+
+        unsigned long long pipeline::get_dropped_framesets() const
+        {
+            return _dropped_framesets;
+        }
     }
 }
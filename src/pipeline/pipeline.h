@@ -30,6 +30,12 @@ namespace librealsense
             bool poll_for_frames(frame_holder* frame);
             bool try_wait_for_frames(frame_holder* frame, unsigned int timeout_ms);
 
+            // Describing the frameset last returned by wait_for_frames, poll_for_frames or try_wait_for_frames:
+            // the time, in ms, from the backend timestamp of its oldest frame until it was returned, and the number
+            // of framesets dropped since start() because a newer one replaced them before they were taken
+            rs2_time_t get_frames_latency() const;
+            unsigned long long get_dropped_framesets() const;
+
             //Non top level API
             std::shared_ptr<device_interface> wait_for_device(const std::chrono::milliseconds& timeout = std::chrono::hours::max(),
                 const std::string& serial = "");
@@ -37,7 +43,8 @@ namespace librealsense
 
         protected:
             frame_callback_ptr get_callback(std::vector<int> unique_ids);
-            std::vector<int> on_start(std::shared_ptr<profile> profile);
+            std::vector<int> on_start(std::shared_ptr<profile> profile, bool low_latency);
+            void on_frames_returned(frame_holder const & frames);
 
             void unsafe_start(std::shared_ptr<config> conf);
             void unsafe_stop();
@@ -59,6 +66,9 @@ namespace librealsense
 
             frame_callback_ptr _streams_callback;
             std::vector<rs2_stream> _synced_streams;
+
+            std::atomic<rs2_time_t> _frames_latency;
+            std::atomic<unsigned long long> _dropped_framesets;
         };
     }
 }
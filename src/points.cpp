@@ -2,6 +2,14 @@
 // Copyright(c) 2021 Intel Corporation. All Rights Reserved.
 #include "points.h"
 #include "core/video.h"
+#include "image.h"
+#include "environment.h"
+#include <rsutils/string/from.h>
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <array>
+#include <fstream>
+#include <memory>
 
 #define MIN_DISTANCE 1e-6
 
@@ -9,27 +17,54 @@ namespace librealsense {
 
 float3 * points::get_vertices()
 {
+    if( _vertex_format != RS2_FORMAT_XYZ32F )
+        throw invalid_value_exception( rsutils::string::from() << "vertices are " << get_string( _vertex_format )
+                                                               << ": read them from the frame data" );
     get_frame_data();  // call GetData to ensure data is in main memory
     auto xyz = (float3 *)data.data();
     return xyz;
 }
 
-std::tuple< uint8_t, uint8_t, uint8_t >
-get_texcolor( const frame_holder & texture, float u, float v )
+namespace {
+
+// The colors of a texture frame, looked up by texture coordinates
+class texture_colors
 {
-    auto ptr = dynamic_cast< video_frame * >( texture.frame );
-    if( ptr == nullptr )
+public:
+    explicit texture_colors( const frame_holder & texture )
     {
-        throw librealsense::invalid_value_exception( "frame must be video frame" );
+        auto ptr = dynamic_cast< video_frame * >( texture.frame );
+        if( ptr == nullptr )
+        {
+            throw librealsense::invalid_value_exception( "frame must be video frame" );
+        }
+        _width = ptr->get_width();
+        _height = ptr->get_height();
+        _bpp = ptr->get_bpp();
+        _stride = ptr->get_stride();
+        _data = reinterpret_cast< const uint8_t * >( ptr->get_frame_data() );
     }
-    const int w = ptr->get_width(), h = ptr->get_height();
-    int x = std::min( std::max( int( u * w + .5f ), 0 ), w - 1 );
-    int y = std::min( std::max( int( v * h + .5f ), 0 ), h - 1 );
-    int idx = x * ptr->get_bpp() / 8 + y * ptr->get_stride();
-    const auto texture_data = reinterpret_cast< const uint8_t * >( ptr->get_frame_data() );
-    return std::make_tuple( texture_data[idx], texture_data[idx + 1], texture_data[idx + 2] );
+
+    const uint8_t * get( float u, float v ) const
+    {
+        int x = std::min( std::max( int( u * _width + .5f ), 0 ), _width - 1 );
+        int y = std::min( std::max( int( v * _height + .5f ), 0 ), _height - 1 );
+        return _data + x * _bpp / 8 + y * _stride;
+    }
+
+private:
+    int _width, _height, _bpp, _stride;
+    const uint8_t * _data;
+};
+
+// The bands work is split into: a few per thread, so threads that finish early pick up more
+size_t get_band_count( const worker_pool & workers, size_t count )
+{
+    return std::max( size_t( 1 ), std::min( count, workers.size() * 4 ) );
 }
 
+}  // namespace
+
 
 void points::export_to_ply( const std::string & fname, const frame_holder & texture )
 {
@@ -37,62 +72,109 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
     auto video_stream_profile = dynamic_cast< video_stream_profile_interface * >( stream_profile );
     if( ! video_stream_profile )
         throw librealsense::invalid_value_exception( "stream must be video stream" );
+    if( _mask_pixels )
+        throw invalid_value_exception( "export_to_ply needs a point for every pixel" );
     const auto vertices = get_vertices();
     const auto texcoords = get_texture_coordinates();
-    std::vector< float3 > new_vertices;
-    std::vector< std::tuple< uint8_t, uint8_t, uint8_t > > new_tex;
-    std::map< int, int > index2reducedIndex;
-
-    new_vertices.reserve( get_vertex_count() );
-    new_tex.reserve( get_vertex_count() );
-    assert( get_vertex_count() );
-    for( int i = 0; i < get_vertex_count(); ++i )
-        if( fabs( vertices[i].x ) >= MIN_DISTANCE || fabs( vertices[i].y ) >= MIN_DISTANCE
-            || fabs( vertices[i].z ) >= MIN_DISTANCE )
+    if( texture && ! texcoords )
+        throw invalid_value_exception( "export_to_ply needs texture coordinates to color the points" );
+    std::unique_ptr< texture_colors > colors;
+    if( texture )
+        colors.reset( new texture_colors( texture ) );
+
+    size_t const count = get_vertex_count();
+    assert( count );
+    auto pool = environment::get_instance().get_task_pool();
+    worker_pool workers( pool->size() + 1, pool );
+
+    // The points that are not at the origin, in order: each band counts its own, then writes them after the
+    // ones of the bands before it. 'reduced_index' maps each pixel to its point, or -1.
+    size_t const vertex_size = 3 * sizeof( float ) + ( texture ? 3 : 0 );
+    size_t const bands = get_band_count( workers, count );
+    size_t const band_size = ( count + bands - 1 ) / bands;
+    std::vector< int > reduced_index( count );
+    std::vector< size_t > band_first( bands + 1, 0 );
+    workers.parallel_for( bands, [&]( size_t begin, size_t end ) {
+        for( size_t band = begin; band < end; ++band )
+        {
+            size_t n = 0;
+            for( size_t i = band * band_size; i < std::min( count, ( band + 1 ) * band_size ); ++i )
+            {
+                bool const valid = fabs( vertices[i].x ) >= MIN_DISTANCE || fabs( vertices[i].y ) >= MIN_DISTANCE
+                                || fabs( vertices[i].z ) >= MIN_DISTANCE;
+                reduced_index[i] = valid ? int( n++ ) : -1;
+            }
+            band_first[band + 1] = n;
+        }
+    } );
+    for( size_t band = 0; band < bands; ++band )
+        band_first[band + 1] += band_first[band];
+    size_t const vertex_count = band_first[bands];
+
+    std::vector< char > vertices_body( vertex_count * vertex_size );
+    workers.parallel_for( bands, [&]( size_t begin, size_t end ) {
+        for( size_t band = begin; band < end; ++band )
         {
-            index2reducedIndex[i] = (int)new_vertices.size();
-            new_vertices.push_back( { vertices[i].x, -1 * vertices[i].y, -1 * vertices[i].z } );
-            if( texture )
+            int const first = int( band_first[band] );
+            for( size_t i = band * band_size; i < std::min( count, ( band + 1 ) * band_size ); ++i )
             {
-                auto color = get_texcolor( texture, texcoords[i].x, texcoords[i].y );
-                new_tex.push_back( color );
+                if( reduced_index[i] < 0 )
+                    continue;
+                reduced_index[i] += first;
+                // we assume little endian architecture on your device
+                char * out = vertices_body.data() + reduced_index[i] * vertex_size;
+                float const xyz[] = { vertices[i].x, -1 * vertices[i].y, -1 * vertices[i].z };
+                memcpy( out, xyz, sizeof( xyz ) );
+                if( colors )
+                    memcpy( out + sizeof( xyz ), colors->get( texcoords[i].x, texcoords[i].y ), 3 );
             }
         }
+    } );
 
+    // Two faces per square of close-enough points, in the order of the squares' columns: each band of columns
+    // collects its own
     const auto threshold = 0.05f;
     auto width = video_stream_profile->get_width();
-    std::vector< std::tuple< int, int, int > > faces;
-    for( uint32_t x = 0; x < width - 1; ++x )
-    {
-        for( uint32_t y = 0; y < video_stream_profile->get_height() - 1; ++y )
+    auto height = video_stream_profile->get_height();
+    size_t const columns = width - 1;
+    size_t const face_bands = get_band_count( workers, columns );
+    size_t const face_band_size = ( columns + face_bands - 1 ) / face_bands;
+    std::vector< std::vector< std::array< int, 3 > > > band_faces( face_bands );
+    workers.parallel_for( face_bands, [&]( size_t begin, size_t end ) {
+        for( size_t band = begin; band < end; ++band )
         {
-            auto a = y * width + x, b = y * width + x + 1, c = ( y + 1 ) * width + x,
-                 d = ( y + 1 ) * width + x + 1;
-            if( vertices[a].z && vertices[b].z && vertices[c].z && vertices[d].z
-                && abs( vertices[a].z - vertices[b].z ) < threshold
-                && abs( vertices[a].z - vertices[c].z ) < threshold
-                && abs( vertices[b].z - vertices[d].z ) < threshold
-                && abs( vertices[c].z - vertices[d].z ) < threshold )
+            auto & faces = band_faces[band];
+            for( uint32_t x = uint32_t( band * face_band_size ); x < std::min( columns, ( band + 1 ) * face_band_size ); ++x )
             {
-                if( index2reducedIndex.count( a ) == 0 || index2reducedIndex.count( b ) == 0
-                    || index2reducedIndex.count( c ) == 0 || index2reducedIndex.count( d ) == 0 )
-                    continue;
+                for( uint32_t y = 0; y < height - 1; ++y )
+                {
+                    auto a = y * width + x, b = y * width + x + 1, c = ( y + 1 ) * width + x,
+                         d = ( y + 1 ) * width + x + 1;
+                    if( vertices[a].z && vertices[b].z && vertices[c].z && vertices[d].z
+                        && std::abs( vertices[a].z - vertices[b].z ) < threshold
+                        && std::abs( vertices[a].z - vertices[c].z ) < threshold
+                        && std::abs( vertices[b].z - vertices[d].z ) < threshold
+                        && std::abs( vertices[c].z - vertices[d].z ) < threshold )
+                    {
+                        if( reduced_index[a] < 0 || reduced_index[b] < 0 || reduced_index[c] < 0 || reduced_index[d] < 0 )
+                            continue;
 
-                faces.emplace_back( index2reducedIndex[a],
-                                    index2reducedIndex[d],
-                                    index2reducedIndex[b] );
-                faces.emplace_back( index2reducedIndex[d],
-                                    index2reducedIndex[a],
-                                    index2reducedIndex[c] );
+                        faces.push_back( { reduced_index[a], reduced_index[d], reduced_index[b] } );
+                        faces.push_back( { reduced_index[d], reduced_index[a], reduced_index[c] } );
+                    }
+                }
             }
         }
-    }
+    } );
+    size_t face_count = 0;
+    for( auto & faces : band_faces )
+        face_count += faces.size();
 
     std::ofstream out( fname );
     out << "ply\n";
     out << "format binary_little_endian 1.0\n";
     out << "comment pointcloud saved from Realsense Viewer\n";
-    out << "element vertex " << new_vertices.size() << "\n";
+    out << "element vertex " << vertex_count << "\n";
     out << "property float" << sizeof( float ) * 8 << " x\n";
     out << "property float" << sizeof( float ) * 8 << " y\n";
     out << "property float" << sizeof( float ) * 8 << " z\n";
@@ -102,53 +184,84 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
         out << "property uchar green\n";
         out << "property uchar blue\n";
     }
-    out << "element face " << faces.size() << "\n";
+    out << "element face " << face_count << "\n";
     out << "property list uchar int vertex_indices\n";
     out << "end_header\n";
     out.close();
 
+    // The body goes out in a few large writes
     out.open( fname, std::ios_base::app | std::ios_base::binary );
-    for( int i = 0; i < new_vertices.size(); ++i )
-    {
-        // we assume little endian architecture on your device
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].x ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].y ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].z ) ), sizeof( float ) );
+    out.write( vertices_body.data(), vertices_body.size() );
+    vertices_body = std::vector< char >();
 
-        if( texture )
+    size_t const face_size = 1 + 3 * sizeof( int );
+    std::vector< char > faces_body;
+    for( auto & faces : band_faces )
+    {
+        faces_body.resize( faces.size() * face_size );
+        char * face = faces_body.data();
+        for( auto & f : faces )
         {
-            uint8_t x, y, z;
-            std::tie( x, y, z ) = new_tex[i];
-            out.write( reinterpret_cast< const char * >( &x ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &y ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &z ), sizeof( uint8_t ) );
+            *face = 3;
+            memcpy( face + 1, &f, 3 * sizeof( int ) );
+            face += face_size;
         }
+        out.write( faces_body.data(), faces_body.size() );
     }
-    auto size = faces.size();
-    for( int i = 0; i < size; ++i )
-    {
-        int three = 3;
-        out.write( reinterpret_cast< const char * >( &three ), sizeof( uint8_t ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 0 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 1 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 2 >( faces[i] ) ) ),
-                   sizeof( int ) );
-    }
+    if( ! out )
+        throw io_exception( rsutils::string::from() << "failed to write " << fname );
 }
 
 size_t points::get_vertex_count() const
 {
+    if( _compact )
+        return _count;
     return data.size() / ( sizeof( float3 ) + sizeof( int2 ) );
 }
 
+size_t points::texture_coordinates_offset() const
+{
+    size_t const vertices_size = get_vertex_count() * get_image_bpp( _vertex_format ) / 8;
+    return ( vertices_size + 3 ) & ~size_t( 3 );
+}
+
 float2 * points::get_texture_coordinates()
 {
+    if( ! _texture_coordinates )
+        return nullptr;
     get_frame_data();  // call GetData to ensure data is in main memory
-    auto xyz = (float3 *)data.data();
-    auto ijs = (float2 *)( xyz + get_vertex_count() );
+    auto ijs = (float2 *)( data.data() + texture_coordinates_offset() );
     return ijs;
 }
 
+const uint8_t * points::get_validity_mask()
+{
+    if( ! _mask_pixels )
+        return nullptr;
+    get_frame_data();  // call GetData to ensure data is in main memory
+    size_t offset = texture_coordinates_offset();
+    if( _texture_coordinates )
+        offset += get_vertex_count() * sizeof( float2 );
+    return data.data() + offset;
+}
+
+void points::set_layout( rs2_format vertex_format, size_t count, bool texture_coordinates, size_t mask_pixels )
+{
+    if( get_size( vertex_format, count, texture_coordinates, mask_pixels ) > data.size() )
+        throw invalid_value_exception( "the points frame is too small for its layout" );
+    _vertex_format = vertex_format;
+    _count = count;
+    _texture_coordinates = texture_coordinates;
+    _mask_pixels = mask_pixels;
+    _compact = true;
+}
+
+size_t points::get_size( rs2_format vertex_format, size_t count, bool texture_coordinates, size_t mask_pixels )
+{
+    size_t size = ( count * get_image_bpp( vertex_format ) / 8 + 3 ) & ~size_t( 3 );
+    if( texture_coordinates )
+        size += count * sizeof( float2 );
+    return size + ( mask_pixels + 7 ) / 8;
+}
+
 }  // namespace librealsense
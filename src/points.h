@@ -13,6 +13,22 @@ public:
     void export_to_ply( const std::string & fname, const frame_holder & texture );
     size_t get_vertex_count() const;
     float2 * get_texture_coordinates();
+    const uint8_t * get_validity_mask();
+
+    // By default a frame holds a float3 vertex and a float2 texture coordinate for each of the 'data.size() / 20'
+    // pixels. A compact frame holds 'count' vertices in 'vertex_format', then (if any) their texture coordinates,
+    // 4-byte aligned, then (when only the points with depth are kept) a bitmask of the 'pixels' they come from.
+    void set_layout( rs2_format vertex_format, size_t count, bool texture_coordinates, size_t mask_pixels );
+    static size_t get_size( rs2_format vertex_format, size_t count, bool texture_coordinates, size_t mask_pixels );
+
+private:
+    size_t texture_coordinates_offset() const;
+
+    rs2_format _vertex_format = RS2_FORMAT_XYZ32F;
+    size_t _count = 0;
+    bool _texture_coordinates = true;
+    size_t _mask_pixels = 0;
+    bool _compact = false;
 };
 
 MAP_EXTENSION( RS2_EXTENSION_POINTS, librealsense::points );
@@ -14,10 +14,45 @@ namespace librealsense
 {
     template<int N> struct bytes { byte b[N]; };
 
+    align_ray_cache::align_ray_cache()
+        : _depth_intrin()
+    {}
+
+    bool align_ray_cache::update(const rs2_intrinsics& depth_intrin)
+    {
+        if (!_top_left.empty() && !memcmp(&_depth_intrin, &depth_intrin, sizeof(depth_intrin)))
+            return false;
+
+        _depth_intrin = depth_intrin;
+        auto corner_ray = [&depth_intrin](float x, float y)
+        {
+            float depth_pixel[2] = { x, y }, depth_point[3];
+            rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, 1.f);
+            return float2{ depth_point[0], depth_point[1] };
+        };
+
+        _top_left.resize(size_t(depth_intrin.width) * depth_intrin.height);
+        _bottom_right.resize(_top_left.size());
+        size_t i = 0;
+        for (int y = 0; y < depth_intrin.height; ++y)
+        {
+            for (int x = 0; x < depth_intrin.width; ++x, ++i)
+            {
+                _top_left[i] = corner_ray(x - 0.5f, y - 0.5f);
+                _bottom_right[i] = corner_ray(x + 0.5f, y + 0.5f);
+            }
+        }
+        return true;
+    }
+
     template<class GET_DEPTH, class TRANSFER_PIXEL>
-    void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
+    void align_images(const align_ray_cache& rays, const rs2_extrinsics& depth_to_other,
         const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
     {
+        const auto& depth_intrin = rays.depth_intrinsics();
+        const auto top_left = rays.top_left();
+        const auto bottom_right = rays.bottom_right();
+
         // Iterate over the pixels of the depth image
 #pragma omp parallel for schedule(dynamic)
         for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
@@ -29,16 +64,17 @@ namespace librealsense
                 if (float depth = get_depth(depth_pixel_index))
                 {
                     // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                    // (the same point rs2_deproject_pixel_to_point would give, without undistorting it again)
+                    const auto& ray0 = top_left[depth_pixel_index];
+                    float depth_point[3] = { depth * ray0.x, depth * ray0.y, depth }, other_point[3], other_pixel[2];
                     rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
                     rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
                     const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
                     const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
 
                     // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                    const auto& ray1 = bottom_right[depth_pixel_index];
+                    depth_point[0] = depth * ray1.x; depth_point[1] = depth * ray1.y;
                     rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
                     rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
                     const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
@@ -79,7 +115,8 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
+        _rays.update(z_intrin);
+        align_images(_rays, z_to_other, other_intrin,
             [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
             [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
         {
@@ -90,33 +127,33 @@ namespace librealsense
     }
 
     template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels)
+    void align_other_to_depth_bytes(byte* other_aligned_to_depth, GET_DEPTH get_depth, const align_ray_cache& rays, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels)
     {
         auto in_other = (const bytes<N> *)(other_pixels);
         auto out_other = (bytes<N> *)(other_aligned_to_depth);
-        align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
+        align_images(rays, depth_to_other, other_intrin, get_depth,
             [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
     }
 
     template<class GET_DEPTH>
-    void align_other_to_depth(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels, rs2_format other_format)
+    void align_other_to_depth(byte* other_aligned_to_depth, GET_DEPTH get_depth, const align_ray_cache& rays, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels, rs2_format other_format)
     {
         switch (other_format)
         {
         case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, rays, depth_to_other, other_intrin, other_pixels);
             break;
         case RS2_FORMAT_Y16:
         case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, rays, depth_to_other, other_intrin, other_pixels);
             break;
         case RS2_FORMAT_RGB8:
         case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, rays, depth_to_other, other_intrin, other_pixels);
             break;
         case RS2_FORMAT_RGBA8:
         case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, rays, depth_to_other, other_intrin, other_pixels);
             break;
         default:
             assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
@@ -139,8 +176,9 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto other_pixels = reinterpret_cast<const byte*>(other.get_data());
 
+        _rays.update(z_intrin);
         align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+            _rays, z_to_other, other_intrin, other_pixels, other_profile.format());
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
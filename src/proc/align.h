@@ -12,6 +12,29 @@
 
 namespace librealsense
 {
+    // Rays through the top-left and bottom-right corners of every depth pixel, as (x, y) at a depth of 1: the
+    // point a depth pixel deprojects to at depth z is then z * (x, y, 1), which saves undistorting (iteratively,
+    // for Brown-Conrady) both corners of every pixel on every frame. The table is keyed on the intrinsics it was
+    // computed from and rebuilt when they change; the extrinsics are applied per frame, so updates to them (e.g.
+    // by thermal compensation) take effect immediately.
+    class align_ray_cache
+    {
+    public:
+        align_ray_cache();
+
+        // Returns true when the table had to be rebuilt
+        bool update(const rs2_intrinsics& depth_intrin);
+
+        const rs2_intrinsics& depth_intrinsics() const { return _depth_intrin; }
+        const float2* top_left() const { return _top_left.data(); }
+        const float2* bottom_right() const { return _bottom_right.data(); }
+
+    private:
+        rs2_intrinsics _depth_intrin;
+        std::vector<float2> _top_left;
+        std::vector<float2> _bottom_right;
+    };
+
     class LRS_EXTENSION_API align : public generic_processing_block
     {
     public:
@@ -48,6 +71,7 @@ namespace librealsense
         std::map<std::pair<stream_profile_interface*, stream_profile_interface*>, std::shared_ptr<rs2::video_stream_profile>> _align_stream_unique_ids;
         rs2::stream_profile _source_stream_profile;
         float _depth_scale;
+        align_ray_cache _rays;
 
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
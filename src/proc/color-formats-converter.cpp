@@ -6,6 +6,7 @@
 #include "option.h"
 #include "image-avx.h"
 #include "image.h"
+#include "mjpeg-decoder.h"
 
 #define STB_IMAGE_STATIC
 #define STB_IMAGE_IMPLEMENTATION
@@ -21,17 +22,27 @@
 #if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__)) || (defined (__APPLE__) && !defined (__x86_64__))
 
 bool has_avx() { return false; }
+bool has_sse41() { return false; }
+bool has_avx2() { return false; }
+bool has_avx512() { return false; }
 
 #else
 
 #ifdef _WIN32
 #include <intrin.h>
+#include <immintrin.h>
 #define cpuid(info, x)    __cpuidex(info, x, 0)
+#define xgetbv(x)         _xgetbv(x)
 #else
 #include <cpuid.h>
 void cpuid(int info[4], int info_type) {
     __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
 }
+unsigned long long xgetbv(unsigned int index) {
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return ((unsigned long long)edx << 32) | eax;
+}
 #endif
 
 bool has_avx()
@@ -42,6 +53,41 @@ bool has_avx()
     return (info[2] & ((int)1 << 28)) != 0;
 }
 
+bool has_sse41()
+{
+    int info[4];
+    cpuid(info, 1);
+    return (info[2] & ((int)1 << 19)) != 0;
+}
+
+bool has_avx2()
+{
+    int info[4];
+    cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    // The OS must also save the AVX (YMM) registers on context switches
+    cpuid(info, 1);
+    if ((info[2] & ((int)1 << 27)) == 0 || (info[2] & ((int)1 << 28)) == 0)
+        return false;
+    if ((xgetbv(0) & 6) != 6)
+        return false;
+    cpuid(info, 7);
+    return (info[1] & ((int)1 << 5)) != 0;
+}
+
+bool has_avx512()
+{
+    if (!has_avx2())
+        return false;
+    // AVX-512F and AVX-512CD, with the OS saving the opmask and ZMM registers too
+    if ((xgetbv(0) & 0xE6) != 0xE6)
+        return false;
+    int info[4];
+    cpuid(info, 7);
+    return (info[1] & ((int)1 << 16)) != 0 && (info[1] & ((int)1 << 28)) != 0;
+}
+
 #endif
 
 namespace librealsense 
@@ -78,7 +124,6 @@ namespace librealsense
             auto src = reinterpret_cast<const __m128i *>(s);
             auto dst = reinterpret_cast<__m128i *>(d[0]);
 
-#pragma omp parallel for
             for (int i = 0; i < n / 16; i++)
             {
                 const __m128i zero = _mm_set1_epi8(0);
@@ -686,14 +731,39 @@ namespace librealsense
         unpack_yuy2(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    bool yuy2_converter::converts_rows_independently() const
+    {
+#ifdef RS2_USE_CUDA
+        return false;  // the whole frame is handed to the GPU at once
+#else
+        return true;
+#endif
+    }
+
     void uyvy_converter::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
     {
         unpack_uyvyc(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    mjpeg_converter::mjpeg_converter(const char* name, rs2_format target_format) :
+        color_converter(name, target_format), _processing_threads(1)
+    {
+#ifdef RS2_USE_LIBJPEG_TURBO
+        // Only images that have restart markers are split
+        register_processing_threads_option(&_processing_threads);
+#endif
+    }
+
     void mjpeg_converter::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
     {
+#ifdef RS2_USE_LIBJPEG_TURBO
+        _workers.resize(_processing_threads);
+        auto jpeg_size = input_size > 0 ? input_size : actual_size;
+        if (!decode_mjpeg(source, jpeg_size, _target_format, dest[0], width, height, _workers))
+            LOG_ERROR("jpeg decode failed");
+#else
         unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+#endif
     }
 
     void bgr_to_rgb::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
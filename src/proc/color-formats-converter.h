@@ -5,6 +5,13 @@
 
 #include "synthetic-stream.h"
 
+#include <rsutils/concurrency/worker-pool.h>
+
+// Instruction sets supported by the CPU we run on
+bool has_sse41();
+bool has_avx2();
+bool has_avx512();  // AVX-512F and AVX-512CD
+
 namespace librealsense
 {
     class LRS_EXTENSION_API color_converter : public functional_processing_block
@@ -24,6 +31,7 @@ namespace librealsense
         yuy2_converter(const char* name, rs2_format target_format) :
             color_converter(name, target_format) {};
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+        bool converts_rows_independently() const override;
     };
 
     class LRS_EXTENSION_API uyvy_converter : public color_converter
@@ -36,6 +44,7 @@ namespace librealsense
         uyvy_converter(const char* name, rs2_format target_format, rs2_stream target_stream) :
             color_converter(name, target_format, target_stream) {};
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+        bool converts_rows_independently() const override { return true; }
     };
 
     class LRS_EXTENSION_API mjpeg_converter : public color_converter
@@ -45,9 +54,11 @@ namespace librealsense
             mjpeg_converter("MJPEG Converter", target_format) {};
 
     protected:
-        mjpeg_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+        mjpeg_converter(const char* name, rs2_format target_format);
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+
+    private:
+        int _processing_threads;
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
@@ -60,5 +71,6 @@ namespace librealsense
         bgr_to_rgb(const char* name) :
             color_converter(name, RS2_FORMAT_RGB8, RS2_STREAM_INFRARED) {};
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+        bool converts_rows_independently() const override { return true; }
     };
 }
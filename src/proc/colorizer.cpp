@@ -10,6 +10,8 @@
 #include "option.h"
 #include "colorizer.h"
 #include "disparity-transform.h"
+#include "color-formats-converter.h"
+#include "sse/sse-colorizer.h"
 
 namespace librealsense
 {
@@ -134,6 +136,7 @@ namespace librealsense
         { 0, 0, 0 },
         } };
 
+
     colorizer::colorizer()
         : colorizer("Depth Visualization")
     {}
@@ -141,7 +144,9 @@ namespace librealsense
     colorizer::colorizer(const char* name)
         : stream_filter_processing_block(name),
          _min(0.f), _max(6.f), _equalize(true), 
-         _target_stream_profile(), _histogram()
+         _target_stream_profile(), _histogram(),
+         _processing_threads(1),
+         _workers(1, environment::get_instance().get_task_pool())
     {
         _histogram = std::vector<int>(MAX_DEPTH, 0);
         _hist_data = _histogram.data();
@@ -238,6 +243,69 @@ namespace librealsense
         register_option(RS2_OPTION_VISUAL_PRESET, preset_opt);
 
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
+
+        register_processing_threads_option(&_processing_threads);
+    }
+
+    void colorizer::update_histogram_z16(const uint16_t* depth_data, int w, int h)
+    {
+        auto parts = _workers.size();
+        if (parts == 1)
+            return update_histogram(_hist_data, depth_data, w, h);
+
+        // Each thread counts a part of the frame in its own histogram, then each thread adds up a range of bins
+        auto pixels = size_t(w) * h;
+        _sub_histograms.resize(parts);
+        _workers.parallel_for(parts, [&](size_t begin, size_t end)
+        {
+            for (auto p = begin; p < end; ++p)
+            {
+                auto& sub = _sub_histograms[p];
+                sub.assign(MAX_DEPTH, 0);
+                auto sub_data = sub.data();
+                for (auto i = pixels * p / parts; i < pixels * (p + 1) / parts; ++i)
+                    sub_data[depth_data[i]] += 1;
+            }
+        });
+        _workers.parallel_for(MAX_DEPTH, [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                int sum = 0;
+                for (auto& sub : _sub_histograms)
+                    sum += sub[i];
+                _hist_data[i] = sum;
+            }
+        }, min_bins_per_band);
+
+        for (auto i = 2; i < MAX_DEPTH; ++i) _hist_data[i] += _hist_data[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
+    }
+
+    void colorizer::make_rgb_data_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        static const bool avx2 = z16_rgb_lookup_avx2_built && has_avx2();
+        static const bool sse41 = z16_rgb_lookup_sse41_built && has_sse41();
+
+        auto lut = _rgb_lut.data();
+        _workers.parallel_for(size_t(width) * height, [&](size_t begin, size_t end)
+        {
+            auto depth = depth_data + begin;
+            auto rgb = rgb_data + begin * 3;
+            size_t count = end - begin;
+
+            size_t i = 0;
+            if (avx2)
+                i = z16_rgb_lookup_avx2(depth, lut, rgb, count);
+            else if (sse41)
+                i = z16_rgb_lookup_sse41(depth, lut, rgb, count);
+            for (; i < count; ++i)
+            {
+                auto c = lut[depth[i]];
+                rgb[i * 3 + 0] = (uint8_t)c;
+                rgb[i * 3 + 1] = (uint8_t)(c >> 8);
+                rgb[i * 3 + 2] = (uint8_t)(c >> 16);
+            }
+        }, min_pixels_per_band);
     }
 
     bool colorizer::should_process(const rs2::frame& frame)
@@ -286,8 +354,10 @@ namespace librealsense
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_histogram_z16(depth_data, w, h);
+                update_rgb_lut(coloring_function, true);
+                _rgb_lut_cropped = false;
+                make_rgb_data_z16(depth_data, rgb_data, w, h);
             }
         };
 
@@ -320,11 +390,22 @@ namespace librealsense
                     if (min >= max) return 0.f;
                     return (data * _depth_units - min) / (max - min);
                 };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                if (!_rgb_lut_cropped || _rgb_lut_min != min || _rgb_lut_max != max
+                    || _rgb_lut_depth_units != _depth_units || _rgb_lut_map_index != _map_index)
+                {
+                    update_rgb_lut(coloring_function, false);
+                    _rgb_lut_cropped = true;
+                    _rgb_lut_min = min;
+                    _rgb_lut_max = max;
+                    _rgb_lut_depth_units = _depth_units;
+                    _rgb_lut_map_index = _map_index;
+                }
+                make_rgb_data_z16(depth_data, rgb_data, w, h);
             }
         };
 
         rs2::frame ret;
+        _workers.resize(_processing_threads);
 
         auto vf = f.as<rs2::video_frame>();
         ret = source.allocate_video_frame(_target_stream_profile, f, 3, vf.get_width(), vf.get_height(), vf.get_width() * 3, RS2_EXTENSION_VIDEO_FRAME);
@@ -6,6 +6,8 @@
 #include <map>
 #include <vector>
 
+#include <rsutils/concurrency/worker-pool.h>
+
 namespace rs2
 {
     class stream_profile;
@@ -153,6 +155,48 @@ namespace librealsense {
             }
         }
 
+        template<typename F>
+        static uint32_t pack_pixel_color(color_map* cm, uint16_t data, F coloring_func)
+        {
+            if (!data)
+                return 0;
+            auto c = cm->get(coloring_func(data));
+            return uint32_t((uint8_t)c.x) | uint32_t((uint8_t)c.y) << 8 | uint32_t((uint8_t)c.z) << 16;
+        }
+
+        // Z16 frames are colored through _rgb_lut, which holds the color of each depth value as
+        // colorize_pixel() would compute it. It is only rebuilt when the options change, or, with histogram
+        // equalization, for the depth values present in each frame.
+        //
+        // With equalization the LUT is not updated from the previous frame's: the color of a depth value comes
+        // from the cumulative histogram, which moves for every depth value above one whose count changed, so
+        // nearly every present value gets a new color each frame anyway. Telling which values are present takes
+        // a look at each bin, and this is split between the workers with the rest.
+        template<typename F>
+        void update_rgb_lut(F coloring_func, bool present_only)
+        {
+            _rgb_lut.resize(MAX_DEPTH);
+            auto cm = _maps[_map_index];
+            auto lut = _rgb_lut.data();
+            lut[0] = 0;
+            _workers.parallel_for(MAX_DEPTH - 1, [&](size_t begin, size_t end)
+            {
+                for (auto i = int(begin) + 1; i <= int(end); ++i)
+                {
+                    // The cumulative histogram starts at 1: depth 0 (no data) is not counted in
+                    if (!present_only || _hist_data[i] != (i > 1 ? _hist_data[i - 1] : 0))
+                        lut[i] = pack_pixel_color(cm, static_cast<uint16_t>(i), coloring_func);
+                }
+            }, min_bins_per_band);
+        }
+
+        void update_histogram_z16(const uint16_t* depth_data, int w, int h);
+        void make_rgb_data_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
+        // Bands smaller than these cost more to hand over than they save
+        static const size_t min_bins_per_band = 0x1000;
+        static const size_t min_pixels_per_band = 0x4000;
+
         float _min, _max;
         bool _equalize;
 
@@ -168,5 +212,16 @@ namespace librealsense {
 
         float   _depth_units = 0.f;
         float   _d2d_convert_factor = 0.f;
+
+        std::vector<uint32_t> _rgb_lut;                  // 0x00BBGGRR per depth value
+        std::vector<std::vector<int>> _sub_histograms;   // One per thread
+        bool    _rgb_lut_cropped = false;                // _rgb_lut is for the settings below, without equalization
+        float   _rgb_lut_min = 0.f;
+        float   _rgb_lut_max = 0.f;
+        float   _rgb_lut_depth_units = 0.f;
+        int     _rgb_lut_map_index = 0;
+
+        int         _processing_threads;
+        worker_pool _workers;
     };
 }
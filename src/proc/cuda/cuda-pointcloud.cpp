@@ -10,17 +10,18 @@ namespace librealsense
 {
     pointcloud_cuda::pointcloud_cuda() : pointcloud("Pointcloud (CUDA)") {}
 
-    const float3 * pointcloud_cuda::depth_to_points(
-        rs2::points output,
+    void pointcloud_cuda::deproject_rows(float3* points,
         const rs2_intrinsics &depth_intrinsics,
-        const rs2::depth_frame& depth_frame)
+        const rs2::depth_frame& depth_frame, int first_row, int rows)
     {
-        auto image = output.get_vertices();
-        auto depth_data = (uint16_t*)depth_frame.get_data();
+        // The rows are an image of their own, with the principal point as far above them as they are down
+        auto band = depth_intrinsics;
+        band.ppy -= first_row;
+        band.height = rows;
+        auto depth_data = (uint16_t*)depth_frame.get_data() + size_t(first_row) * depth_intrinsics.width;
         auto depth_scale = depth_frame.get_units();
 #ifdef RS2_USE_CUDA
-        rscuda::deproject_depth_cuda((float*)image, depth_intrinsics, depth_data, depth_scale);
+        rscuda::deproject_depth_cuda((float*)points, band, depth_data, depth_scale);
 #endif
-        return (float3*)image;
     }
 }
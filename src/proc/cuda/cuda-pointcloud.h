@@ -11,9 +11,7 @@ namespace librealsense
     public:
         pointcloud_cuda();
     private:
-        const float3 * depth_to_points(
-            rs2::points output,
-            const rs2_intrinsics &depth_intrinsics,
-            const rs2::depth_frame& depth_frame) override;
+        void deproject_rows(float3* points, const rs2_intrinsics& depth_intrinsics,
+            const rs2::depth_frame& depth_frame, int first_row, int rows) override;
     };
 }
@@ -7,6 +7,8 @@
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
 
+#include <rsutils/concurrency/worker-pool.h>
+
 namespace librealsense
 {
 
@@ -23,6 +25,16 @@ namespace librealsense
 
         void decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
+
+        // Output rows [row_begin, row_end), starting at frame_data_out (and frame_data_in for depth)
+        void decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t scale, size_t row_begin, size_t row_end);
+        void decimate_others_rows(rs2_format format, const void * frame_data_in, void * frame_data_out,
+            size_t width_in, size_t scale, size_t row_begin, size_t row_end);
+
+        // Bands smaller than this cost more to hand over than they save
+        static const size_t min_rows_per_band = 8;
+
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
@@ -41,6 +53,8 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        int                     _processing_threads;
+        worker_pool             _workers;
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
@@ -22,6 +22,7 @@ namespace librealsense
         _width(0), _height(0), _bpp(0)
     {
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        unregister_option(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK);
 
         on_set_mode(_transform_to_disparity);
     }
@@ -0,0 +1,248 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <csetjmp>
+#include <cstdio>  // jpeglib.h needs FILE
+#include <vector>
+
+#include <jpeglib.h>
+
+#ifndef JCS_EXTENSIONS
+#error "BUILD_WITH_LIBJPEG_TURBO requires the libjpeg-turbo flavor of jpeglib.h"
+#endif
+
+
+namespace librealsense
+{
+    namespace
+    {
+        // libjpeg reports errors through a callback that must not return
+        struct jpeg_error_handler
+        {
+            jpeg_error_mgr mgr;
+            std::jmp_buf jump;
+        };
+
+        void on_jpeg_error( j_common_ptr cinfo )
+        {
+            std::longjmp( reinterpret_cast< jpeg_error_handler * >( cinfo->err )->jump, 1 );
+        }
+
+        void on_jpeg_message( j_common_ptr ) {}
+
+        bool output_color_space( rs2_format format, J_COLOR_SPACE & space, int & bytes_per_pixel )
+        {
+            switch( format )
+            {
+            case RS2_FORMAT_RGB8: space = JCS_EXT_RGB; bytes_per_pixel = 3; return true;
+            case RS2_FORMAT_BGR8: space = JCS_EXT_BGR; bytes_per_pixel = 3; return true;
+            case RS2_FORMAT_RGBA8: space = JCS_EXT_RGBA; bytes_per_pixel = 4; return true;
+            case RS2_FORMAT_BGRA8: space = JCS_EXT_BGRA; bytes_per_pixel = 4; return true;
+            case RS2_FORMAT_Y8: space = JCS_GRAYSCALE; bytes_per_pixel = 1; return true;
+            default: return false;
+            }
+        }
+
+        // Decodes a complete JPEG image of exactly width x height pixels into rows 'stride' bytes apart.
+        // Nothing with a destructor may live here: errors longjmp out.
+        bool decode( uint8_t const * jpeg, size_t size, J_COLOR_SPACE space, uint8_t * dest, size_t stride,
+                     int width, int height )
+        {
+            jpeg_decompress_struct cinfo;
+            jpeg_error_handler errors;
+            cinfo.err = jpeg_std_error( &errors.mgr );
+            errors.mgr.error_exit = on_jpeg_error;
+            errors.mgr.output_message = on_jpeg_message;
+            if( setjmp( errors.jump ) )
+            {
+                jpeg_destroy_decompress( &cinfo );
+                return false;
+            }
+
+            jpeg_create_decompress( &cinfo );
+            jpeg_mem_src( &cinfo, const_cast< unsigned char * >( jpeg ), static_cast< unsigned long >( size ) );
+            jpeg_read_header( &cinfo, TRUE );
+            cinfo.out_color_space = space;
+            jpeg_start_decompress( &cinfo );
+
+            bool const ok = int( cinfo.output_width ) == width && int( cinfo.output_height ) == height;
+            if( ok )
+            {
+                while( cinfo.output_scanline < cinfo.output_height )
+                {
+                    JSAMPROW row = dest + cinfo.output_scanline * stride;
+                    jpeg_read_scanlines( &cinfo, &row, 1 );
+                }
+                jpeg_finish_decompress( &cinfo );
+            }
+            jpeg_destroy_decompress( &cinfo );
+            return ok;
+        }
+
+        inline int read_be16( uint8_t const * p ) { return ( p[0] << 8 ) | p[1]; }
+
+        // Where the restart intervals of a baseline image are, when each holds whole MCU rows
+        struct restart_layout
+        {
+            size_t header_size = 0;       // SOI up to the end of SOS
+            size_t height_offset = 0;     // of the image height in the SOF segment
+            int mcu_rows_per_interval = 0;
+            int mcu_height = 0;
+            std::vector< size_t > begins; // of each interval's entropy-coded data
+            std::vector< size_t > ends;
+        };
+
+        bool find_restart_intervals( uint8_t const * jpeg, size_t size, restart_layout & layout )
+        {
+            if( size < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8 )
+                return false;
+
+            int width = 0, height = 0, components = 0, h_max = 1, v_max = 1, v_min = 4, restart_interval = 0;
+            bool frame = false;
+            size_t i = 2;
+            for( ;; )
+            {
+                while( i + 1 < size && jpeg[i] == 0xFF && jpeg[i + 1] == 0xFF )
+                    ++i;  // fill bytes
+                if( i + 4 > size || jpeg[i] != 0xFF )
+                    return false;
+                uint8_t const marker = jpeg[i + 1];
+                size_t const length = read_be16( jpeg + i + 2 );
+                if( i + 2 + length > size )
+                    return false;
+                uint8_t const * segment = jpeg + i + 4;
+
+                if( marker == 0xC0 || marker == 0xC1 )  // baseline or extended sequential
+                {
+                    if( length < 8 )
+                        return false;
+                    layout.height_offset = i + 5;
+                    height = read_be16( segment + 1 );
+                    width = read_be16( segment + 3 );
+                    components = segment[5];
+                    if( length < size_t( 8 + 3 * components ) )
+                        return false;
+                    for( int c = 0; c < components; ++c )
+                    {
+                        int const h = segment[7 + 3 * c] >> 4, v = segment[7 + 3 * c] & 0xF;
+                        h_max = std::max( h_max, h );
+                        v_max = std::max( v_max, v );
+                        v_min = std::min( v_min, v );
+                    }
+                    if( components == 1 )
+                        h_max = v_max = v_min = 1;  // a single component is not interleaved: 8x8 MCUs
+                    frame = true;
+                }
+                else if( ( marker & 0xF0 ) == 0xC0 && marker != 0xC4 && marker != 0xC8 && marker != 0xCC )
+                    return false;  // progressive, lossless, arithmetic coding...
+                else if( marker == 0xDD && length >= 4 )
+                    restart_interval = read_be16( segment );
+                else if( marker == 0xDA )
+                {
+                    if( segment[0] != components )
+                        return false;  // one scan per component
+                    layout.header_size = i + 2 + length;
+                    break;
+                }
+                i += 2 + length;
+            }
+
+            // Vertical chroma upsampling smooths across rows, and so across bands
+            if( ! frame || ! restart_interval || width <= 0 || height <= 0 || v_min != v_max )
+                return false;
+            int const mcus_per_row = ( width + 8 * h_max - 1 ) / ( 8 * h_max );
+            if( restart_interval % mcus_per_row )
+                return false;
+            layout.mcu_rows_per_interval = restart_interval / mcus_per_row;
+            layout.mcu_height = 8 * v_max;
+
+            layout.begins.push_back( layout.header_size );
+            for( size_t j = layout.header_size; j + 1 < size; )
+            {
+                if( jpeg[j] != 0xFF )
+                {
+                    ++j;
+                    continue;
+                }
+                uint8_t const next = jpeg[j + 1];
+                if( next == 0x00 || next == 0xFF )  // stuffed byte, or fill
+                    j += next ? 1 : 2;
+                else if( next >= 0xD0 && next <= 0xD7 )
+                {
+                    layout.ends.push_back( j );
+                    j += 2;
+                    layout.begins.push_back( j );
+                }
+                else
+                {
+                    if( next != 0xD9 )
+                        return false;  // more scans follow
+                    layout.ends.push_back( j );
+                    break;
+                }
+            }
+            if( layout.ends.size() != layout.begins.size() )
+                return false;
+
+            int const rows_per_interval = layout.mcu_rows_per_interval * layout.mcu_height;
+            return layout.begins.size() == size_t( ( height + rows_per_interval - 1 ) / rows_per_interval );
+        }
+
+        // A standalone image of intervals [first, last): the headers with the band's height, and the intervals
+        // with their restart markers renumbered from 0
+        void make_band_image( uint8_t const * jpeg, restart_layout const & layout, size_t first, size_t last,
+                              int band_height, std::vector< uint8_t > & image )
+        {
+            image.assign( jpeg, jpeg + layout.header_size );
+            image[layout.height_offset] = uint8_t( band_height >> 8 );
+            image[layout.height_offset + 1] = uint8_t( band_height );
+            for( size_t k = first; k < last; ++k )
+            {
+                if( k > first )
+                {
+                    image.push_back( 0xFF );
+                    image.push_back( uint8_t( 0xD0 + ( k - first - 1 ) % 8 ) );
+                }
+                image.insert( image.end(), jpeg + layout.begins[k], jpeg + layout.ends[k] );
+            }
+            image.push_back( 0xFF );
+            image.push_back( 0xD9 );
+        }
+    }
+
+    bool decode_mjpeg( uint8_t const * jpeg, size_t size, rs2_format format, uint8_t * dest, int width, int height,
+                       worker_pool & workers )
+    {
+        J_COLOR_SPACE space;
+        int bytes_per_pixel;
+        if( ! output_color_space( format, space, bytes_per_pixel ) )
+            return false;
+        size_t const stride = size_t( width ) * bytes_per_pixel;
+
+        restart_layout layout;
+        if( workers.size() == 1 || ! find_restart_intervals( jpeg, size, layout ) || layout.begins.size() < 2 )
+            return decode( jpeg, size, space, dest, stride, width, height );
+
+        int const rows_per_interval = layout.mcu_rows_per_interval * layout.mcu_height;
+        std::atomic< bool > ok( true );
+        workers.parallel_for( layout.begins.size(), [&]( size_t first, size_t last ) {
+            int const top = int( first ) * rows_per_interval;
+            int const bottom = std::min( height, int( last ) * rows_per_interval );
+            std::vector< uint8_t > image;
+            make_band_image( jpeg, layout, first, last, bottom - top, image );
+            if( ! decode( image.data(), image.size(), space, dest + top * stride, stride, width, bottom - top ) )
+                ok = false;
+        } );
+        return ok;
+    }
+}
+
+#endif // RS2_USE_LIBJPEG_TURBO
@@ -0,0 +1,30 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+
+class worker_pool;
+
+namespace librealsense
+{
+    // MJPEG decoding with libjpeg-turbo, when built with BUILD_WITH_LIBJPEG_TURBO.
+    //
+    // Decodes 'jpeg' straight into 'dest', a width x height image in RS2_FORMAT_RGB8, BGR8, RGBA8, BGRA8 or Y8.
+    // When the image has restart markers at MCU row boundaries (and no vertical chroma subsampling, whose
+    // smoothing crosses rows), bands of restart intervals are decoded by separate threads of 'workers', with
+    // the same output as a single-threaded decode.
+    //
+    // Returns false (and leaves 'dest' in an undefined state) when the image is corrupt, is not of the expected
+    // size, or the format is not supported.
+    bool decode_mjpeg( uint8_t const * jpeg, size_t size, rs2_format format, uint8_t * dest, int width, int height,
+                       worker_pool & workers );
+}
+
+#endif // RS2_USE_LIBJPEG_TURBO
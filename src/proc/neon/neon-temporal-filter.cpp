@@ -0,0 +1,107 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "../temporal-filter-simd.h"
+
+#if defined( RS2_USE_NEON_TEMPORAL_FILTER ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+
+#include "../temporal-filter-kernels.h"
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        struct neon
+        {
+            struct constants
+            {
+                int16x4_t alpha;
+                int32x4_t bias;
+                uint16x8_t delta_z, lane_bits;
+                bool full_weight;  // alpha == 1, which does not fit the 16-bit multiplier
+
+                explicit constants( z16_temporal_smoothing const & ts )
+                    : alpha( vdup_n_s16( int16_t( ts.alpha & 0x7fff ) ) )
+                    , bias( vdupq_n_s32( TEMPORAL_BLEND_BIAS ) )
+                    , delta_z( vdupq_n_u16( ts.delta_z ) )
+                    , full_weight( ts.alpha >= 32768 )
+                {
+                    static const uint16_t bits[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+                    lane_bits = vld1q_u16( bits );
+                }
+            };
+
+            // 8 lane masks -> 8 bits
+            static uint32_t to_bits( uint16x8_t m, constants const & k )
+            {
+                uint64x2_t sum = vpaddlq_u32( vpaddlq_u16( vandq_u16( m, k.lane_bits ) ) );
+                return uint32_t( vgetq_lane_u64( sum, 0 ) + vgetq_lane_u64( sum, 1 ) );
+            }
+
+            static group_masks smooth( uint16_t * frame, uint16_t * last_frame, constants const & k )
+            {
+                group_masks m = {};
+                for( int j = 0; j < 4; ++j )
+                {
+                    uint16x8_t cur = vld1q_u16( frame + 8 * j );
+                    uint16x8_t prev = vld1q_u16( last_frame + 8 * j );
+
+                    uint16x8_t valid = vtstq_u16( cur, cur );
+                    uint16x8_t last_valid = vtstq_u16( prev, prev );
+                    uint16x8_t close = vcltq_u16( vabdq_u16( cur, prev ), k.delta_z );
+                    uint16x8_t agree = vandq_u16( vandq_u16( valid, last_valid ), close );
+
+                    // prev + alpha * (cur - prev)
+                    uint16x8_t filtered = cur;
+                    if( ! k.full_weight )
+                    {
+                        int16x8_t diff = vreinterpretq_s16_u16( vsubq_u16( cur, prev ) );
+                        int32x4_t lo = vmlal_s16( k.bias, vget_low_s16( diff ), k.alpha );
+                        int32x4_t hi = vmlal_s16( k.bias, vget_high_s16( diff ), k.alpha );
+                        int16x8_t step = vcombine_s16( vshrn_n_s32( lo, 15 ), vshrn_n_s32( hi, 15 ) );
+                        filtered = vaddq_u16( prev, vreinterpretq_u16_s16( step ) );
+                    }
+
+                    vst1q_u16( frame + 8 * j, vbslq_u16( agree, filtered, cur ) );
+                    vst1q_u16( last_frame + 8 * j, vbslq_u16( agree, filtered, vbslq_u16( valid, cur, prev ) ) );
+
+                    m.valid |= to_bits( valid, k ) << ( 8 * j );
+                    m.agree |= to_bits( agree, k ) << ( 8 * j );
+                    m.last_valid |= to_bits( last_valid, k ) << ( 8 * j );
+                }
+                return m;
+            }
+
+            static void fill( uint16_t * frame, uint16_t const * last_frame, uint32_t pixels, constants const & k )
+            {
+                for( int j = 0; j < 4; ++j, pixels >>= 8 )
+                {
+                    if( ! ( pixels & 0xff ) )
+                        continue;
+                    uint16x8_t mask = vtstq_u16( vdupq_n_u16( uint16_t( pixels & 0xff ) ), k.lane_bits );
+                    uint16x8_t cur = vld1q_u16( frame + 8 * j );
+                    vst1q_u16( frame + 8 * j, vbslq_u16( mask, vld1q_u16( last_frame + 8 * j ), cur ) );
+                }
+            }
+        };
+    }
+
+    const bool z16_temporal_smoothing_neon_built = true;
+
+    void z16_temporal_smoothing_neon( z16_temporal_smoothing const & ts )
+    {
+        temporal_smooth< neon >( ts );
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the temporal filter falls back to its scalar version
+    const bool z16_temporal_smoothing_neon_built = false;
+    void z16_temporal_smoothing_neon( z16_temporal_smoothing const & ) {}
+}
+
+#endif // RS2_USE_NEON_TEMPORAL_FILTER
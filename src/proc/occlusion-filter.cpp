@@ -4,16 +4,25 @@
 #include <librealsense2/rs.hpp>
 #include "proc/synthetic-stream.h"
 #include "proc/occlusion-filter.h"
+#include "environment.h"
 
 #include <rsutils/string/from.h>
 
 #include <vector>
 #include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
 
 
 namespace librealsense
 {
-    occlusion_filter::occlusion_filter() : _occlusion_filter(occlusion_monotonic_scan) , _occlusion_scanning(horizontal)
+    occlusion_filter::occlusion_filter() : _occlusion_filter(occlusion_monotonic_scan) , _occlusion_scanning(horizontal),
+        _workers(1, environment::get_instance().get_task_pool())
     {
     }
 
@@ -64,49 +73,159 @@ namespace librealsense
 
        return res;
    }
-   template<size_t SIZE>
-   void rotate_image_optimized(byte* dest[], const byte* source, int width, int height)
+   namespace
    {
+       // The state of the left-to-right scan of one row, see monotonic_heuristic_invalidation()
+       struct monotonic_row_scan
+       {
+           float max_in_line = -1;
+           float max_z = 0;
+           int dilation_left = 0;
 
-       auto width_out = height;
-       auto height_out = width;
-
-       auto out = dest[0];
-       auto buffer_size = maxDivisorRange(height, width, 1, ROTATION_BUFFER_SIZE); 
-
-       byte** buffer = new byte * [buffer_size];
-       for (int i = 0; i < buffer_size; ++i)
-           buffer[i] = new byte[buffer_size * SIZE];
+           void step( float3 & point, const float2 & pixel )
+           {
+               const float occ_z_th = 0.1f; //meters
+               const int occ_dilation_size = 1;
 
+               if( ! point.z )
+                   return;
+               // Occlusion detection
+               if( pixel.x < max_in_line || ( pixel.x == max_in_line && ( point.z - max_z ) > occ_z_th ) )
+               {
+                   point = { 0, 0, 0 };
+                   dilation_left = occ_dilation_size;
+               }
+               else
+               {
+                   max_in_line = pixel.x;
+                   max_z = point.z;
+                   if( dilation_left > 0 )
+                   {
+                       point = { 0, 0, 0 };
+                       dilation_left--;
+                   }
+               }
+           }
+       };
 
-       for (int i = 0; i <= height - buffer_size; i = i + buffer_size)
+       void scan_row( float3 * points, const float2 * pixels, int width )
        {
-           for (int j = 0; j <= width - buffer_size; j = j + buffer_size)
+           monotonic_row_scan scan;
+           int x = 0;
+#ifdef __SSSE3__
+           // Most runs of 4 either have no depth, which leaves everything as is, or map to texels strictly to the
+           // right of each other, which only moves the maximum; anything else goes through step()
+           const __m128 zero = _mm_setzero_ps();
+           for( ; x + 4 <= width; x += 4 )
            {
-               for (int ii = 0; ii < buffer_size; ++ii)
+               const float * p = &points[x].x;
+               __m128 p0 = _mm_loadu_ps( p );      // x0 y0 z0 x1
+               __m128 p1 = _mm_loadu_ps( p + 4 );  // y1 z1 x2 y2
+               __m128 p2 = _mm_loadu_ps( p + 8 );  // z2 x3 y3 z3
+               __m128 z = _mm_shuffle_ps( _mm_shuffle_ps( p0, p1, _MM_SHUFFLE( 1, 1, 2, 2 ) ),
+                                          _mm_shuffle_ps( p2, p2, _MM_SHUFFLE( 3, 3, 0, 0 ) ),
+                                          _MM_SHUFFLE( 2, 0, 2, 0 ) );
+               int valid = _mm_movemask_ps( _mm_cmpneq_ps( z, zero ) );
+               if( ! valid )
+                   continue;
+
+               if( valid == 0xF && ! scan.dilation_left )
                {
-                   for (int jj = 0; jj < buffer_size; ++jj)
+                   const float * u = &pixels[x].x;
+                   __m128 px = _mm_shuffle_ps( _mm_loadu_ps( u ), _mm_loadu_ps( u + 4 ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+                   __m128 prev = _mm_move_ss( _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( px ), 4 ) ),
+                                              _mm_set_ss( scan.max_in_line ) );
+                   if( _mm_movemask_ps( _mm_cmpgt_ps( px, prev ) ) == 0xF )
                    {
-                       auto source_index = ((j + jj) + (width * (i + ii))) * SIZE;
-                       memcpy((void*)&(buffer[(buffer_size-1 - jj)][(buffer_size-1 - ii) * SIZE]), &source[source_index], SIZE);
+                       scan.max_in_line = pixels[x + 3].x;
+                       scan.max_z = points[x + 3].z;
+                       continue;
                    }
                }
 
-               for (int ii = 0; ii < buffer_size; ++ii)
-               {
-                   auto out_index = (((height_out - buffer_size - j + 1) * width_out) - i - buffer_size + (ii)*width_out);
-                   memcpy(&out[(out_index)*SIZE], (buffer[ii]), buffer_size * SIZE);
-               }
+               for( int i = 0; i < 4; ++i )
+                   scan.step( points[x + i], pixels[x + i] );
            }
+#endif
+           for( ; x < width; ++x )
+               scan.step( points[x], pixels[x] );
        }
 
-       for (int i = 0; i < buffer_size; ++i)
+       // The vertical scan, for depth pixel (x, y) that differs from the one above it by more than the threshold:
+       // the points at (x, y + i) for i = 0..win are invalidated up to the first whose texture coordinate is not
+       // above that of (x, y - 1)
+       void scan_window( float3 * points, const float2 * uv_map, int width, int x, int y, int win )
        {
-           delete[] buffer[i];
+           const float max_in_line = uv_map[( y - 1 ) * width + x].y;
+           for( int i = 0; i <= win; ++i )
+           {
+               auto index = ( y + i ) * width + x;
+               if( uv_map[index].y < max_in_line )
+                   points[index] = { 0.f, 0.f };
+               else
+                   break;
+           }
+       }
+
+#ifdef __SSSE3__
+       inline __m128 load_v( const float2 * uv )
+       {
+           return _mm_shuffle_ps( _mm_loadu_ps( &uv[0].x ), _mm_loadu_ps( &uv[2].x ), _MM_SHUFFLE( 3, 1, 3, 1 ) );
+       }
+
+       // scan_window() for the columns x..x+3 where 'edges' is set, side by side
+       void scan_windows( float3 * points, const float2 * uv_map, int width, int x, int y, int win, __m128 edges )
+       {
+           const __m128 max_in_line = load_v( uv_map + ( y - 1 ) * width + x );
+           for( int i = 0; i <= win; ++i )
+           {
+               auto index = ( y + i ) * width + x;
+               int left = _mm_movemask_ps( edges = _mm_and_ps( edges, _mm_cmplt_ps( load_v( uv_map + index ), max_in_line ) ) );
+               if( ! left )
+                   break;
+               for( int lane = 0; lane < 4; ++lane )
+                   if( left & ( 1 << lane ) )
+                       points[index + lane] = { 0.f, 0.f };
+           }
+       }
+#endif
+
+       // The vertical scan of columns [begin, end) of row y, where the depth is compared with the row above; any
+       // difference above 'limit' is an edge, and all are when 'limit' is negative
+       void scan_edges( float3 * points, const float2 * uv_map, const uint16_t * depth, int width, int y,
+                        int begin, int end, int win, int limit )
+       {
+           const uint16_t * row = depth + y * width;
+           const uint16_t * above = row - width;
+           int x = begin;
+#ifdef __SSSE3__
+           const __m128i lim = _mm_set1_epi16( int16_t( std::max( limit, 0 ) ) );
+           const __m128i zero = _mm_setzero_si128();
+           const __m128i all = _mm_set1_epi16( limit < 0 ? -1 : 0 );
+           for( ; x + 8 <= end; x += 8 )
+           {
+               __m128i a = _mm_loadu_si128( reinterpret_cast< const __m128i * >( row + x ) );
+               __m128i b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( above + x ) );
+               __m128i diff = _mm_or_si128( _mm_subs_epu16( a, b ), _mm_subs_epu16( b, a ) );
+               __m128i edges = _mm_or_si128( _mm_andnot_si128( _mm_cmpeq_epi16( _mm_subs_epu16( diff, lim ), zero ),
+                                                               _mm_set1_epi16( -1 ) ),
+                                             all );
+               int mask = _mm_movemask_epi8( edges );
+               if( mask & 0x00FF )
+                   scan_windows( points, uv_map, width, x, y, win, _mm_castsi128_ps( _mm_unpacklo_epi16( edges, edges ) ) );
+               if( mask & 0xFF00 )
+                   scan_windows( points, uv_map, width, x + 4, y, win, _mm_castsi128_ps( _mm_unpackhi_epi16( edges, edges ) ) );
+           }
+#endif
+           for( ; x < end; ++x )
+           {
+               int diff = std::abs( int( row[x] ) - int( above[x] ) );
+               if( diff > limit )
+                   scan_window( points, uv_map, width, x, y, win );
+           }
        }
-       delete[] buffer;
- 
    }
+
     // IMPORTANT! This implementation is based on the assumption that the RGB sensor is positioned strictly to the left of the depth sensor.
     // namely D415/D435 and SR300. The implementation WILL NOT work properly for different setups
     // Heuristic occlusion invalidation algorithm:
@@ -115,106 +234,39 @@ namespace librealsense
     // -  The occlusion is designated as U coordinate for a given pixel is less than the U coordinate of the predecessing pixel.
     // -  The UV mapping for the occluded pixel is reset to (0,0). Later on the (0,0) coordinate in the texture map is overwritten
     //    with a invalidation color such as black/magenta according to the purpose (production/debugging)
+    // The vertical scan (RGB sensor above the depth sensor) looks for jumps in depth between each pixel and the one above it,
+    // and invalidates the points below a jump whose V coordinate is above that of the pixel over it.
+    // Rows are independent in the horizontal scan, and columns in the vertical one, so both are split between the workers.
    void occlusion_filter::monotonic_heuristic_invalidation(float3* points, float2* uv_map, const std::vector<float2>& pix_coord, const rs2::depth_frame& depth) const
    {
-       float occZTh = 0.1f; //meters
-       int occDilationSz = 1;
        auto points_width = _depth_intrinsics->width;
        auto points_height = _depth_intrinsics->height;
-       auto pixels_ptr = pix_coord.data();
-       auto points_ptr = points;
-       auto uv_map_ptr = uv_map;
-       float maxInLine = -1;
-       float maxZ = 0;
+       _workers.resize(_processing_threads);
 
        if (_occlusion_scanning == horizontal)
        {
-           for( int y = 0; y < points_height; ++y )
-           {
-               maxInLine = -1;
-               maxZ = 0;
-               int occDilationLeft = 0;
-
-               for(int x = 0; x < points_width; ++x )
-               {
-                   if( points_ptr->z )
-                   {
-                       // Occlusion detection
-                       if( pixels_ptr->x < maxInLine
-                           || ( pixels_ptr->x == maxInLine && ( points_ptr->z - maxZ ) > occZTh ) )
-                       {
-                           *points_ptr = { 0, 0, 0 };
-                           occDilationLeft = occDilationSz;
-                       }
-                       else
-                       {
-                           maxInLine = pixels_ptr->x;
-                           maxZ = points_ptr->z;
-                           if( occDilationLeft > 0 )
-                           {
-                               *points_ptr = { 0, 0, 0 };
-                               occDilationLeft--;
-                           }
-                       }
-                   }
-                   ++points_ptr;
-                   ++uv_map_ptr;
-                   ++pixels_ptr;
-               }
-           }
+           auto pixels_ptr = pix_coord.data();
+           _workers.parallel_for(points_height, [&](size_t begin, size_t end) {
+               for (size_t y = begin; y < end; ++y)
+                   scan_row(points + y * points_width, pixels_ptr + y * points_width, points_width);
+           });
        }
        else if (_occlusion_scanning == vertical)
        {
-           auto rotated_depth_width = _depth_intrinsics->height;
-           auto rotated_depth_height = _depth_intrinsics->width;
-           auto depth_ptr = (byte*)(depth.get_data());
-           std::vector< byte > alloc( depth.get_bytes_per_pixel() * points_width * points_height );
-           byte* depth_planes[1];
-           depth_planes[0] = alloc.data();
-
-           rotate_image_optimized<2>(depth_planes, (const byte*)(depth.get_data()), points_width, points_height);
-
-           // scan depth frame after rotation: check if there is a noticed jump between adjacen pixels in Z-axis (depth), it means there could be occlusion.
-           // save suspected points and run occlusion-invalidation vertical scan only on them
-           // after rotation : height = points_width , width = points_height
-           for (int i = 0; i < rotated_depth_height; i++)
-           {
-               for (int j = 0; j < rotated_depth_width; j++)
-               {
-                   // before depth frame rotation: occlusion detected in the positive direction of Y
-                   // after rotation : scan from right to left (positive direction of X) to detect occlusion
-                   // compare depth each pixel only with the pixel on its right (i,j+1)
-                   auto index = (j + (rotated_depth_width * i));
-                   auto uv_index = ((rotated_depth_height - i - 1) + (rotated_depth_width - j - 1) * rotated_depth_height);
-                   auto index_right = index + 1;
-                   uint16_t* diff_depth_ptr = (uint16_t*)depth_planes[0];
-                   uint16_t diff_right = abs((uint16_t)(*(diff_depth_ptr + index)) - (uint16_t)(*(diff_depth_ptr + index_right)));
-                   float scaled_threshold = DEPTH_OCCLUSION_THRESHOLD / _depth_units;
-                   if (diff_right > scaled_threshold)
-                   {
-                       points_ptr = points + uv_index;
-                       uv_map_ptr = uv_map + uv_index;
-                       auto scan_win_size = maxDivisorRange(rotated_depth_height, rotated_depth_width, 1, VERTICAL_SCAN_WINDOW_SIZE);
-
-                       if (j >= scan_win_size) {
-                           maxInLine = (uv_map_ptr - 1 * points_width)->y;
-                           for (int y = 0; y <= scan_win_size; ++y)
-                           {
-                               if (((uv_map_ptr + y * points_width)->y < maxInLine))
-                               {
-                                   *(points_ptr + y * points_width) = { 0.f, 0.f };
-                               }
-                               else
-                               {
-                                   break;
-                               }
-
-                           }
-
-                       }
-                   }
-               }
-           }
+           auto depth_ptr = reinterpret_cast<const uint16_t*>(depth.get_data());
+           auto scan_win_size = maxDivisorRange(points_width, points_height, 1, VERTICAL_SCAN_WINDOW_SIZE);
+
+           // Differences are whole numbers: 'diff > scaled_threshold' is 'diff > floor(scaled_threshold)'
+           float scaled_threshold = DEPTH_OCCLUSION_THRESHOLD / _depth_units;
+           if (!(scaled_threshold < std::numeric_limits<uint16_t>::max()))
+               return;
+           int limit = scaled_threshold < 0 ? -1 : int(scaled_threshold);
+
+           // The window needs a row above the edge, and scan_win_size rows below it
+           _workers.parallel_for(points_width, [&](size_t begin, size_t end) {
+               for (int y = 1; y + scan_win_size < points_height; ++y)
+                   scan_edges(points, uv_map, depth_ptr, points_width, y, int(begin), int(end), scan_win_size, limit);
+           }, 64);
        }
    }
     // Prepare texture map without occlusion that for every texture coordinate there no more than one depth point that is mapped to it
@@ -5,7 +5,8 @@
 #include <librealsense2/hpp/rs_frame.hpp>
 #include "rotation-transform.h"
 
-#define ROTATION_BUFFER_SIZE 32 // minimum limit that could be divided by all resolutions
+#include <rsutils/concurrency/worker-pool.h>
+
 #define VERTICAL_SCAN_WINDOW_SIZE 16
 #define DEPTH_OCCLUSION_THRESHOLD 0.5f //meters
 
@@ -66,5 +67,7 @@ namespace librealsense
         occlusion_rect_type                         _occlusion_filter;
         occlusion_scanning_type                     _occlusion_scanning;
         float                                       _depth_units;
+        int                                         _processing_threads = 1;
+        mutable worker_pool                         _workers;
     };
 }
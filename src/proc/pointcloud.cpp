@@ -12,6 +12,11 @@
 #include "../stream.h"
 #include <rsutils/string/from.h>
 #include "device-calibration.h"
+#include "points.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #ifdef RS2_USE_CUDA
 #include "proc/cuda/cuda-pointcloud.h"
@@ -22,9 +27,10 @@
 
 namespace librealsense
 {
-    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, MAP_DEPTH map_depth)
+    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, int first_row, int rows,
+        const uint16_t * depth, MAP_DEPTH map_depth)
     {
-        for (int y = 0; y < intrin.height; ++y)
+        for (int y = first_row; y < first_row + rows; ++y)
         {
             for (int x = 0; x < intrin.width; ++x)
             {
@@ -38,10 +44,17 @@ namespace librealsense
     const float3 * pointcloud::depth_to_points(rs2::points output, 
         const rs2_intrinsics &depth_intrinsics, const rs2::depth_frame& depth_frame)
     {
-        auto image = output.get_vertices();
+        auto image = (float3*)output.get_vertices();
+        deproject_rows(image, depth_intrinsics, depth_frame, 0, depth_intrinsics.height);
+        return image;
+    }
+
+    void pointcloud::deproject_rows(float3* points, const rs2_intrinsics& depth_intrinsics,
+        const rs2::depth_frame& depth_frame, int first_row, int rows)
+    {
         auto depth_scale = depth_frame.get_units();
-        deproject_depth((float*)image, depth_intrinsics, (const uint16_t*)depth_frame.get_data(), [depth_scale](uint16_t z) { return depth_scale * z; });
-        return (float3*)image;
+        auto depth = (const uint16_t*)depth_frame.get_data() + size_t(first_row) * depth_intrinsics.width;
+        deproject_depth((float*)points, depth_intrinsics, first_row, rows, depth, [depth_scale](uint16_t z) { return depth_scale * z; });
     }
 
     float3 transform(const rs2_extrinsics *extrin, const float3 &point) { float3 p = {}; rs2_transform_point_to_point(&p.x, extrin, &point.x); return p; }
@@ -49,6 +62,161 @@ namespace librealsense
     float2 pixel_to_texcoord(const rs2_intrinsics *intrin, const float2 & pixel) { return{ pixel.x / (intrin->width), pixel.y / (intrin->height) }; }
     float2 project_to_texcoord(const rs2_intrinsics *intrin, const float3 & point) { return pixel_to_texcoord(intrin, project(intrin, point)); }
 
+    // The vertex formats of RS2_OPTION_VERTEX_FORMAT, by option value
+    static const rs2_format vertex_formats[] = { RS2_FORMAT_XYZ32F, RS2_FORMAT_XYZ16F, RS2_FORMAT_XYZ16 };
+
+    // IEEE half precision, rounded to the nearest even like F16C's _mm_cvtps_ph
+    inline uint16_t float_to_half(float f)
+    {
+        uint32_t x;
+        memcpy(&x, &f, sizeof(x));
+        uint16_t const sign = uint16_t((x >> 16) & 0x8000);
+        x &= 0x7fffffff;
+        if (x >= 0x47800000) // too large (or infinite, or NaN)
+            return sign | (x > 0x7f800000 ? 0x7e00 : 0x7c00);
+        if (x >= 0x38800000) // normal: rebias the exponent from 127 to 15
+        {
+            x -= 0x38000000;
+            return sign | uint16_t((x + 0xfff + ((x >> 13) & 1)) >> 13);
+        }
+        if (x < 0x33000000) // under half the smallest subnormal
+            return sign;
+        uint32_t const shift = 126 - (x >> 23);
+        uint32_t const mantissa = (x & 0x7fffff) | 0x800000;
+        uint32_t const h = mantissa >> shift;
+        uint32_t const rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+        return sign | uint16_t(h + (rest > halfway || (rest == halfway && (h & 1))));
+    }
+
+    inline int16_t meters_to_millimeters(float v)
+    {
+        return int16_t(std::lrint(std::min(std::max(v * 1000.f, -32768.f), 32767.f)));
+    }
+
+    // The passes that make a packed cloud go this many pixels at a time, so that the band is still in cache when
+    // it is packed
+    static const size_t packing_band_pixels = 8192;
+
+    // Returns where the next vertex goes
+    template<class T, class CONVERT>
+    T* pack_vertices(const float3* vertices, const float2* texcoords, size_t first, size_t pixels, bool valid_only,
+        T* out, float2*& out_texcoords, uint8_t* mask, CONVERT convert)
+    {
+        for (size_t i = 0; i < pixels; ++i)
+        {
+            auto const& v = vertices[i];
+            if (valid_only)
+            {
+                if (!v.z)
+                    continue;
+                mask[(first + i) / 8] |= uint8_t(1 << ((first + i) % 8));
+            }
+            out[0] = convert(v.x);
+            out[1] = convert(v.y);
+            out[2] = convert(v.z);
+            out += 3;
+            if (out_texcoords)
+                *out_texcoords++ = texcoords[i];
+        }
+        return out;
+    }
+
+    rs2::frame pointcloud::pack_points(const rs2::depth_frame& depth, rs2_format vertex_format, bool valid_only,
+        bool texture_coordinates, bool map_texture, const rs2_intrinsics& mapped_intr, const rs2_extrinsics& extr)
+    {
+        int const width = _depth_intrinsics->width, height = _depth_intrinsics->height;
+        size_t const pixels = size_t(width) * height;
+        bool const occlusion = map_texture && run__occlusion_filter(extr);
+
+        // The occlusion removal needs the whole cloud. Otherwise bands of rows are deprojected, mapped and packed
+        // one after the other; they start on multiples of 8 pixels, as the SSE passes need.
+        int band_rows = height;
+        if (!occlusion)
+        {
+            int step = 1;
+            while ((size_t(width) * step) % 8)
+                step *= 2;
+            band_rows = std::min(height, std::max(step, int(packing_band_pixels / width) / step * step));
+        }
+        size_t const band_size = size_t(band_rows) * width;
+
+        // Float vertices of all the pixels are the start of the packed frame, and are written there directly
+        bool const direct = vertex_format == RS2_FORMAT_XYZ32F && !valid_only && !texture_coordinates && pixels % 8 == 0;
+        if (!direct)
+            _band_vertices.resize(band_size + 8);
+        if (texture_coordinates)
+            _band_texcoords.resize(band_size + 8);
+
+        if (!_packed_stream || _packed_stream.format() != vertex_format)
+            _packed_stream = depth.get_profile().clone(RS2_STREAM_DEPTH, depth.get_profile().stream_index(), vertex_format);
+        auto profile = std::dynamic_pointer_cast<stream_profile_interface>(_packed_stream.get()->profile->shared_from_this());
+
+        rs2::frame res;
+        librealsense::points* packed = nullptr;
+        uint8_t* out = nullptr;
+        float2* out_texcoords = nullptr;
+        uint8_t* mask = nullptr;
+        auto allocate = [&](size_t count)
+        {
+            size_t const mask_pixels = valid_only ? pixels : 0;
+            auto frame = _source_wrapper.allocate_points(profile, (frame_interface*)depth.get(), RS2_EXTENSION_POINTS,
+                librealsense::points::get_size(vertex_format, count, texture_coordinates, mask_pixels));
+            res = rs2::frame{ (rs2_frame*)frame };
+            packed = (librealsense::points*)frame;
+            packed->set_layout(vertex_format, count, texture_coordinates, mask_pixels);
+            out = packed->data.data();
+            out_texcoords = packed->get_texture_coordinates();
+            mask = const_cast<uint8_t*>(packed->get_validity_mask());
+            if (mask)
+                memset(mask, 0, (pixels + 7) / 8);
+        };
+
+        // Without occlusion removal, the points with depth are the pixels with depth
+        if (!occlusion || !valid_only)
+        {
+            auto z = (const uint16_t*)depth.get_data();
+            allocate(valid_only ? size_t(std::count_if(z, z + pixels, [](uint16_t d) { return d != 0; })) : pixels);
+        }
+
+        for (int first_row = 0; first_row < height; first_row += band_rows)
+        {
+            int const rows = std::min(band_rows, height - first_row);
+            size_t const first = size_t(first_row) * width, size = size_t(rows) * width;
+
+            float3* vertices = direct ? (float3*)out + first : _band_vertices.data();
+            deproject_rows(vertices, *_depth_intrinsics, depth, first_row, rows);
+            if (direct)
+                continue;
+
+            float2* texcoords = _band_texcoords.data();
+            if (map_texture)
+            {
+                map_rows(texcoords, vertices, width, rows, mapped_intr, extr, _pixels_map.data() + first);
+                if (occlusion)
+                    remove_occlusions(vertices, texcoords, depth, extr);
+            }
+            else if (texture_coordinates)
+                std::fill(texcoords, texcoords + size, float2{ 0.f, 0.f });
+
+            if (!packed)
+                allocate(std::count_if(vertices, vertices + size, [](const float3& v) { return v.z != 0; }));
+
+            switch (vertex_format)
+            {
+            case RS2_FORMAT_XYZ16F:
+                out = (uint8_t*)pack_vertices(vertices, texcoords, first, size, valid_only, (uint16_t*)out, out_texcoords, mask, float_to_half);
+                break;
+            case RS2_FORMAT_XYZ16:
+                out = (uint8_t*)pack_vertices(vertices, texcoords, first, size, valid_only, (int16_t*)out, out_texcoords, mask, meters_to_millimeters);
+                break;
+            default:
+                out = (uint8_t*)pack_vertices(vertices, texcoords, first, size, valid_only, (float*)out, out_texcoords, mask, [](float v) { return v; });
+                break;
+            }
+        }
+        return res;
+    }
+
     void pointcloud::set_extrinsics()
     {
         if (_output_stream && _other_stream && !_extrinsics)
@@ -70,6 +238,7 @@ namespace librealsense
         {
             _output_stream = depth.get_profile().as<rs2::video_stream_profile>().clone(
                 RS2_STREAM_DEPTH, depth.get_profile().stream_index(), RS2_FORMAT_XYZ32F);
+            _packed_stream = rs2::stream_profile();
             _depth_stream = depth;
             _depth_intrinsics = optional_value<rs2_intrinsics>();
             _depth_units = ((depth_frame*)depth.get())->get_units();
@@ -208,11 +377,20 @@ namespace librealsense
         const rs2_extrinsics& extr,
         float2* pixels_ptr)
     {
-        auto tex_ptr = (float2*)output.get_texture_coordinates();
+        map_rows((float2*)output.get_texture_coordinates(), points, width, height, other_intrinsics, extr, pixels_ptr);
+    }
 
-        for (unsigned int y = 0; y < height; ++y)
+    void pointcloud::map_rows(float2* tex_ptr,
+        const float3* points,
+        int width,
+        int rows,
+        const rs2_intrinsics &other_intrinsics,
+        const rs2_extrinsics& extr,
+        float2* pixels_ptr)
+    {
+        for (int y = 0; y < rows; ++y)
         {
-            for (unsigned int x = 0; x < width; ++x)
+            for (int x = 0; x < width; ++x)
             {
                 if (points->z)
                 {
@@ -236,6 +414,17 @@ namespace librealsense
         }
     }
 
+    void pointcloud::remove_occlusions(float3* points, float2* texcoords, const rs2::depth_frame& depth,
+        const rs2_extrinsics& extr)
+    {
+        if (_occlusion_filter->find_scanning_direction(extr) == vertical)
+        {
+            _occlusion_filter->set_scanning(static_cast<uint8_t>(vertical));
+            _occlusion_filter->_depth_units = _depth_units;
+        }
+        _occlusion_filter->process(points, texcoords, _pixels_map, depth);
+    }
+
     rs2::points pointcloud::allocate_points(const rs2::frame_source& source, const rs2::frame& depth)
     {
         return source.allocate_points(_output_stream, depth);
@@ -243,17 +432,14 @@ namespace librealsense
 
     rs2::frame pointcloud::process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth)
     {
-        auto res = allocate_points(source, depth);
-        auto pframe = (librealsense::points*)(res.get());
-        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
-
-        auto vid_frame = depth.as<rs2::video_frame>();
+        auto const vertex_format = vertex_formats[_vertex_format];
+        bool const valid_only = _valid_points_only;
+        bool const texture_coordinates = _texture_coordinates;
 
-        // Pixels calculated in the mapped texture. Used in post-processing filters
-        float2* pixels_ptr = _pixels_map.data();
         rs2_intrinsics mapped_intr;
         rs2_extrinsics extr;
         bool map_texture = false;
+        if (texture_coordinates)
         {
             if (_extrinsics && _other_intrinsics)
             {
@@ -263,6 +449,18 @@ namespace librealsense
             }
         }
 
+        if (vertex_format != RS2_FORMAT_XYZ32F || valid_only || !texture_coordinates)
+            return pack_points(depth, vertex_format, valid_only, texture_coordinates, map_texture, mapped_intr, extr);
+
+        auto res = allocate_points(source, depth);
+        auto pframe = (librealsense::points*)(res.get());
+        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
+
+        auto vid_frame = depth.as<rs2::video_frame>();
+
+        // Pixels calculated in the mapped texture. Used in post-processing filters
+        float2* pixels_ptr = _pixels_map.data();
+
         if (map_texture)
         {
             auto height = vid_frame.get_height();
@@ -271,15 +469,9 @@ namespace librealsense
             get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
 
             if (run__occlusion_filter(extr))
-            {
-                if (_occlusion_filter->find_scanning_direction(extr) == vertical)
-                {
-                    _occlusion_filter->set_scanning(static_cast<uint8_t>(vertical));
-                    _occlusion_filter->_depth_units = _depth_units;
-                }
-                _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map, depth);
-            }
+                remove_occlusions(pframe->get_vertices(), pframe->get_texture_coordinates(), depth, extr);
         }
+
         return res;
     }
 
@@ -317,6 +509,27 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Off");
         occlusion_invalidation->set_description(2.f, "On");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+
+        register_processing_threads_option(&_occlusion_filter->_processing_threads,
+            "Number of threads the occlusion removal of each frame is split between");
+
+        auto vertex_format = std::make_shared<ptr_option<int>>(
+            0, int(sizeof(vertex_formats) / sizeof(vertex_formats[0])) - 1, 1, 0,
+            &_vertex_format, "Vertices format");
+        vertex_format->set_description(0.f, "32-bit float meters");
+        vertex_format->set_description(1.f, "16-bit half float meters");
+        vertex_format->set_description(2.f, "16-bit integer millimeters");
+        register_option(RS2_OPTION_VERTEX_FORMAT, vertex_format);
+
+        auto valid_points_only = std::make_shared<ptr_option<bool>>(
+            false, true, true, false,
+            &_valid_points_only, "Output only the points with depth, and a bitmask of their pixels");
+        register_option(RS2_OPTION_VALID_POINTS_ONLY, valid_points_only);
+
+        auto texture_coordinates = std::make_shared<ptr_option<bool>>(
+            false, true, true, true,
+            &_texture_coordinates, "Map the points to the texture stream");
+        register_option(RS2_OPTION_TEXTURE_COORDINATES, texture_coordinates);
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
@@ -393,6 +606,8 @@ namespace librealsense
             return std::make_shared<librealsense::pointcloud_cuda>();
         #else
         #ifdef __SSSE3__
+            if (pointcloud_avx::is_supported())
+                return std::make_shared<librealsense::pointcloud_avx>();
             return std::make_shared<librealsense::pointcloud_sse>();
         #else
             return std::make_shared<librealsense::pointcloud>();
@@ -34,6 +34,13 @@ namespace librealsense
     protected:
         pointcloud(const char* name);
 
+        // depth_to_points() and get_texture_map() over 'rows' rows of the depth frame from 'first_row', into
+        // buffers of the caller: the packed layouts are made from bands of a few rows
+        virtual void deproject_rows(float3* points, const rs2_intrinsics& depth_intrinsics,
+            const rs2::depth_frame& depth_frame, int first_row, int rows);
+        virtual void map_rows(float2* texture_map, const float3* points, int width, int rows,
+            const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr, float2* pixels_ptr);
+
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
@@ -53,9 +60,20 @@ namespace librealsense
         void inspect_depth_frame(const rs2::frame& depth);
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
+        rs2::frame pack_points(const rs2::depth_frame& depth, rs2_format vertex_format, bool valid_only,
+            bool texture_coordinates, bool map_texture, const rs2_intrinsics& mapped_intr, const rs2_extrinsics& extr);
+        void remove_occlusions(float3* points, float2* texcoords, const rs2::depth_frame& depth, const rs2_extrinsics& extr);
         void set_extrinsics();
 
         stream_filter _prev_stream_filter;
         std::shared_ptr< pointcloud > _registered_auto_calib_cb;
+
+        // Output layout options: the organized XYZ32F cloud unless one is not default
+        int _vertex_format = 0;
+        bool _valid_points_only = false;
+        bool _texture_coordinates = true;
+        rs2::stream_profile _packed_stream;
+        std::vector<float3> _band_vertices;
+        std::vector<float2> _band_texcoords;
     };
 }
@@ -10,6 +10,8 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/color-formats-converter.h"
+#include "proc/sse/sse-spatial-filter.h"
 
 #include <rsutils/string/from.h>
 
@@ -63,7 +65,9 @@ namespace librealsense
         _focal_lenght_mm(0.f),
         _stereo_baseline_mm(0.f),
         _holes_filling_mode(holes_fill_def),
-        _holes_filling_radius(0)
+        _holes_filling_radius(0),
+        _processing_threads(1),
+        _workers(1, environment::get_instance().get_task_pool())
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -156,6 +160,8 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+
+        register_processing_threads_option(&_processing_threads);
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -164,6 +170,7 @@ namespace librealsense
 
         update_configuration(f);
         tgt = prepare_target_frame(f, source);
+        _workers.resize(_processing_threads);
 
         // Spatial domain transform edge-preserving filter
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
@@ -237,13 +244,51 @@ namespace librealsense
         return tgt;
     }
 
-    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
+    enum class z16_instruction_set { none, sse41, avx2 };
+
+    static z16_instruction_set select_z16_instruction_set()
+    {
+        if (z16_domain_transform_avx2_built && has_avx2())
+            return z16_instruction_set::avx2;
+        if (z16_domain_transform_sse41_built && has_sse41())
+            return z16_instruction_set::sse41;
+        return z16_instruction_set::none;
+    }
+
+    void spatial_filter::recursive_filter_horizontal_z16(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
+    {
+        static const z16_instruction_set isa = select_z16_instruction_set();
+        z16_domain_transform dt = { static_cast<uint16_t*>(image_data), _width, _height, alpha, static_cast<uint16_t>(deltaZ), _holes_filling_radius };
+
+        switch (isa)
+        {
+        case z16_instruction_set::avx2: z16_domain_transform_horizontal_avx2(dt, row_begin, row_end); break;
+        case z16_instruction_set::sse41: z16_domain_transform_horizontal_sse41(dt, row_begin, row_end); break;
+        default: recursive_filter_horizontal<uint16_t>(image_data, alpha, deltaZ, row_begin, row_end); break;
+        }
+    }
+
+    void spatial_filter::recursive_filter_vertical_z16(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
+    {
+        static const z16_instruction_set isa = select_z16_instruction_set();
+        z16_domain_transform dt = { static_cast<uint16_t*>(image_data), _width, _height, alpha, static_cast<uint16_t>(deltaZ), _holes_filling_radius };
+
+        switch (isa)
+        {
+        case z16_instruction_set::avx2: z16_domain_transform_vertical_avx2(dt, col_begin, col_end); break;
+        case z16_instruction_set::sse41: z16_domain_transform_vertical_sse41(dt, col_begin, col_end); break;
+        default: recursive_filter_vertical<uint16_t>(image_data, alpha, deltaZ, col_begin, col_end); break;
+        }
+    }
+
+    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
-        int v, u;
+        size_t v;
+        int u;
 
-        for (v = 0; v < _height;) {
+        for (v = row_begin; v < row_end;) {
             // left to right
             float *im = image + v * _width;
             float state = *im;
@@ -365,15 +410,16 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
-        int v, u;
+        int v;
+        size_t u;
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = col_begin; u < col_end;) {
 
             float *im = image + u;
             float state = im[0];
@@ -13,6 +13,8 @@
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
+#include <rsutils/concurrency/worker-pool.h>
+
 namespace librealsense
 {
     class spatial_filter : public depth_processing_block
@@ -32,31 +34,61 @@ namespace librealsense
             static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
             bool fp = (std::is_floating_point<T>::value);
 
+            // Rows are independent in the horizontal passes, as are columns in the vertical ones, so
+            // each pass is split into bands; the result does not depend on the number of threads
             for (int i = 0; i < iterations; i++)
             {
                 if (fp)
                 {
-                    recursive_filter_horizontal_fp(frame_data, alpha, delta);
-                    recursive_filter_vertical_fp(frame_data, alpha, delta);
+                    _workers.parallel_for(_height, [&](size_t begin, size_t end) {
+                        recursive_filter_horizontal_fp(frame_data, alpha, delta, begin, end);
+                    }, min_rows_per_band);
+                    _workers.parallel_for(_width, [&](size_t begin, size_t end) {
+                        recursive_filter_vertical_fp(frame_data, alpha, delta, begin, end);
+                    }, min_columns_per_band);
+                }
+                else if (std::is_same<T, uint16_t>::value)
+                {
+                    _workers.parallel_for(_height, [&](size_t begin, size_t end) {
+                        recursive_filter_horizontal_z16(frame_data, alpha, delta, begin, end);
+                    }, min_rows_per_band);
+                    _workers.parallel_for(_width, [&](size_t begin, size_t end) {
+                        recursive_filter_vertical_z16(frame_data, alpha, delta, begin, end);
+                    }, min_columns_per_band);
                 }
                 else
                 {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    _workers.parallel_for(_height, [&](size_t begin, size_t end) {
+                        recursive_filter_horizontal<T>(frame_data, alpha, delta, begin, end);
+                    }, min_rows_per_band);
+                    _workers.parallel_for(_width, [&](size_t begin, size_t end) {
+                        recursive_filter_vertical<T>(frame_data, alpha, delta, begin, end);
+                    }, min_columns_per_band);
                 }
             }
 
             // Disparity domain hole filling requires a second pass over the frame data
             // For depth domain a more efficient in-place hole filling is performed
             if (_holes_filling_mode && fp)
-                intertial_holes_fill<T>(static_cast<T*>(frame_data));
+                _workers.parallel_for(_height, [&](size_t begin, size_t end) {
+                    intertial_holes_fill<T>(static_cast<T*>(frame_data), begin, end);
+                }, min_rows_per_band);
         }
 
-        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
-        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
+        // Bands smaller than these cost more to hand over than they save
+        static const size_t min_rows_per_band = 8;
+        static const size_t min_columns_per_band = 64;
 
+        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end);
+        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end);
+
+        // Same as recursive_filter_horizontal/vertical<uint16_t>, vectorized when the CPU allows it
+        void recursive_filter_horizontal_z16(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end);
+        void recursive_filter_vertical_z16(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end);
+
+        // Filters rows [row_begin, row_end)
         template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
         {
             size_t v{}, u{};
 
@@ -72,7 +104,7 @@ namespace librealsense
             auto image = reinterpret_cast<T*>(image_data);
             size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (v = row_begin; v < row_end; v++)
             {
                 // left to right
                 T *im = image + v * _width;
@@ -150,8 +182,9 @@ namespace librealsense
             }
         }
 
+        // Filters columns [col_begin, col_end)
         template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
         {
             size_t v{}, u{};
 
@@ -170,12 +203,13 @@ namespace librealsense
 
             // top to bottom
 
-            T *im = image;
+            T *im;
             T im0{};
             T imw{};
             for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (v - 1) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -194,10 +228,10 @@ namespace librealsense
             }
 
             // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+            for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (_height - 1 - v) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -216,8 +250,9 @@ namespace librealsense
             }
         }
 
+        // Fills rows [row_begin, row_end)
         template<typename T>
-        inline void intertial_holes_fill(T* image_data)
+        inline void intertial_holes_fill(T* image_data, size_t row_begin, size_t row_end)
         {
             std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
@@ -225,8 +260,8 @@ namespace librealsense
 
             size_t cur_fill = 0;
 
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            T* p = image_data + row_begin * _width;
+            for (size_t j = row_begin; j < row_end; ++j)
             {
                 ++p;
                 cur_fill = 0;
@@ -280,6 +315,8 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        int                     _processing_threads;
+        worker_pool             _workers;
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
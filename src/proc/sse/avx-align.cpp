@@ -0,0 +1,140 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "avx-align.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>  // AVX2
+
+namespace librealsense
+{
+    namespace
+    {
+        // The same operations, in the same order, as distorte_x_y() in sse-align.cpp (and, for Brown-Conrady, as
+        // rs2_project_point_to_pixel)
+        template< rs2_distortion dist >
+        inline void distort( __m256 &, __m256 &, __m256 const[5] )
+        {
+        }
+
+        template<>
+        inline void distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( __m256 & x, __m256 & y, __m256 const c[5] )
+        {
+            __m256 const one = _mm256_set1_ps( 1 );
+            __m256 const two = _mm256_set1_ps( 2 );
+
+            __m256 r2 = _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) );
+            __m256 r3 = _mm256_add_ps( _mm256_mul_ps( c[1], _mm256_mul_ps( r2, r2 ) ),
+                                       _mm256_mul_ps( c[4], _mm256_mul_ps( r2, _mm256_mul_ps( r2, r2 ) ) ) );
+            __m256 f = _mm256_add_ps( one, _mm256_add_ps( _mm256_mul_ps( c[0], r2 ), r3 ) );
+
+            __m256 x_f = _mm256_mul_ps( x, f );
+            __m256 y_f = _mm256_mul_ps( y, f );
+
+            __m256 r4 = _mm256_mul_ps( c[3], _mm256_add_ps( r2, _mm256_mul_ps( two, _mm256_mul_ps( x_f, x_f ) ) ) );
+            x = _mm256_add_ps( x_f, _mm256_add_ps( _mm256_mul_ps( two, _mm256_mul_ps( c[2], _mm256_mul_ps( x_f, y_f ) ) ), r4 ) );
+            y = _mm256_add_ps( y_f, _mm256_add_ps( _mm256_mul_ps( two, _mm256_mul_ps( c[3], _mm256_mul_ps( x_f, y_f ) ) ), r4 ) );
+        }
+
+        template<>
+        inline void distort< RS2_DISTORTION_BROWN_CONRADY >( __m256 & x, __m256 & y, __m256 const c[5] )
+        {
+            __m256 const one = _mm256_set1_ps( 1 );
+            __m256 const two = _mm256_set1_ps( 2 );
+
+            __m256 r2 = _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) );
+            __m256 f = _mm256_add_ps( _mm256_add_ps( _mm256_add_ps( one, _mm256_mul_ps( c[0], r2 ) ),
+                                                     _mm256_mul_ps( _mm256_mul_ps( c[1], r2 ), r2 ) ),
+                                      _mm256_mul_ps( _mm256_mul_ps( _mm256_mul_ps( c[4], r2 ), r2 ), r2 ) );
+            __m256 dx = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, f ), _mm256_mul_ps( _mm256_mul_ps( _mm256_mul_ps( two, c[2] ), x ), y ) ),
+                                       _mm256_mul_ps( c[3], _mm256_add_ps( r2, _mm256_mul_ps( _mm256_mul_ps( two, x ), x ) ) ) );
+            __m256 dy = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( y, f ), _mm256_mul_ps( _mm256_mul_ps( _mm256_mul_ps( two, c[3] ), x ), y ) ),
+                                       _mm256_mul_ps( c[2], _mm256_add_ps( r2, _mm256_mul_ps( _mm256_mul_ps( two, y ), y ) ) ) );
+            x = dx;
+            y = dy;
+        }
+
+        template< rs2_distortion dist >
+        size_t texture_map( uint16_t const * depth, float depth_scale, size_t count, float const * map_x,
+                            float const * map_y, int32_t * pixels, rs2_intrinsics const & to,
+                            rs2_extrinsics const & from_to_other )
+        {
+            __m256 r[9], t[3], c[5];
+            for( int i = 0; i < 9; ++i )
+                r[i] = _mm256_set1_ps( from_to_other.rotation[i] );
+            for( int i = 0; i < 3; ++i )
+                t[i] = _mm256_set1_ps( from_to_other.translation[i] );
+            for( int i = 0; i < 5; ++i )
+                c[i] = _mm256_set1_ps( to.coeffs[i] );
+            __m256 const scale = _mm256_set1_ps( depth_scale );
+            __m256 const zero = _mm256_setzero_ps();
+            __m256 const half = _mm256_set1_ps( 0.5f );
+            __m256 const fx = _mm256_set1_ps( to.fx );
+            __m256 const fy = _mm256_set1_ps( to.fy );
+            __m256 const ppx = _mm256_set1_ps( to.ppx );
+            __m256 const ppy = _mm256_set1_ps( to.ppy );
+
+            size_t i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i const d16 = _mm_loadu_si128( reinterpret_cast< __m128i const * >( depth + i ) );
+                __m256 const d = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( d16 ) ), scale );
+                __m256 const px = _mm256_mul_ps( d, _mm256_loadu_ps( map_x + i ) );
+                __m256 const py = _mm256_mul_ps( d, _mm256_loadu_ps( map_y + i ) );
+
+                __m256 x = _mm256_add_ps( _mm256_mul_ps( r[0], px ), _mm256_add_ps( _mm256_mul_ps( r[3], py ), _mm256_add_ps( _mm256_mul_ps( r[6], d ), t[0] ) ) );
+                __m256 y = _mm256_add_ps( _mm256_mul_ps( r[1], px ), _mm256_add_ps( _mm256_mul_ps( r[4], py ), _mm256_add_ps( _mm256_mul_ps( r[7], d ), t[1] ) ) );
+                __m256 z = _mm256_add_ps( _mm256_mul_ps( r[2], px ), _mm256_add_ps( _mm256_mul_ps( r[5], py ), _mm256_add_ps( _mm256_mul_ps( r[8], d ), t[2] ) ) );
+                x = _mm256_div_ps( x, z );
+                y = _mm256_div_ps( y, z );
+
+                distort< dist >( x, y, c );
+
+                // Rounded to the nearest, and zeroed where there is no depth
+                __m256 const valid = _mm256_cmp_ps( d, zero, _CMP_NEQ_UQ );
+                __m256i const u = _mm256_cvtps_epi32( _mm256_and_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, fx ), ppx ), half ), valid ) );
+                __m256i const v = _mm256_cvtps_epi32( _mm256_and_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( y, fy ), ppy ), half ), valid ) );
+
+                // Interleaved as (x, y) pairs: the unpacks work within each 128-bit half
+                __m256i const lo = _mm256_unpacklo_epi32( u, v );
+                __m256i const hi = _mm256_unpackhi_epi32( u, v );
+                __m256i * out = reinterpret_cast< __m256i * >( pixels + 2 * i );
+                _mm256_storeu_si256( out, _mm256_permute2x128_si256( lo, hi, 0x20 ) );
+                _mm256_storeu_si256( out + 1, _mm256_permute2x128_si256( lo, hi, 0x31 ) );
+            }
+            return i;
+        }
+    }
+
+    const bool align_texture_map_avx2_built = true;
+
+    size_t align_texture_map_avx2( uint16_t const * depth, float depth_scale, size_t count,
+                                   float const * map_x, float const * map_y, int32_t * pixels,
+                                   rs2_intrinsics const & to, rs2_extrinsics const & from_to_other, rs2_distortion dist )
+    {
+        switch( dist )
+        {
+        case RS2_DISTORTION_NONE:
+            return texture_map< RS2_DISTORTION_NONE >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+            return texture_map< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        case RS2_DISTORTION_BROWN_CONRADY:
+            return texture_map< RS2_DISTORTION_BROWN_CONRADY >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        default:
+            return 0;
+        }
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: align falls back to its SSE texture mapping
+    const bool align_texture_map_avx2_built = false;
+    size_t align_texture_map_avx2( uint16_t const *, float, size_t, float const *, float const *, int32_t *,
+                                   rs2_intrinsics const &, rs2_extrinsics const &, rs2_distortion ) { return 0; }
+}
+
+#endif // __AVX2__
@@ -0,0 +1,38 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // Wider versions of the SSE align's texture mapping: for each of 'count' depth pixels, the point
+    // (map_x, map_y, 1) * depth * depth_scale is transformed by 'from_to_other', distorted by 'dist' and projected
+    // into 'to', and the rounded (x, y) is written to 'pixels' - (0, 0) where the depth is 0. 'dist' is one of
+    // RS2_DISTORTION_NONE, RS2_DISTORTION_MODIFIED_BROWN_CONRADY or RS2_DISTORTION_BROWN_CONRADY, with the same
+    // arithmetic as the SSE kernels, so the pixels are the same whichever version runs.
+    // Returns how many pixels were done (a multiple of 8 or 16); the caller does the rest.
+    extern const bool align_texture_map_avx2_built;
+    size_t align_texture_map_avx2( uint16_t const * depth, float depth_scale, size_t count,
+                                   float const * map_x, float const * map_y, int32_t * pixels,
+                                   rs2_intrinsics const & to, rs2_extrinsics const & from_to_other, rs2_distortion dist );
+
+    extern const bool align_texture_map_avx512_built;
+    size_t align_texture_map_avx512( uint16_t const * depth, float depth_scale, size_t count,
+                                     float const * map_x, float const * map_y, int32_t * pixels,
+                                     rs2_intrinsics const & to, rs2_extrinsics const & from_to_other, rs2_distortion dist );
+
+    // The depth-to-other z-buffer, when each depth pixel maps to a single pixel (x, y) of 'pixels': where z is
+    // non-zero and (x, y) is inside the to_width x to_height 'dest', dest[y * to_width + x] becomes z, or stays if
+    // it already holds a smaller non-zero depth. Lanes that land on the same pixel (or on the same 32-bit pair
+    // of pixels) are found with AVX-512CD conflict detection and written one after the other, so the result is
+    // the same as the scalar loop's. Returns how many pixels were done (a multiple of 16).
+    extern const bool align_z_buffer_avx512_built;
+    size_t align_z_buffer_avx512( uint16_t const * z, int32_t const * pixels, size_t count,
+                                  uint16_t * dest, int to_width, int to_height );
+}
@@ -0,0 +1,166 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "avx-pointcloud.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>  // AVX2
+
+namespace librealsense
+{
+    namespace
+    {
+        enum class lens { none, brown_conrady, other };
+
+        // As in pointcloud_sse::get_texture_map_sse, which blends the three cases per lane; the model is the same
+        // for all pixels, so here it is chosen once
+        template< lens model >
+        inline void distort( __m256 & p_x, __m256 & p_y, __m256 const c[5] )
+        {
+            __m256 const one = _mm256_set1_ps( 1 );
+            __m256 const two = _mm256_set1_ps( 2 );
+
+            __m256 r2 = _mm256_add_ps( _mm256_mul_ps( p_x, p_x ), _mm256_mul_ps( p_y, p_y ) );
+            __m256 r3 = _mm256_add_ps( _mm256_mul_ps( c[1], _mm256_mul_ps( r2, r2 ) ),
+                                       _mm256_mul_ps( c[4], _mm256_mul_ps( r2, _mm256_mul_ps( r2, r2 ) ) ) );
+            __m256 f = _mm256_add_ps( one, _mm256_add_ps( _mm256_mul_ps( c[0], r2 ), r3 ) );
+
+            __m256 x_f = _mm256_mul_ps( p_x, f );
+            __m256 y_f = _mm256_mul_ps( p_y, f );
+            __m256 x_f_dist = model == lens::brown_conrady ? p_x : x_f;
+            __m256 y_f_dist = model == lens::brown_conrady ? p_y : y_f;
+
+            __m256 r4 = _mm256_mul_ps( c[3], _mm256_add_ps( r2, _mm256_mul_ps( two, _mm256_mul_ps( x_f_dist, x_f_dist ) ) ) );
+            __m256 r5 = _mm256_mul_ps( c[2], _mm256_add_ps( r2, _mm256_mul_ps( two, _mm256_mul_ps( y_f_dist, y_f_dist ) ) ) );
+            p_x = _mm256_add_ps( x_f, _mm256_add_ps( _mm256_mul_ps( two, _mm256_mul_ps( c[2], _mm256_mul_ps( x_f_dist, y_f_dist ) ) ), r4 ) );
+            p_y = _mm256_add_ps( y_f, _mm256_add_ps( _mm256_mul_ps( two, _mm256_mul_ps( c[3], _mm256_mul_ps( x_f_dist, y_f_dist ) ) ), r5 ) );
+        }
+
+        template<>
+        inline void distort< lens::none >( __m256 &, __m256 &, __m256 const[5] )
+        {
+        }
+
+        // Stores 8 (x, y) pairs; the unpacks work within each 128-bit half
+        inline void store_pairs( float * out, __m256 x, __m256 y )
+        {
+            __m256 const lo = _mm256_unpacklo_ps( x, y );
+            __m256 const hi = _mm256_unpackhi_ps( x, y );
+            _mm256_storeu_ps( out, _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+            _mm256_storeu_ps( out + 8, _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+        }
+
+        template< lens model >
+        size_t texture_map( float const * points, size_t count, rs2_intrinsics const & other,
+                            rs2_extrinsics const & extr, float * texture, float * pixels )
+        {
+            __m256 r[9], t[3], c[5];
+            for( int i = 0; i < 9; ++i )
+                r[i] = _mm256_set1_ps( extr.rotation[i] );
+            for( int i = 0; i < 3; ++i )
+                t[i] = _mm256_set1_ps( extr.translation[i] );
+            for( int i = 0; i < 5; ++i )
+                c[i] = _mm256_set1_ps( other.coeffs[i] );
+            __m256 const fx = _mm256_set1_ps( other.fx );
+            __m256 const fy = _mm256_set1_ps( other.fy );
+            __m256 const ppx = _mm256_set1_ps( other.ppx );
+            __m256 const ppy = _mm256_set1_ps( other.ppy );
+            __m256 const w = _mm256_set1_ps( float( other.width ) );
+            __m256 const h = _mm256_set1_ps( float( other.height ) );
+            __m256 const zero = _mm256_setzero_ps();
+
+            size_t i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                // 8 x (x, y, z), rearranged so each 128-bit half holds 4 whole points, then split as in SSE
+                __m256 const a = _mm256_loadu_ps( points + 3 * i );
+                __m256 const b = _mm256_loadu_ps( points + 3 * i + 8 );
+                __m256 const e = _mm256_loadu_ps( points + 3 * i + 16 );
+                __m256 const xyz1 = _mm256_permute2f128_ps( a, b, 0x30 );
+                __m256 const xyz2 = _mm256_permute2f128_ps( a, e, 0x21 );
+                __m256 const xyz3 = _mm256_permute2f128_ps( b, e, 0x30 );
+
+                __m256 const yz = _mm256_shuffle_ps( xyz1, xyz2, _MM_SHUFFLE( 1, 0, 2, 1 ) );
+                __m256 const xy = _mm256_shuffle_ps( xyz2, xyz3, _MM_SHUFFLE( 2, 1, 3, 2 ) );
+                __m256 const x = _mm256_shuffle_ps( xyz1, xy, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+                __m256 const y = _mm256_shuffle_ps( yz, xy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+                __m256 const z = _mm256_shuffle_ps( yz, xyz3, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+
+                __m256 p_x = _mm256_add_ps( _mm256_mul_ps( r[0], x ), _mm256_add_ps( _mm256_mul_ps( r[3], y ), _mm256_add_ps( _mm256_mul_ps( r[6], z ), t[0] ) ) );
+                __m256 p_y = _mm256_add_ps( _mm256_mul_ps( r[1], x ), _mm256_add_ps( _mm256_mul_ps( r[4], y ), _mm256_add_ps( _mm256_mul_ps( r[7], z ), t[1] ) ) );
+                __m256 p_z = _mm256_add_ps( _mm256_mul_ps( r[2], x ), _mm256_add_ps( _mm256_mul_ps( r[5], y ), _mm256_add_ps( _mm256_mul_ps( r[8], z ), t[2] ) ) );
+                p_x = _mm256_div_ps( p_x, p_z );
+                p_y = _mm256_div_ps( p_y, p_z );
+
+                distort< model >( p_x, p_y, c );
+
+                // Zeroed where there is no depth
+                __m256 const valid = _mm256_cmp_ps( z, zero, _CMP_NEQ_UQ );
+                p_x = _mm256_and_ps( _mm256_add_ps( _mm256_mul_ps( p_x, fx ), ppx ), valid );
+                p_y = _mm256_and_ps( _mm256_add_ps( _mm256_mul_ps( p_y, fy ), ppy ), valid );
+
+                store_pairs( pixels + 2 * i, p_x, p_y );
+                store_pairs( texture + 2 * i, _mm256_div_ps( p_x, w ), _mm256_div_ps( p_y, h ) );
+            }
+            return i;
+        }
+    }
+
+    const bool pointcloud_avx2_built = true;
+
+    size_t deproject_depth_avx2( uint16_t const * depth, float depth_scale, size_t count,
+                                 float const * map_x, float const * map_y, float * points )
+    {
+        __m256 const scale = _mm256_set1_ps( depth_scale );
+
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            __m128i const d16 = _mm_loadu_si128( reinterpret_cast< __m128i const * >( depth + i ) );
+            __m256 const z = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( d16 ) ), scale );
+            __m256 const x = _mm256_mul_ps( z, _mm256_loadu_ps( map_x + i ) );
+            __m256 const y = _mm256_mul_ps( z, _mm256_loadu_ps( map_y + i ) );
+
+            // Interleaved as in SSE, within each 128-bit half: 4 points -> 3 vectors
+            __m256 const x_y = _mm256_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m256 const z_x = _mm256_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+            __m256 const y_z = _mm256_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+            __m256 const xyz1 = _mm256_shuffle_ps( x_y, z_x, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            __m256 const xyz2 = _mm256_shuffle_ps( y_z, x_y, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+            __m256 const xyz3 = _mm256_shuffle_ps( z_x, y_z, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+
+            float * out = points + 3 * i;
+            _mm256_storeu_ps( out, _mm256_permute2f128_ps( xyz1, xyz2, 0x20 ) );
+            _mm256_storeu_ps( out + 8, _mm256_permute2f128_ps( xyz3, xyz1, 0x30 ) );
+            _mm256_storeu_ps( out + 16, _mm256_permute2f128_ps( xyz2, xyz3, 0x31 ) );
+        }
+        return i;
+    }
+
+    size_t get_texture_map_avx2( float const * points, size_t count, rs2_intrinsics const & other,
+                                 rs2_extrinsics const & extr, float * texture, float * pixels )
+    {
+        switch( other.model )
+        {
+        case RS2_DISTORTION_NONE:
+            return texture_map< lens::none >( points, count, other, extr, texture, pixels );
+        case RS2_DISTORTION_BROWN_CONRADY:
+            return texture_map< lens::brown_conrady >( points, count, other, extr, texture, pixels );
+        default:
+            return texture_map< lens::other >( points, count, other, extr, texture, pixels );
+        }
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the pointcloud falls back to SSE
+    const bool pointcloud_avx2_built = false;
+    size_t deproject_depth_avx2( uint16_t const *, float, size_t, float const *, float const *, float * ) { return 0; }
+    size_t get_texture_map_avx2( float const *, size_t, rs2_intrinsics const &, rs2_extrinsics const &, float *, float * ) { return 0; }
+}
+
+#endif // __AVX2__
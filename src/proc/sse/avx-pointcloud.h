@@ -0,0 +1,33 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // Wider versions of pointcloud_sse's loops, with the same arithmetic so the clouds are the same whichever
+    // version runs. Each returns how many pixels it did (a multiple of 8 or 16), leaving the rest to the caller.
+    //
+    // Deprojection: each depth pixel i becomes the vertex (map_x[i], map_y[i], 1) * depth[i] * depth_scale,
+    // written as x, y, z floats to 'points'; map_x and map_y are the per-pixel rays of the depth intrinsics.
+    //
+    // Texture mapping: each vertex is transformed by 'extr' and projected into 'other', writing its pixel
+    // (x, y) to 'pixels' and the same divided by the image size to 'texture' - both (0, 0) where z is 0.
+    extern const bool pointcloud_avx2_built;
+    size_t deproject_depth_avx2( uint16_t const * depth, float depth_scale, size_t count,
+                                 float const * map_x, float const * map_y, float * points );
+    size_t get_texture_map_avx2( float const * points, size_t count, rs2_intrinsics const & other,
+                                 rs2_extrinsics const & extr, float * texture, float * pixels );
+
+    extern const bool pointcloud_avx512_built;
+    size_t deproject_depth_avx512( uint16_t const * depth, float depth_scale, size_t count,
+                                   float const * map_x, float const * map_y, float * points );
+    size_t get_texture_map_avx512( float const * points, size_t count, rs2_intrinsics const & other,
+                                   rs2_extrinsics const & extr, float * texture, float * pixels );
+}
@@ -0,0 +1,56 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+
+#ifdef __AVX2__
+
+#include "sse-spatial-filter-kernels.h"
+#include <immintrin.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        struct avx2
+        {
+            // a * alpha + b * (1 - alpha), rounded the way the scalar passes round it; all 8 lanes at once
+            static __m128i lerp( __m128i a, __m128i b, constants const & k )
+            {
+                __m256 const alpha = _mm256_broadcast_ps( &k.alpha );
+                __m256 const one_minus_alpha = _mm256_broadcast_ps( &k.one_minus_alpha );
+                __m256 const round = _mm256_broadcast_ps( &k.round );
+
+                __m256 af = _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( a ) );
+                __m256 bf = _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( b ) );
+                __m256i filtered = _mm256_cvttps_epi32(
+                    _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( af, alpha ), _mm256_mul_ps( bf, one_minus_alpha ) ), round ) );
+                return _mm_packus_epi32( _mm256_castsi256_si128( filtered ), _mm256_extracti128_si256( filtered, 1 ) );
+            }
+        };
+    }
+
+    const bool z16_domain_transform_avx2_built = true;
+
+    void z16_domain_transform_horizontal_avx2( z16_domain_transform const & dt, size_t row_begin, size_t row_end )
+    {
+        domain_transform_horizontal< avx2 >( dt, row_begin, row_end );
+    }
+
+    void z16_domain_transform_vertical_avx2( z16_domain_transform const & dt, size_t col_begin, size_t col_end )
+    {
+        domain_transform_vertical< avx2 >( dt, col_begin, col_end );
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the spatial filter falls back to SSE4.1 or its scalar passes
+    const bool z16_domain_transform_avx2_built = false;
+    void z16_domain_transform_horizontal_avx2( z16_domain_transform const &, size_t, size_t ) {}
+    void z16_domain_transform_vertical_avx2( z16_domain_transform const &, size_t, size_t ) {}
+}
+
+#endif // __AVX2__
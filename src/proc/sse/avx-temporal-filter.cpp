@@ -0,0 +1,109 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "../temporal-filter-simd.h"
+
+#ifdef __AVX2__
+
+#include "../temporal-filter-kernels.h"
+#include <immintrin.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        struct avx2
+        {
+            struct constants
+            {
+                __m256i zero, ones, one, weights, delta_z, lane_bits;
+                bool full_weight;  // alpha == 1, which does not fit the 16-bit multiplier
+
+                explicit constants( z16_temporal_smoothing const & ts )
+                    : zero( _mm256_setzero_si256() )
+                    , ones( _mm256_set1_epi16( -1 ) )
+                    , one( _mm256_set1_epi16( 1 ) )
+                    , weights( _mm256_set1_epi32( ( TEMPORAL_BLEND_BIAS << 16 ) | ( ts.alpha & 0x7fff ) ) )
+                    , delta_z( _mm256_set1_epi16( short( ts.delta_z ) ) )
+                    , lane_bits( _mm256_setr_epi16( 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192,
+                                                    16384, short( 32768 ) ) )
+                    , full_weight( ts.alpha >= 32768 )
+                {
+                }
+            };
+
+            // 2 x 16 lane masks -> 32 bits; the pack works within 128-bit halves, hence the permute
+            static uint32_t to_bits( __m256i const m[2] )
+            {
+                __m256i packed = _mm256_permute4x64_epi64( _mm256_packs_epi16( m[0], m[1] ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+                return uint32_t( _mm256_movemask_epi8( packed ) );
+            }
+
+            static group_masks smooth( uint16_t * frame, uint16_t * last_frame, constants const & k )
+            {
+                __m256i valid[2], agree[2], last_valid[2];
+                for( int j = 0; j < 2; ++j )
+                {
+                    auto f = reinterpret_cast< __m256i * >( frame + 16 * j );
+                    auto l = reinterpret_cast< __m256i * >( last_frame + 16 * j );
+                    __m256i cur = _mm256_loadu_si256( f );
+                    __m256i prev = _mm256_loadu_si256( l );
+
+                    valid[j] = _mm256_xor_si256( _mm256_cmpeq_epi16( cur, k.zero ), k.ones );
+                    last_valid[j] = _mm256_xor_si256( _mm256_cmpeq_epi16( prev, k.zero ), k.ones );
+                    __m256i diff = _mm256_sub_epi16( _mm256_max_epu16( cur, prev ), _mm256_min_epu16( cur, prev ) );
+                    __m256i close = _mm256_xor_si256( _mm256_cmpeq_epi16( _mm256_max_epu16( diff, k.delta_z ), diff ), k.ones );
+                    agree[j] = _mm256_and_si256( _mm256_and_si256( valid[j], last_valid[j] ), close );
+
+                    // prev + alpha * (cur - prev): (diff, 1) pairs times (alpha, bias) pairs; the unpacks and
+                    // the pack work within 128-bit halves, so the pixel order is kept
+                    __m256i filtered = cur;
+                    if( ! k.full_weight )
+                    {
+                        __m256i diff = _mm256_sub_epi16( cur, prev );
+                        __m256i lo = _mm256_madd_epi16( _mm256_unpacklo_epi16( diff, k.one ), k.weights );
+                        __m256i hi = _mm256_madd_epi16( _mm256_unpackhi_epi16( diff, k.one ), k.weights );
+                        __m256i step = _mm256_packs_epi32( _mm256_srai_epi32( lo, 15 ), _mm256_srai_epi32( hi, 15 ) );
+                        filtered = _mm256_add_epi16( prev, step );
+                    }
+
+                    _mm256_storeu_si256( f, _mm256_blendv_epi8( cur, filtered, agree[j] ) );
+                    _mm256_storeu_si256( l, _mm256_blendv_epi8( _mm256_blendv_epi8( prev, cur, valid[j] ), filtered, agree[j] ) );
+                }
+                return { to_bits( valid ), to_bits( agree ), to_bits( last_valid ) };
+            }
+
+            static void fill( uint16_t * frame, uint16_t const * last_frame, uint32_t pixels, constants const & k )
+            {
+                for( int j = 0; j < 2; ++j, pixels >>= 16 )
+                {
+                    if( ! ( pixels & 0xffff ) )
+                        continue;
+                    auto f = reinterpret_cast< __m256i * >( frame + 16 * j );
+                    __m256i lanes = _mm256_and_si256( _mm256_set1_epi16( short( pixels & 0xffff ) ), k.lane_bits );
+                    __m256i mask = _mm256_cmpeq_epi16( lanes, k.lane_bits );
+                    __m256i prev = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( last_frame + 16 * j ) );
+                    _mm256_storeu_si256( f, _mm256_blendv_epi8( _mm256_loadu_si256( f ), prev, mask ) );
+                }
+            }
+        };
+    }
+
+    const bool z16_temporal_smoothing_avx2_built = true;
+
+    void z16_temporal_smoothing_avx2( z16_temporal_smoothing const & ts )
+    {
+        temporal_smooth< avx2 >( ts );
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the temporal filter falls back to SSE4.1 or its scalar version
+    const bool z16_temporal_smoothing_avx2_built = false;
+    void z16_temporal_smoothing_avx2( z16_temporal_smoothing const & ) {}
+}
+
+#endif // __AVX2__
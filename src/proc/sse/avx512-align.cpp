@@ -0,0 +1,214 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "avx-align.h"
+
+#if defined( __AVX512F__ ) && defined( __AVX512CD__ )
+
+#include <immintrin.h>  // AVX-512F, AVX-512CD
+
+#include <algorithm>
+
+namespace librealsense
+{
+    namespace
+    {
+        // The same operations, in the same order, as distorte_x_y() in sse-align.cpp (and, for Brown-Conrady, as
+        // rs2_project_point_to_pixel); this file is built without FMA contraction so they also round the same
+        template< rs2_distortion dist >
+        inline void distort( __m512 &, __m512 &, __m512 const[5] )
+        {
+        }
+
+        template<>
+        inline void distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( __m512 & x, __m512 & y, __m512 const c[5] )
+        {
+            __m512 const one = _mm512_set1_ps( 1 );
+            __m512 const two = _mm512_set1_ps( 2 );
+
+            __m512 r2 = _mm512_add_ps( _mm512_mul_ps( x, x ), _mm512_mul_ps( y, y ) );
+            __m512 r3 = _mm512_add_ps( _mm512_mul_ps( c[1], _mm512_mul_ps( r2, r2 ) ),
+                                       _mm512_mul_ps( c[4], _mm512_mul_ps( r2, _mm512_mul_ps( r2, r2 ) ) ) );
+            __m512 f = _mm512_add_ps( one, _mm512_add_ps( _mm512_mul_ps( c[0], r2 ), r3 ) );
+
+            __m512 x_f = _mm512_mul_ps( x, f );
+            __m512 y_f = _mm512_mul_ps( y, f );
+
+            __m512 r4 = _mm512_mul_ps( c[3], _mm512_add_ps( r2, _mm512_mul_ps( two, _mm512_mul_ps( x_f, x_f ) ) ) );
+            x = _mm512_add_ps( x_f, _mm512_add_ps( _mm512_mul_ps( two, _mm512_mul_ps( c[2], _mm512_mul_ps( x_f, y_f ) ) ), r4 ) );
+            y = _mm512_add_ps( y_f, _mm512_add_ps( _mm512_mul_ps( two, _mm512_mul_ps( c[3], _mm512_mul_ps( x_f, y_f ) ) ), r4 ) );
+        }
+
+        template<>
+        inline void distort< RS2_DISTORTION_BROWN_CONRADY >( __m512 & x, __m512 & y, __m512 const c[5] )
+        {
+            __m512 const one = _mm512_set1_ps( 1 );
+            __m512 const two = _mm512_set1_ps( 2 );
+
+            __m512 r2 = _mm512_add_ps( _mm512_mul_ps( x, x ), _mm512_mul_ps( y, y ) );
+            __m512 f = _mm512_add_ps( _mm512_add_ps( _mm512_add_ps( one, _mm512_mul_ps( c[0], r2 ) ),
+                                                     _mm512_mul_ps( _mm512_mul_ps( c[1], r2 ), r2 ) ),
+                                      _mm512_mul_ps( _mm512_mul_ps( _mm512_mul_ps( c[4], r2 ), r2 ), r2 ) );
+            __m512 dx = _mm512_add_ps( _mm512_add_ps( _mm512_mul_ps( x, f ), _mm512_mul_ps( _mm512_mul_ps( _mm512_mul_ps( two, c[2] ), x ), y ) ),
+                                       _mm512_mul_ps( c[3], _mm512_add_ps( r2, _mm512_mul_ps( _mm512_mul_ps( two, x ), x ) ) ) );
+            __m512 dy = _mm512_add_ps( _mm512_add_ps( _mm512_mul_ps( y, f ), _mm512_mul_ps( _mm512_mul_ps( _mm512_mul_ps( two, c[3] ), x ), y ) ),
+                                       _mm512_mul_ps( c[2], _mm512_add_ps( r2, _mm512_mul_ps( _mm512_mul_ps( two, y ), y ) ) ) );
+            x = dx;
+            y = dy;
+        }
+
+        template< rs2_distortion dist >
+        size_t texture_map( uint16_t const * depth, float depth_scale, size_t count, float const * map_x,
+                            float const * map_y, int32_t * pixels, rs2_intrinsics const & to,
+                            rs2_extrinsics const & from_to_other )
+        {
+            __m512 r[9], t[3], c[5];
+            for( int i = 0; i < 9; ++i )
+                r[i] = _mm512_set1_ps( from_to_other.rotation[i] );
+            for( int i = 0; i < 3; ++i )
+                t[i] = _mm512_set1_ps( from_to_other.translation[i] );
+            for( int i = 0; i < 5; ++i )
+                c[i] = _mm512_set1_ps( to.coeffs[i] );
+            __m512 const scale = _mm512_set1_ps( depth_scale );
+            __m512 const zero = _mm512_setzero_ps();
+            __m512 const half = _mm512_set1_ps( 0.5f );
+            __m512 const fx = _mm512_set1_ps( to.fx );
+            __m512 const fy = _mm512_set1_ps( to.fy );
+            __m512 const ppx = _mm512_set1_ps( to.ppx );
+            __m512 const ppy = _mm512_set1_ps( to.ppy );
+            __m512i const first_half = _mm512_setr_epi64( 0, 1, 8, 9, 2, 3, 10, 11 );
+            __m512i const second_half = _mm512_setr_epi64( 4, 5, 12, 13, 6, 7, 14, 15 );
+
+            size_t i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                __m256i const d16 = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( depth + i ) );
+                __m512 const d = _mm512_mul_ps( _mm512_cvtepi32_ps( _mm512_cvtepu16_epi32( d16 ) ), scale );
+                __m512 const px = _mm512_mul_ps( d, _mm512_loadu_ps( map_x + i ) );
+                __m512 const py = _mm512_mul_ps( d, _mm512_loadu_ps( map_y + i ) );
+
+                __m512 x = _mm512_add_ps( _mm512_mul_ps( r[0], px ), _mm512_add_ps( _mm512_mul_ps( r[3], py ), _mm512_add_ps( _mm512_mul_ps( r[6], d ), t[0] ) ) );
+                __m512 y = _mm512_add_ps( _mm512_mul_ps( r[1], px ), _mm512_add_ps( _mm512_mul_ps( r[4], py ), _mm512_add_ps( _mm512_mul_ps( r[7], d ), t[1] ) ) );
+                __m512 z = _mm512_add_ps( _mm512_mul_ps( r[2], px ), _mm512_add_ps( _mm512_mul_ps( r[5], py ), _mm512_add_ps( _mm512_mul_ps( r[8], d ), t[2] ) ) );
+                x = _mm512_div_ps( x, z );
+                y = _mm512_div_ps( y, z );
+
+                distort< dist >( x, y, c );
+
+                // Rounded to the nearest, and zeroed where there is no depth
+                __mmask16 const valid = _mm512_cmp_ps_mask( d, zero, _CMP_NEQ_UQ );
+                __m512i const u = _mm512_cvtps_epi32( _mm512_maskz_add_ps( valid, _mm512_add_ps( _mm512_mul_ps( x, fx ), ppx ), half ) );
+                __m512i const v = _mm512_cvtps_epi32( _mm512_maskz_add_ps( valid, _mm512_add_ps( _mm512_mul_ps( y, fy ), ppy ), half ) );
+
+                // Interleaved as (x, y) pairs: the unpacks work within each 128-bit quarter
+                __m512i const lo = _mm512_unpacklo_epi32( u, v );
+                __m512i const hi = _mm512_unpackhi_epi32( u, v );
+                __m512i * out = reinterpret_cast< __m512i * >( pixels + 2 * i );
+                _mm512_storeu_si512( out, _mm512_permutex2var_epi64( lo, first_half, hi ) );
+                _mm512_storeu_si512( out + 1, _mm512_permutex2var_epi64( lo, second_half, hi ) );
+            }
+            return i;
+        }
+    }
+
+
+    const bool align_texture_map_avx512_built = true;
+
+    size_t align_texture_map_avx512( uint16_t const * depth, float depth_scale, size_t count,
+                                     float const * map_x, float const * map_y, int32_t * pixels,
+                                     rs2_intrinsics const & to, rs2_extrinsics const & from_to_other, rs2_distortion dist )
+    {
+        switch( dist )
+        {
+        case RS2_DISTORTION_NONE:
+            return texture_map< RS2_DISTORTION_NONE >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+            return texture_map< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        case RS2_DISTORTION_BROWN_CONRADY:
+            return texture_map< RS2_DISTORTION_BROWN_CONRADY >( depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other );
+        default:
+            return 0;
+        }
+    }
+
+    const bool align_z_buffer_avx512_built = true;
+
+    size_t align_z_buffer_avx512( uint16_t const * z, int32_t const * pixels, size_t count,
+                                  uint16_t * dest, int to_width, int to_height )
+    {
+        __m512i const even = _mm512_setr_epi32( 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 );
+        __m512i const odd = _mm512_add_epi32( even, _mm512_set1_epi32( 1 ) );
+        __m512i const width = _mm512_set1_epi32( to_width );
+        __m512i const height = _mm512_set1_epi32( to_height );
+        __m512i const size = _mm512_set1_epi32( to_width * to_height );
+        __m512i const one = _mm512_set1_epi32( 1 );
+        __m512i const low_half = _mm512_set1_epi32( 0xFFFF );
+        int * words = reinterpret_cast< int * >( dest );
+
+        size_t i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            __m512i const a = _mm512_loadu_si512( pixels + 2 * i );
+            __m512i const b = _mm512_loadu_si512( pixels + 2 * i + 16 );
+            __m512i const x = _mm512_permutex2var_epi32( a, even, b );
+            __m512i const y = _mm512_permutex2var_epi32( a, odd, b );
+            __m512i const depth = _mm512_cvtepu16_epi32( _mm256_loadu_si256( reinterpret_cast< __m256i const * >( z + i ) ) );
+
+            // Unsigned compares also reject negative coordinates
+            __mmask16 todo = _mm512_test_epi32_mask( depth, depth )
+                           & _mm512_cmplt_epu32_mask( x, width ) & _mm512_cmplt_epu32_mask( y, height );
+            if( ! todo )
+                continue;
+
+            // Pixels are written as part of the 32-bit word holding them; the last pixel of an image of odd size
+            // has no full word, and is written on its own below
+            __m512i const index = _mm512_add_epi32( _mm512_mullo_epi32( y, width ), x );
+            __mmask16 const no_word = _mm512_mask_cmpge_epu32_mask( todo, _mm512_or_si512( index, one ), size );
+            todo &= ~no_word;
+
+            __m512i const word = _mm512_srli_epi32( index, 1 );
+            __m512i const shift = _mm512_slli_epi32( _mm512_and_si512( index, one ), 4 );
+            __m512i const conflicts = _mm512_conflict_epi32( word );
+            while( todo )
+            {
+                // Lanes with no earlier pending lane on the same word can be written together
+                __m512i const pending = _mm512_and_si512( conflicts, _mm512_set1_epi32( todo ) );
+                __mmask16 const ready = _mm512_mask_testn_epi32_mask( todo, pending, pending );
+
+                __m512i const current = _mm512_mask_i32gather_epi32( _mm512_setzero_si512(), ready, word, words, 4 );
+                __m512i const old_z = _mm512_and_si512( _mm512_srlv_epi32( current, shift ), low_half );
+                __mmask16 const empty = _mm512_testn_epi32_mask( old_z, old_z );
+                __m512i const new_z = _mm512_mask_mov_epi32( _mm512_min_epu32( old_z, depth ), empty, depth );
+                __m512i const updated = _mm512_or_si512( _mm512_andnot_si512( _mm512_sllv_epi32( low_half, shift ), current ),
+                                                         _mm512_sllv_epi32( new_z, shift ) );
+                _mm512_mask_i32scatter_epi32( words, ready, word, updated, 4 );
+                todo &= ~ready;
+            }
+
+            if( no_word )
+            {
+                int32_t last[16];
+                _mm512_storeu_si512( last, index );
+                for( int lane = 0; lane < 16; ++lane )
+                    if( no_word & ( 1 << lane ) )
+                        dest[last[lane]] = dest[last[lane]] ? std::min( dest[last[lane]], z[i + lane] ) : z[i + lane];
+            }
+        }
+        return i;
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: align falls back to its AVX2 or SSE texture mapping, and to the scalar z-buffer
+    const bool align_texture_map_avx512_built = false;
+    size_t align_texture_map_avx512( uint16_t const *, float, size_t, float const *, float const *, int32_t *,
+                                     rs2_intrinsics const &, rs2_extrinsics const &, rs2_distortion ) { return 0; }
+
+    const bool align_z_buffer_avx512_built = false;
+    size_t align_z_buffer_avx512( uint16_t const *, int32_t const *, size_t, uint16_t *, int, int ) { return 0; }
+}
+
+#endif // __AVX512F__ && __AVX512CD__
@@ -0,0 +1,173 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "avx-pointcloud.h"
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>  // AVX-512F
+
+namespace librealsense
+{
+    namespace
+    {
+        enum class lens { none, brown_conrady, other };
+
+        // As in pointcloud_sse::get_texture_map_sse, which blends the three cases per lane; the model is the same
+        // for all pixels, so here it is chosen once. This file is built without FMA contraction, so the results
+        // round the same too.
+        template< lens model >
+        inline void distort( __m512 & p_x, __m512 & p_y, __m512 const c[5] )
+        {
+            __m512 const one = _mm512_set1_ps( 1 );
+            __m512 const two = _mm512_set1_ps( 2 );
+
+            __m512 r2 = _mm512_add_ps( _mm512_mul_ps( p_x, p_x ), _mm512_mul_ps( p_y, p_y ) );
+            __m512 r3 = _mm512_add_ps( _mm512_mul_ps( c[1], _mm512_mul_ps( r2, r2 ) ),
+                                       _mm512_mul_ps( c[4], _mm512_mul_ps( r2, _mm512_mul_ps( r2, r2 ) ) ) );
+            __m512 f = _mm512_add_ps( one, _mm512_add_ps( _mm512_mul_ps( c[0], r2 ), r3 ) );
+
+            __m512 x_f = _mm512_mul_ps( p_x, f );
+            __m512 y_f = _mm512_mul_ps( p_y, f );
+            __m512 x_f_dist = model == lens::brown_conrady ? p_x : x_f;
+            __m512 y_f_dist = model == lens::brown_conrady ? p_y : y_f;
+
+            __m512 r4 = _mm512_mul_ps( c[3], _mm512_add_ps( r2, _mm512_mul_ps( two, _mm512_mul_ps( x_f_dist, x_f_dist ) ) ) );
+            __m512 r5 = _mm512_mul_ps( c[2], _mm512_add_ps( r2, _mm512_mul_ps( two, _mm512_mul_ps( y_f_dist, y_f_dist ) ) ) );
+            p_x = _mm512_add_ps( x_f, _mm512_add_ps( _mm512_mul_ps( two, _mm512_mul_ps( c[2], _mm512_mul_ps( x_f_dist, y_f_dist ) ) ), r4 ) );
+            p_y = _mm512_add_ps( y_f, _mm512_add_ps( _mm512_mul_ps( two, _mm512_mul_ps( c[3], _mm512_mul_ps( x_f_dist, y_f_dist ) ) ), r5 ) );
+        }
+
+        template<>
+        inline void distort< lens::none >( __m512 &, __m512 &, __m512 const[5] )
+        {
+        }
+
+        // Stores 16 (x, y) pairs; the unpacks work within each 128-bit quarter
+        inline void store_pairs( float * out, __m512 x, __m512 y )
+        {
+            __m512i const first_half = _mm512_setr_epi64( 0, 1, 8, 9, 2, 3, 10, 11 );
+            __m512i const second_half = _mm512_setr_epi64( 4, 5, 12, 13, 6, 7, 14, 15 );
+            __m512d const lo = _mm512_castps_pd( _mm512_unpacklo_ps( x, y ) );
+            __m512d const hi = _mm512_castps_pd( _mm512_unpackhi_ps( x, y ) );
+            _mm512_storeu_ps( out, _mm512_castpd_ps( _mm512_permutex2var_pd( lo, first_half, hi ) ) );
+            _mm512_storeu_ps( out + 16, _mm512_castpd_ps( _mm512_permutex2var_pd( lo, second_half, hi ) ) );
+        }
+
+        // Gathers one coordinate of 16 (x, y, z) points out of three vectors: the first permute picks those in
+        // the first two, the second those in the third
+        inline __m512 deinterleave( __m512 a, __m512 b, __m512 c, __m512i first, __m512i second )
+        {
+            return _mm512_permutex2var_ps( _mm512_permutex2var_ps( a, first, b ), second, c );
+        }
+
+        template< lens model >
+        size_t texture_map( float const * points, size_t count, rs2_intrinsics const & other,
+                            rs2_extrinsics const & extr, float * texture, float * pixels )
+        {
+            __m512 r[9], t[3], c[5];
+            for( int i = 0; i < 9; ++i )
+                r[i] = _mm512_set1_ps( extr.rotation[i] );
+            for( int i = 0; i < 3; ++i )
+                t[i] = _mm512_set1_ps( extr.translation[i] );
+            for( int i = 0; i < 5; ++i )
+                c[i] = _mm512_set1_ps( other.coeffs[i] );
+            __m512 const fx = _mm512_set1_ps( other.fx );
+            __m512 const fy = _mm512_set1_ps( other.fy );
+            __m512 const ppx = _mm512_set1_ps( other.ppx );
+            __m512 const ppy = _mm512_set1_ps( other.ppy );
+            __m512 const w = _mm512_set1_ps( float( other.width ) );
+            __m512 const h = _mm512_set1_ps( float( other.height ) );
+            __m512 const zero = _mm512_setzero_ps();
+            __m512i const x_first = _mm512_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0 );
+            __m512i const x_second = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29 );
+            __m512i const y_first = _mm512_setr_epi32( 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0 );
+            __m512i const y_second = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30 );
+            __m512i const z_first = _mm512_setr_epi32( 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0 );
+            __m512i const z_second = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31 );
+
+            size_t i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                __m512 const a = _mm512_loadu_ps( points + 3 * i );
+                __m512 const b = _mm512_loadu_ps( points + 3 * i + 16 );
+                __m512 const e = _mm512_loadu_ps( points + 3 * i + 32 );
+                __m512 const x = deinterleave( a, b, e, x_first, x_second );
+                __m512 const y = deinterleave( a, b, e, y_first, y_second );
+                __m512 const z = deinterleave( a, b, e, z_first, z_second );
+
+                __m512 p_x = _mm512_add_ps( _mm512_mul_ps( r[0], x ), _mm512_add_ps( _mm512_mul_ps( r[3], y ), _mm512_add_ps( _mm512_mul_ps( r[6], z ), t[0] ) ) );
+                __m512 p_y = _mm512_add_ps( _mm512_mul_ps( r[1], x ), _mm512_add_ps( _mm512_mul_ps( r[4], y ), _mm512_add_ps( _mm512_mul_ps( r[7], z ), t[1] ) ) );
+                __m512 p_z = _mm512_add_ps( _mm512_mul_ps( r[2], x ), _mm512_add_ps( _mm512_mul_ps( r[5], y ), _mm512_add_ps( _mm512_mul_ps( r[8], z ), t[2] ) ) );
+                p_x = _mm512_div_ps( p_x, p_z );
+                p_y = _mm512_div_ps( p_y, p_z );
+
+                distort< model >( p_x, p_y, c );
+
+                // Zeroed where there is no depth
+                __mmask16 const valid = _mm512_cmp_ps_mask( z, zero, _CMP_NEQ_UQ );
+                p_x = _mm512_maskz_add_ps( valid, _mm512_mul_ps( p_x, fx ), ppx );
+                p_y = _mm512_maskz_add_ps( valid, _mm512_mul_ps( p_y, fy ), ppy );
+
+                store_pairs( pixels + 2 * i, p_x, p_y );
+                store_pairs( texture + 2 * i, _mm512_div_ps( p_x, w ), _mm512_div_ps( p_y, h ) );
+            }
+            return i;
+        }
+    }
+
+    const bool pointcloud_avx512_built = true;
+
+    size_t deproject_depth_avx512( uint16_t const * depth, float depth_scale, size_t count,
+                                 float const * map_x, float const * map_y, float * points )
+    {
+        __m512 const scale = _mm512_set1_ps( depth_scale );
+        __m512i const first[3] = { _mm512_setr_epi32( 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5 ),
+                                   _mm512_setr_epi32( 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26 ),
+                                   _mm512_setr_epi32( 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0 ) };
+        __m512i const second[3] = { _mm512_setr_epi32( 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15 ),
+                                    _mm512_setr_epi32( 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15 ),
+                                    _mm512_setr_epi32( 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31 ) };
+
+        size_t i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            __m256i const d16 = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( depth + i ) );
+            __m512 const z = _mm512_mul_ps( _mm512_cvtepi32_ps( _mm512_cvtepu16_epi32( d16 ) ), scale );
+            __m512 const x = _mm512_mul_ps( z, _mm512_loadu_ps( map_x + i ) );
+            __m512 const y = _mm512_mul_ps( z, _mm512_loadu_ps( map_y + i ) );
+
+            // 16 points -> 3 vectors of x, y, z: x and y interleaved first, then z slotted in
+            float * out = points + 3 * i;
+            for( int k = 0; k < 3; ++k )
+                _mm512_storeu_ps( out + 16 * k, _mm512_permutex2var_ps( _mm512_permutex2var_ps( x, first[k], y ), second[k], z ) );
+        }
+        return i;
+    }
+
+    size_t get_texture_map_avx512( float const * points, size_t count, rs2_intrinsics const & other,
+                                 rs2_extrinsics const & extr, float * texture, float * pixels )
+    {
+        switch( other.model )
+        {
+        case RS2_DISTORTION_NONE:
+            return texture_map< lens::none >( points, count, other, extr, texture, pixels );
+        case RS2_DISTORTION_BROWN_CONRADY:
+            return texture_map< lens::brown_conrady >( points, count, other, extr, texture, pixels );
+        default:
+            return texture_map< lens::other >( points, count, other, extr, texture, pixels );
+        }
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the pointcloud falls back to AVX2 or SSE
+    const bool pointcloud_avx512_built = false;
+    size_t deproject_depth_avx512( uint16_t const *, float, size_t, float const *, float const *, float * ) { return 0; }
+    size_t get_texture_map_avx512( float const *, size_t, rs2_intrinsics const &, rs2_extrinsics const &, float *, float * ) { return 0; }
+}
+
+#endif // __AVX512F__
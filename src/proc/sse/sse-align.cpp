@@ -3,12 +3,14 @@
 #ifdef __SSSE3__
 
 #include "sse-align.h"
+#include "avx-align.h"
 #include <tmmintrin.h> // For SSE3 intrinsic used in unpack_yuy2_sse
 #include "../include/librealsense2/hpp/rs_sensor.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
+#include "proc/color-formats-converter.h"
 #include "environment.h"
 #include "stream.h"
 
@@ -57,6 +59,30 @@ inline void distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(const __m128& x,
     *distorted_x = d_x0;
     *distorted_y = d_y0;
 }
+template<>
+inline void distorte_x_y<RS2_DISTORTION_BROWN_CONRADY>(const __m128& x, const __m128& y, __m128* distorted_x, __m128* distorted_y, const rs2_intrinsics& to)
+{
+    __m128 c[5];
+    auto one = _mm_set_ps1(1);
+    auto two = _mm_set_ps1(2);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        c[i] = _mm_set_ps1(to.coeffs[i]);
+    }
+    // As in rs2_project_point_to_pixel
+    auto r2 = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+    auto f = _mm_add_ps(_mm_add_ps(_mm_add_ps(one, _mm_mul_ps(c[0], r2)), _mm_mul_ps(_mm_mul_ps(c[1], r2), r2)),
+        _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(c[4], r2), r2), r2));
+
+    auto d_x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(two, c[2]), x), y)),
+        _mm_mul_ps(c[3], _mm_add_ps(r2, _mm_mul_ps(_mm_mul_ps(two, x), x))));
+    auto d_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(two, c[3]), x), y)),
+        _mm_mul_ps(c[2], _mm_add_ps(r2, _mm_mul_ps(_mm_mul_ps(two, y), y))));
+
+    *distorted_x = d_x;
+    *distorted_y = d_y;
+}
 
 
 template<rs2_distortion dist>
@@ -193,6 +219,32 @@ inline void get_texture_map_sse(const uint16_t * depth,
     }
 }
 
+// Maps as many pixels as the widest instruction set the CPU has can, and the rest with SSE
+template<rs2_distortion dist>
+inline void get_texture_map(const uint16_t * depth,
+    float depth_scale,
+    const unsigned int size,
+    const float * pre_compute_x, const float * pre_compute_y,
+    byte * pixels_ptr_int,
+    const rs2_intrinsics& to,
+    const rs2_extrinsics& from_to_other)
+{
+    static const bool avx512 = align_texture_map_avx512_built && has_avx512();
+    static const bool avx2 = align_texture_map_avx2_built && has_avx2();
+
+    auto pixels = reinterpret_cast<int32_t*>(pixels_ptr_int);
+    size_t done = 0;
+    if (avx512)
+        done = align_texture_map_avx512(depth, depth_scale, size, pre_compute_x, pre_compute_y, pixels, to, from_to_other, dist);
+    else if (avx2)
+        done = align_texture_map_avx2(depth, depth_scale, size, pre_compute_x, pre_compute_y, pixels, to, from_to_other, dist);
+
+    // What is left starts 16-byte aligned, as the SSE loads and stores need
+    if (done < size)
+        get_texture_map_sse<dist>(depth + done, depth_scale, static_cast<unsigned int>(size - done), pre_compute_x + done,
+            pre_compute_y + done, reinterpret_cast<byte*>(pixels + 2 * done), to, from_to_other);
+}
+
 image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
     :_depth(from),
     _depth_scale(depth_scale),
@@ -247,6 +299,9 @@ void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* d
     case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
         align_depth_to_other_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, dest, depth, to, from_to_other);
         break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        align_depth_to_other_sse<RS2_DISTORTION_BROWN_CONRADY>(z_pixels, dest, depth, to, from_to_other);
+        break;
     default:
         align_depth_to_other_sse(z_pixels, dest, depth, to, from_to_other);
         break;
@@ -257,24 +312,27 @@ inline void image_transform::move_depth_to_other(const uint16_t* z_pixels, uint1
     const std::vector<librealsense::int2>& pixel_top_left_int,
     const std::vector<librealsense::int2>& pixel_bottom_right_int)
 {
-    for (int y = 0; y < _depth.height; ++y)
+    // When each depth pixel maps to a single pixel, 16 of them can go to the z-buffer at once
+    static const bool avx512 = align_z_buffer_avx512_built && has_avx512();
+    int done = 0;
+    if (avx512 && &pixel_top_left_int == &pixel_bottom_right_int)
+        done = static_cast<int>(align_z_buffer_avx512(z_pixels, reinterpret_cast<const int32_t*>(pixel_top_left_int.data()),
+            pixel_top_left_int.size(), dest, to.width, to.height));
+
+    for (int depth_pixel_index = done; depth_pixel_index < _depth.height * _depth.width; ++depth_pixel_index)
     {
-        for (int x = 0; x < _depth.width; ++x)
+        // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+        if (z_pixels[depth_pixel_index])
         {
-            auto depth_pixel_index = y * _depth.width + x;
-            // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-            if (z_pixels[depth_pixel_index])
+            for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
             {
-                for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
+                for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
                 {
-                    for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
-                    {
-                        if (other_x < 0 || other_y < 0 || other_x >= to.width || other_y >= to.height)
-                            continue;
-                        auto other_ind = other_y * to.width + other_x;
+                    if (other_x < 0 || other_y < 0 || other_x >= to.width || other_y >= to.height)
+                        continue;
+                    auto other_ind = other_y * to.width + other_x;
 
-                        dest[other_ind] = dest[other_ind] ? std::min(dest[other_ind], z_pixels[depth_pixel_index]) : z_pixels[depth_pixel_index];
-                    }
+                    dest[other_ind] = dest[other_ind] ? std::min(dest[other_ind], z_pixels[depth_pixel_index]) : z_pixels[depth_pixel_index];
                 }
             }
         }
@@ -290,6 +348,9 @@ void image_transform::align_other_to_depth(const uint16_t* z_pixels, const byte*
     case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
         align_other_to_depth_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, source, dest, bpp, to, from_to_other);
         break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        align_other_to_depth_sse<RS2_DISTORTION_BROWN_CONRADY>(z_pixels, source, dest, bpp, to, from_to_other);
+        break;
     default:
         align_other_to_depth_sse(z_pixels, source, dest, bpp, to, from_to_other);
         break;
@@ -301,7 +362,7 @@ template<rs2_distortion dist>
 inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
+    get_texture_map<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
         _pre_compute_map_y_top_left.data(), (byte*)_pixel_top_left_int.data(), to, from_to_other);
 
     float fov[2];
@@ -313,7 +374,7 @@ inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels,
 
     if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
+        get_texture_map<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
             _pre_compute_map_y_bottom_right.data(), (byte*)_pixel_bottom_right_int.data(), to, from_to_other);
 
         move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
@@ -329,13 +390,13 @@ template<rs2_distortion dist>
 inline void image_transform::align_other_to_depth_sse(const uint16_t * z_pixels, const byte * source, byte * dest, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
+    get_texture_map<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
         _pre_compute_map_y_top_left.data(), (byte*)_pixel_top_left_int.data(), to, from_to_other);
 
     std::vector<int2>& bottom_right = _pixel_top_left_int;
     if (to.height < _depth.height && to.width < _depth.width)
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
+        get_texture_map<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
             _pre_compute_map_y_bottom_right.data(), (byte*)_pixel_bottom_right_int.data(), to, from_to_other);
 
         bottom_right = _pixel_bottom_right_int;
@@ -415,7 +476,7 @@ void align_sse::align_z_to_other(rs2::video_frame& aligned, const rs2::video_fra
 
     auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
 
-    if (_stream_transform == nullptr)
+    if (_stream_transform == nullptr || !_stream_transform->is_built_for(z_intrin, z_scale))
     {
         _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
         _stream_transform->pre_compute_x_y_map_corners();
@@ -439,7 +500,7 @@ void align_sse::align_other_to_z(rs2::video_frame& aligned, const rs2::video_fra
     auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
     auto other_pixels = reinterpret_cast<const byte*>(other.get_data());
 
-    if (_stream_transform == nullptr)
+    if (_stream_transform == nullptr || !_stream_transform->is_built_for(z_intrin, z_scale))
     {
         _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
         _stream_transform->pre_compute_x_y_map_corners();
@@ -27,6 +27,12 @@ namespace librealsense
 
         void pre_compute_x_y_map_corners();
 
+        // The maps are only valid for the depth calibration and units they were computed from
+        bool is_built_for(const rs2_intrinsics& depth, float depth_scale) const
+        {
+            return !memcmp(&_depth, &depth, sizeof(depth)) && _depth_scale == depth_scale;
+        }
+
     private:
 
         const rs2_intrinsics _depth;
@@ -0,0 +1,18 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // Colors 'count' Z16 pixels through a table of 0x10000 packed colors (0x00BBGGRR, one per depth value) into
+    // RGB8. Returns how many pixels were done (a multiple of 16); the caller does the rest.
+    extern const bool z16_rgb_lookup_sse41_built;
+    size_t z16_rgb_lookup_sse41( uint16_t const * depth, uint32_t const * lut, uint8_t * rgb, size_t count );
+
+    extern const bool z16_rgb_lookup_avx2_built;
+    size_t z16_rgb_lookup_avx2( uint16_t const * depth, uint32_t const * lut, uint8_t * rgb, size_t count );
+}
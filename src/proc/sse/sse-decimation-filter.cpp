@@ -0,0 +1,139 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "sse-decimation-filter.h"
+
+#ifdef __SSE4_1__
+
+#include <smmintrin.h>  // SSE4.1
+
+namespace librealsense
+{
+    namespace
+    {
+        const size_t lanes = 8;
+
+        inline __m128i load( uint16_t const * p ) { return _mm_loadu_si128( reinterpret_cast< __m128i const * >( p ) ); }
+
+        inline void sort2( __m128i & a, __m128i & b )
+        {
+            __m128i const lo = _mm_min_epu16( a, b );
+            b = _mm_max_epu16( a, b );
+            a = lo;
+        }
+
+        // Sorts each lane across v[0..n); zeros (holes) end up first. The median of the valid pixels is then
+        // the one 'zeros + (n - zeros - 1) / 2' up, and n zeros make an empty block.
+        template< size_t N >
+        inline __m128i median_of_valid( __m128i * v, const unsigned char ( &network )[N][2], size_t n )
+        {
+            __m128i const zero = _mm_setzero_si128();
+            __m128i zeros = zero;
+            for( size_t i = 0; i < n; ++i )
+                zeros = _mm_sub_epi16( zeros, _mm_cmpeq_epi16( v[i], zero ) );
+
+            for( size_t c = 0; c < N; ++c )
+                sort2( v[network[c][0]], v[network[c][1]] );
+
+            __m128i median = zero;
+            for( size_t z = 0; z < n; ++z )
+            {
+                __m128i const pick = _mm_cmpeq_epi16( zeros, _mm_set1_epi16( short( z ) ) );
+                median = _mm_blendv_epi8( median, v[z + ( n - z - 1 ) / 2], pick );
+            }
+            return median;
+        }
+
+        const unsigned char sort4[5][2] = { { 0, 1 }, { 2, 3 }, { 0, 2 }, { 1, 3 }, { 1, 2 } };
+
+        const unsigned char sort9[25][2] = { { 0, 1 }, { 3, 4 }, { 6, 7 }, { 1, 2 }, { 4, 5 }, { 7, 8 }, { 0, 1 },
+                                             { 3, 4 }, { 6, 7 }, { 0, 3 }, { 3, 6 }, { 0, 3 }, { 1, 4 }, { 4, 7 },
+                                             { 1, 4 }, { 2, 5 }, { 5, 8 }, { 2, 5 }, { 1, 3 }, { 5, 7 }, { 2, 6 },
+                                             { 4, 6 }, { 2, 4 }, { 2, 3 }, { 5, 6 } };
+
+        size_t median_2x2( uint16_t const * rows, size_t width_in, uint16_t * out, size_t count )
+        {
+            __m128i const low_half = _mm_set1_epi32( 0xffff );
+            size_t i = 0;
+            for( ; i + lanes <= count; i += lanes )
+            {
+                // Split 16 input pixels of each row into even and odd columns
+                __m128i v[4];
+                for( size_t r = 0; r < 2; ++r )
+                {
+                    uint16_t const * p = rows + r * width_in + 2 * i;
+                    __m128i const a = load( p );
+                    __m128i const b = load( p + lanes );
+                    v[2 * r] = _mm_packus_epi32( _mm_and_si128( a, low_half ), _mm_and_si128( b, low_half ) );
+                    v[2 * r + 1] = _mm_packus_epi32( _mm_srli_epi32( a, 16 ), _mm_srli_epi32( b, 16 ) );
+                }
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), median_of_valid( v, sort4, 4 ) );
+            }
+            return i;
+        }
+
+        size_t median_3x3( uint16_t const * rows, size_t width_in, uint16_t * out, size_t count )
+        {
+            // shuffle[k][s] gathers the pixels 3 * lane + k that are in the s-th 8 of 24 input pixels
+            __m128i shuffle[3][3];
+            for( int k = 0; k < 3; ++k )
+            {
+                for( int s = 0; s < 3; ++s )
+                {
+                    alignas( 16 ) unsigned char bytes[16];
+                    for( int lane = 0; lane < 8; ++lane )
+                    {
+                        int const e = 3 * lane + k;
+                        bool const here = e / 8 == s;
+                        bytes[2 * lane] = here ? (unsigned char)( 2 * ( e % 8 ) ) : 0x80;
+                        bytes[2 * lane + 1] = here ? (unsigned char)( 2 * ( e % 8 ) + 1 ) : 0x80;
+                    }
+                    shuffle[k][s] = _mm_load_si128( reinterpret_cast< __m128i const * >( bytes ) );
+                }
+            }
+
+            size_t i = 0;
+            for( ; i + lanes <= count; i += lanes )
+            {
+                __m128i v[9];
+                for( size_t r = 0; r < 3; ++r )
+                {
+                    uint16_t const * p = rows + r * width_in + 3 * i;
+                    __m128i const in[3] = { load( p ), load( p + lanes ), load( p + 2 * lanes ) };
+                    for( int k = 0; k < 3; ++k )
+                        v[3 * r + k] = _mm_or_si128( _mm_or_si128( _mm_shuffle_epi8( in[0], shuffle[k][0] ),
+                                                                   _mm_shuffle_epi8( in[1], shuffle[k][1] ) ),
+                                                     _mm_shuffle_epi8( in[2], shuffle[k][2] ) );
+                }
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), median_of_valid( v, sort9, 9 ) );
+            }
+            return i;
+        }
+    }
+
+    const bool z16_median_decimation_sse41_built = true;
+
+    size_t z16_median_decimation_sse41( uint16_t const * rows, size_t width_in, size_t scale, uint16_t * out, size_t count )
+    {
+        switch( scale )
+        {
+        case 2:
+            return median_2x2( rows, width_in, out, count );
+        case 3:
+            return median_3x3( rows, width_in, out, count );
+        default:
+            return 0;
+        }
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the decimation filter falls back to its scalar version
+    const bool z16_median_decimation_sse41_built = false;
+    size_t z16_median_decimation_sse41( uint16_t const *, size_t, size_t, uint16_t *, size_t ) { return 0; }
+}
+
+#endif // __SSE4_1__
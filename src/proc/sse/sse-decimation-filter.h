@@ -0,0 +1,21 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // Vectorized median decimation of one Z16 output row, for scales 2 and 3, with the same output as
+    // decimation_filter::decimate_depth: the median of the non-zero pixels of each scale x scale block, the one
+    // below the middle for an even count, or 0 when the block has no valid pixel. Eight output pixels are done
+    // at a time, with a sorting network over the blocks' pixels.
+    //
+    // 'rows' points at the first pixel of the scale input rows the output row is made of, 'width_in' pixels
+    // apart. Returns how many of the 'count' output pixels were written (a multiple of 8); the caller does the
+    // rest.
+    extern const bool z16_median_decimation_sse41_built;
+    size_t z16_median_decimation_sse41( uint16_t const * rows, size_t width_in, size_t scale, uint16_t * out, size_t count );
+}
@@ -7,8 +7,10 @@
 #include "../../environment.h"
 #include "../occlusion-filter.h"
 #include "sse-pointcloud.h"
+#include "avx-pointcloud.h"
 #include "../../option.h"
 #include "../../context.h"
+#include "../color-formats-converter.h"
 
 #include <iostream>
 
@@ -20,7 +22,9 @@
 
 namespace librealsense
 {
-    pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)") {}
+    pointcloud_sse::pointcloud_sse() : pointcloud_sse("Pointcloud (SSE3)") {}
+
+    pointcloud_sse::pointcloud_sse(const char* name) : pointcloud(name) {}
 
     void pointcloud_sse::preprocess()
     {
@@ -53,28 +57,17 @@ namespace librealsense
         }
     }
 
-    const float3* pointcloud_sse::depth_to_points(rs2::points output,
-            const rs2_intrinsics &depth_intrinsics, 
-            const rs2::depth_frame& depth_frame)
-    {
 #ifdef __SSSE3__
-
-        auto depth_image = (const uint16_t*)depth_frame.get_data();
-
-        float* pre_compute_x = _pre_compute_map_x.data();
-        float* pre_compute_y = _pre_compute_map_y.data();
-
-        uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
-
-        auto point = (float*)output.get_vertices();
-
+    static void deproject_depth_sse(const uint16_t* depth_image, float depth_scale, uint32_t size,
+        const float* pre_compute_x, const float* pre_compute_y, float* point)
+    {
         //mask for shuffle
         const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
             (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
         const __m128i mask1 = _mm_set_epi8((char)0xff, (char)0xff, (char)15, (char)14, (char)0xff, (char)0xff, (char)13, (char)12,
             (char)0xff, (char)0xff, (char)11, (char)10, (char)0xff, (char)0xff, (char)9, (char)8);
 
-        auto scale = _mm_set_ps1(depth_frame.get_units());
+        auto scale = _mm_set_ps1(depth_scale);
 
         auto mapx = pre_compute_x;
         auto mapy = pre_compute_y;
@@ -132,8 +125,19 @@ namespace librealsense
             _mm_stream_ps(&point[20], xyz13);
             point += 24;
         }
+    }
+#endif
+
+    void pointcloud_sse::deproject_rows(float3* points,
+            const rs2_intrinsics &depth_intrinsics, 
+            const rs2::depth_frame& depth_frame, int first_row, int rows)
+    {
+#ifdef __SSSE3__
+        size_t first = size_t(first_row) * depth_intrinsics.width;
+        deproject_depth_sse((const uint16_t*)depth_frame.get_data() + first, depth_frame.get_units(),
+            rows * depth_intrinsics.width, _pre_compute_map_x.data() + first, _pre_compute_map_y.data() + first,
+            (float*)points);
 #endif
-        return (float3*)output.get_vertices();
     }
 
     void pointcloud_sse::get_texture_map_sse( float2 * texture_map,
@@ -266,21 +270,69 @@ namespace librealsense
 
     }
 
-    void pointcloud_sse::get_texture_map( rs2::points output,
-                                          const float3 * points,
-                                          const unsigned int width,
-                                          const unsigned int height,
-                                          const rs2_intrinsics & other_intrinsics,
-                                          const rs2_extrinsics & extr,
-                                          float2 * pixels_ptr )
+    void pointcloud_sse::map_rows( float2 * texture_map,
+                                   const float3 * points,
+                                   int width,
+                                   int rows,
+                                   const rs2_intrinsics & other_intrinsics,
+                                   const rs2_extrinsics & extr,
+                                   float2 * pixels_ptr )
     {
-
-        get_texture_map_sse( (float2 *)output.get_texture_coordinates(),
+        get_texture_map_sse( texture_map,
                          points,
                          width,
-                         height,
+                         rows,
                          other_intrinsics,
                          extr,
                          pixels_ptr );
     }
+
+    pointcloud_avx::pointcloud_avx()
+        : pointcloud_sse(pointcloud_avx512_built && has_avx512() ? "Pointcloud (AVX-512)" : "Pointcloud (AVX2)"),
+          _avx512(pointcloud_avx512_built && has_avx512())
+    {}
+
+    bool pointcloud_avx::is_supported()
+    {
+        return pointcloud_avx2_built && has_avx2();
+    }
+
+    void pointcloud_avx::deproject_rows(float3* points,
+        const rs2_intrinsics &depth_intrinsics,
+        const rs2::depth_frame& depth_frame, int first_row, int rows)
+    {
+        size_t first = size_t(first_row) * depth_intrinsics.width;
+        auto depth_image = (const uint16_t*)depth_frame.get_data() + first;
+        auto map_x = _pre_compute_map_x.data() + first;
+        auto map_y = _pre_compute_map_y.data() + first;
+        auto depth_scale = depth_frame.get_units();
+        uint32_t size = rows * depth_intrinsics.width;
+
+        size_t done = _avx512
+            ? deproject_depth_avx512(depth_image, depth_scale, size, map_x, map_y, (float*)points)
+            : deproject_depth_avx2(depth_image, depth_scale, size, map_x, map_y, (float*)points);
+#ifdef __SSSE3__
+        // The rest starts 16-byte aligned, as the SSE loads and stores need
+        if (done < size)
+            deproject_depth_sse(depth_image + done, depth_scale, uint32_t(size - done), map_x + done,
+                map_y + done, (float*)(points + done));
+#endif
+    }
+
+    void pointcloud_avx::map_rows(float2 * tex_ptr,
+        const float3 * points,
+        int width,
+        int rows,
+        const rs2_intrinsics & other_intrinsics,
+        const rs2_extrinsics & extr,
+        float2 * pixels_ptr)
+    {
+        size_t size = size_t(width) * rows;
+
+        size_t done = _avx512
+            ? get_texture_map_avx512(&points->x, size, other_intrinsics, extr, &tex_ptr->x, &pixels_ptr->x)
+            : get_texture_map_avx2(&points->x, size, other_intrinsics, extr, &tex_ptr->x, &pixels_ptr->x);
+        if (done < size)
+            get_texture_map_sse(tex_ptr + done, points + done, unsigned(size - done), 1, other_intrinsics, extr, pixels_ptr + done);
     }
+}
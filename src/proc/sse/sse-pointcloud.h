@@ -19,24 +19,36 @@ namespace librealsense
             const rs2_extrinsics & extr,
             float2 * pixels_ptr);
 
-    private:
+    protected:
+        pointcloud_sse(const char* name);
+
         void preprocess() override;
-        const float3 * depth_to_points(
-            rs2::points output,
-            const rs2_intrinsics &depth_intrinsics, 
-            const rs2::depth_frame& depth_frame) override;
-        void get_texture_map(
-            rs2::points output,
-            const float3* points,
-            const unsigned int width,
-            const unsigned int height,
-            const rs2_intrinsics &other_intrinsics,
-            const rs2_extrinsics& extr,
-            float2* pixels_ptr) override;
+        void deproject_rows(float3* points, const rs2_intrinsics& depth_intrinsics,
+            const rs2::depth_frame& depth_frame, int first_row, int rows) override;
+        void map_rows(float2* texture_map, const float3* points, int width, int rows,
+            const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr, float2* pixels_ptr) override;
 
         std::vector<float> _pre_compute_map_x;
         std::vector<float> _pre_compute_map_y;
 
         void pre_compute_x_y_map();
     };
+
+    // The same cloud as pointcloud_sse, 8 (AVX2) or 16 (AVX-512) pixels at a time; create() picks it when the
+    // CPU has AVX2
+    class pointcloud_avx : public pointcloud_sse
+    {
+    public:
+        pointcloud_avx();
+
+        static bool is_supported();
+
+    private:
+        void deproject_rows(float3* points, const rs2_intrinsics& depth_intrinsics,
+            const rs2::depth_frame& depth_frame, int first_row, int rows) override;
+        void map_rows(float2* texture_map, const float3* points, int width, int rows,
+            const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr, float2* pixels_ptr) override;
+
+        bool _avx512;
+    };
 }
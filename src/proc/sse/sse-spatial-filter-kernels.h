@@ -0,0 +1,239 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+// The Z16 domain transform passes, shared by the SSE4.1 and AVX2 translation units, which differ only in how
+// they interpolate (the ISA template argument). Include from those only.
+
+#pragma once
+
+#include "sse-spatial-filter.h"
+
+#include <smmintrin.h>  // SSE4.1
+
+
+namespace librealsense
+{
+    namespace
+    {
+        const size_t lanes = 8;
+
+        // In-place transpose of 8 vectors of 8 uint16 (rows <-> columns)
+        inline void transpose_8x8( __m128i v[8] )
+        {
+            __m128i t0 = _mm_unpacklo_epi16( v[0], v[1] );
+            __m128i t1 = _mm_unpackhi_epi16( v[0], v[1] );
+            __m128i t2 = _mm_unpacklo_epi16( v[2], v[3] );
+            __m128i t3 = _mm_unpackhi_epi16( v[2], v[3] );
+            __m128i t4 = _mm_unpacklo_epi16( v[4], v[5] );
+            __m128i t5 = _mm_unpackhi_epi16( v[4], v[5] );
+            __m128i t6 = _mm_unpacklo_epi16( v[6], v[7] );
+            __m128i t7 = _mm_unpackhi_epi16( v[6], v[7] );
+
+            __m128i u0 = _mm_unpacklo_epi32( t0, t2 );
+            __m128i u1 = _mm_unpackhi_epi32( t0, t2 );
+            __m128i u2 = _mm_unpacklo_epi32( t1, t3 );
+            __m128i u3 = _mm_unpackhi_epi32( t1, t3 );
+            __m128i u4 = _mm_unpacklo_epi32( t4, t6 );
+            __m128i u5 = _mm_unpackhi_epi32( t4, t6 );
+            __m128i u6 = _mm_unpacklo_epi32( t5, t7 );
+            __m128i u7 = _mm_unpackhi_epi32( t5, t7 );
+
+            v[0] = _mm_unpacklo_epi64( u0, u4 );
+            v[1] = _mm_unpackhi_epi64( u0, u4 );
+            v[2] = _mm_unpacklo_epi64( u1, u5 );
+            v[3] = _mm_unpackhi_epi64( u1, u5 );
+            v[4] = _mm_unpacklo_epi64( u2, u6 );
+            v[5] = _mm_unpackhi_epi64( u2, u6 );
+            v[6] = _mm_unpacklo_epi64( u3, u7 );
+            v[7] = _mm_unpackhi_epi64( u3, u7 );
+        }
+
+        // Loads/stores the first n (<= 8) values only, so neighbouring bands are left alone
+        inline __m128i load_partial( uint16_t const * p, size_t n )
+        {
+            if( n == lanes )
+                return _mm_loadu_si128( reinterpret_cast< __m128i const * >( p ) );
+            uint16_t tmp[lanes] = {};
+            for( size_t i = 0; i < n; ++i )
+                tmp[i] = p[i];
+            return _mm_loadu_si128( reinterpret_cast< __m128i const * >( tmp ) );
+        }
+
+        inline void store_partial( uint16_t * p, __m128i v, size_t n )
+        {
+            if( n == lanes )
+                return _mm_storeu_si128( reinterpret_cast< __m128i * >( p ), v );
+            uint16_t tmp[lanes];
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( tmp ), v );
+            for( size_t i = 0; i < n; ++i )
+                p[i] = tmp[i];
+        }
+
+        inline size_t at_most_8( size_t n ) { return n < lanes ? n : lanes; }
+
+        // Unsigned 16-bit comparisons, all bits set where true
+        inline __m128i eq( __m128i a, __m128i b ) { return _mm_cmpeq_epi16( a, b ); }
+        inline __m128i le( __m128i a, __m128i b ) { return eq( _mm_min_epu16( a, b ), a ); }
+        inline __m128i lt( __m128i a, __m128i b ) { return _mm_andnot_si128( eq( _mm_max_epu16( a, b ), a ), _mm_set1_epi16( -1 ) ); }
+        inline __m128i absdiff( __m128i a, __m128i b ) { return _mm_sub_epi16( _mm_max_epu16( a, b ), _mm_min_epu16( a, b ) ); }
+
+        // Broadcast filter parameters
+        struct constants
+        {
+            __m128 alpha, one_minus_alpha, round;
+            __m128i zero, one, two, delta_z, radius_minus_1;
+            bool fill;
+
+            explicit constants( z16_domain_transform const & dt )
+                : alpha( _mm_set1_ps( dt.alpha ) )
+                , one_minus_alpha( _mm_set1_ps( 1.f - dt.alpha ) )
+                , round( _mm_set1_ps( 0.5f ) )
+                , zero( _mm_setzero_si128() )
+                , one( _mm_set1_epi16( 1 ) )
+                , two( _mm_set1_epi16( 2 ) )
+                , delta_z( _mm_set1_epi16( short( dt.delta_z ) ) )
+                , radius_minus_1( _mm_set1_epi16( short( dt.holes_filling_radius - 1 ) ) )
+                , fill( dt.holes_filling_radius != 0 )
+            {
+            }
+        };
+
+        // The horizontal passes over one row per lane; 'cols' holds the rows transposed, one vector per column
+        template< class ISA >
+        void filter_rows( __m128i * cols, size_t width, constants const & k )
+        {
+            // left to right: pixels [1, width-2] follow their (filtered) left neighbour
+            __m128i val0 = cols[0];
+            __m128i cur_fill = k.zero;
+            for( size_t u = 1; u + 1 < width; ++u )
+            {
+                __m128i val1 = cols[u];
+                __m128i invalid0 = eq( val0, k.zero );
+                __m128i invalid1 = eq( val1, k.zero );
+                __m128i both_valid = _mm_andnot_si128( _mm_or_si128( invalid0, invalid1 ), _mm_set1_epi16( -1 ) );
+
+                __m128i diff = absdiff( val1, val0 );
+                __m128i smooth = _mm_andnot_si128( eq( diff, k.zero ), _mm_and_si128( both_valid, le( diff, k.delta_z ) ) );
+                __m128i filtered = ISA::lerp( val1, val0, k );
+                val1 = _mm_blendv_epi8( val1, filtered, smooth );
+
+                if( k.fill )
+                {
+                    __m128i hole = _mm_andnot_si128( invalid0, invalid1 );
+                    cur_fill = _mm_adds_epu16( cur_fill, _mm_and_si128( hole, k.one ) );
+                    cur_fill = _mm_andnot_si128( both_valid, cur_fill );
+                    val1 = _mm_blendv_epi8( val1, val0, _mm_and_si128( hole, le( cur_fill, k.radius_minus_1 ) ) );
+                }
+
+                cols[u] = val0 = val1;
+            }
+
+            // right to left: pixels [0, width-2] follow their right neighbour; note the scalar pass
+            // treats a value of 1 as a hole here
+            if( width < 2 )
+                return;
+            __m128i val1 = cols[width - 1];
+            cur_fill = k.zero;
+            for( size_t u = width - 1; u > 0; --u )
+            {
+                __m128i val0 = cols[u - 1];
+                __m128i valid1 = _mm_andnot_si128( eq( val1, k.zero ), _mm_set1_epi16( -1 ) );
+                __m128i valid0 = eq( _mm_max_epu16( val0, k.two ), val0 );
+                __m128i both_valid = _mm_and_si128( valid0, valid1 );
+
+                __m128i smooth = _mm_and_si128( both_valid, le( absdiff( val1, val0 ), k.delta_z ) );
+                __m128i filtered = ISA::lerp( val0, val1, k );
+                val0 = _mm_blendv_epi8( val0, filtered, smooth );
+
+                if( k.fill )
+                {
+                    __m128i hole = _mm_andnot_si128( valid0, valid1 );
+                    cur_fill = _mm_adds_epu16( cur_fill, _mm_and_si128( hole, k.one ) );
+                    cur_fill = _mm_andnot_si128( both_valid, cur_fill );
+                    val0 = _mm_blendv_epi8( val0, val1, _mm_and_si128( hole, le( cur_fill, k.radius_minus_1 ) ) );
+                }
+
+                cols[u - 1] = val1 = val0;
+            }
+        }
+
+        template< class ISA >
+        void domain_transform_horizontal( z16_domain_transform const & dt, size_t row_begin, size_t row_end )
+        {
+            constants const k( dt );
+            size_t const width = dt.width;
+            size_t const padded_width = ( width + lanes - 1 ) / lanes * lanes;
+            auto cols = static_cast< __m128i * >( _mm_malloc( padded_width * sizeof( __m128i ), sizeof( __m128i ) ) );
+            if( ! cols )
+                return;
+
+            for( size_t v = row_begin; v < row_end; v += lanes )
+            {
+                size_t const n_rows = at_most_8( row_end - v );
+                uint16_t * rows = dt.image + v * width;
+
+                for( size_t u = 0; u < width; u += lanes )
+                {
+                    size_t const n = at_most_8( width - u );
+                    __m128i * tile = cols + u;
+                    for( size_t r = 0; r < lanes; ++r )
+                        tile[r] = r < n_rows ? load_partial( rows + r * width + u, n ) : k.zero;
+                    transpose_8x8( tile );
+                }
+
+                filter_rows< ISA >( cols, width, k );
+
+                for( size_t u = 0; u < width; u += lanes )
+                {
+                    size_t const n = at_most_8( width - u );
+                    __m128i * tile = cols + u;
+                    transpose_8x8( tile );
+                    for( size_t r = 0; r < n_rows; ++r )
+                        store_partial( rows + r * width + u, tile[r], n );
+                }
+            }
+
+            _mm_free( cols );
+        }
+
+        template< class ISA >
+        void domain_transform_vertical( z16_domain_transform const & dt, size_t col_begin, size_t col_end )
+        {
+            constants const k( dt );
+            size_t const width = dt.width;
+            uint16_t * image = dt.image;
+
+            // top to bottom: no validity checks, as in the scalar pass
+            for( size_t v = 1; v < dt.height; ++v )
+            {
+                uint16_t * im = image + ( v - 1 ) * width;
+                for( size_t u = col_begin; u < col_end; u += lanes )
+                {
+                    size_t const n = at_most_8( col_end - u );
+                    __m128i im0 = load_partial( im + u, n );
+                    __m128i imw = load_partial( im + width + u, n );
+                    __m128i smooth = lt( absdiff( im0, imw ), k.delta_z );
+                    __m128i filtered = ISA::lerp( imw, im0, k );
+                    store_partial( im + width + u, _mm_blendv_epi8( imw, filtered, smooth ), n );
+                }
+            }
+
+            // bottom to top
+            for( size_t v = 1; v < dt.height; ++v )
+            {
+                uint16_t * im = image + ( dt.height - 1 - v ) * width;
+                for( size_t u = col_begin; u < col_end; u += lanes )
+                {
+                    size_t const n = at_most_8( col_end - u );
+                    __m128i im0 = load_partial( im + u, n );
+                    __m128i imw = load_partial( im + width + u, n );
+                    __m128i both_valid = _mm_andnot_si128( _mm_or_si128( eq( im0, k.zero ), eq( imw, k.zero ) ),
+                                                           _mm_set1_epi16( -1 ) );
+                    __m128i smooth = _mm_and_si128( both_valid, lt( absdiff( im0, imw ), k.delta_z ) );
+                    __m128i filtered = ISA::lerp( im0, imw, k );
+                    store_partial( im + u, _mm_blendv_epi8( im0, filtered, smooth ), n );
+                }
+            }
+        }
+    }
+}
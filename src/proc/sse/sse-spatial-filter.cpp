@@ -0,0 +1,54 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+
+#ifdef __SSE4_1__
+
+#include "sse-spatial-filter-kernels.h"
+
+namespace librealsense
+{
+    namespace
+    {
+        struct sse41
+        {
+            // a * alpha + b * (1 - alpha), rounded the way the scalar passes round it
+            static __m128i lerp( __m128i a, __m128i b, constants const & k )
+            {
+                __m128 a_lo = _mm_cvtepi32_ps( _mm_cvtepu16_epi32( a ) );
+                __m128 a_hi = _mm_cvtepi32_ps( _mm_cvtepu16_epi32( _mm_srli_si128( a, 8 ) ) );
+                __m128 b_lo = _mm_cvtepi32_ps( _mm_cvtepu16_epi32( b ) );
+                __m128 b_hi = _mm_cvtepi32_ps( _mm_cvtepu16_epi32( _mm_srli_si128( b, 8 ) ) );
+
+                __m128 lo = _mm_add_ps( _mm_add_ps( _mm_mul_ps( a_lo, k.alpha ), _mm_mul_ps( b_lo, k.one_minus_alpha ) ), k.round );
+                __m128 hi = _mm_add_ps( _mm_add_ps( _mm_mul_ps( a_hi, k.alpha ), _mm_mul_ps( b_hi, k.one_minus_alpha ) ), k.round );
+                return _mm_packus_epi32( _mm_cvttps_epi32( lo ), _mm_cvttps_epi32( hi ) );
+            }
+        };
+    }
+
+    const bool z16_domain_transform_sse41_built = true;
+
+    void z16_domain_transform_horizontal_sse41( z16_domain_transform const & dt, size_t row_begin, size_t row_end )
+    {
+        domain_transform_horizontal< sse41 >( dt, row_begin, row_end );
+    }
+
+    void z16_domain_transform_vertical_sse41( z16_domain_transform const & dt, size_t col_begin, size_t col_end )
+    {
+        domain_transform_vertical< sse41 >( dt, col_begin, col_end );
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the spatial filter falls back to its scalar passes
+    const bool z16_domain_transform_sse41_built = false;
+    void z16_domain_transform_horizontal_sse41( z16_domain_transform const &, size_t, size_t ) {}
+    void z16_domain_transform_vertical_sse41( z16_domain_transform const &, size_t, size_t ) {}
+}
+
+#endif // __SSE4_1__
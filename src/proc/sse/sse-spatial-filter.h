@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // A Z16 image and the parameters of the spatial filter's domain transform passes over it
+    struct z16_domain_transform
+    {
+        uint16_t * image;
+        size_t width, height;
+        float alpha;
+        uint16_t delta_z;
+        uint8_t holes_filling_radius;
+    };
+
+    // Vectorized spatial_filter::recursive_filter_horizontal<uint16_t> and recursive_filter_vertical<uint16_t>,
+    // with identical output. The horizontal pass follows 8 rows at a time (transposed, one row per vector lane),
+    // the vertical pass 8 adjacent columns. Bands are processed as in the scalar passes: rows [row_begin, row_end)
+    // or columns [col_begin, col_end), without touching anything outside them.
+    extern const bool z16_domain_transform_sse41_built;
+    void z16_domain_transform_horizontal_sse41( z16_domain_transform const & dt, size_t row_begin, size_t row_end );
+    void z16_domain_transform_vertical_sse41( z16_domain_transform const & dt, size_t col_begin, size_t col_end );
+
+    extern const bool z16_domain_transform_avx2_built;
+    void z16_domain_transform_horizontal_avx2( z16_domain_transform const & dt, size_t row_begin, size_t row_end );
+    void z16_domain_transform_vertical_avx2( z16_domain_transform const & dt, size_t col_begin, size_t col_end );
+}
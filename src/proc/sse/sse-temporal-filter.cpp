@@ -0,0 +1,107 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "../temporal-filter-simd.h"
+
+#ifdef __SSE4_1__
+
+#include "../temporal-filter-kernels.h"
+#include <smmintrin.h>  // SSE4.1
+
+namespace librealsense
+{
+    namespace
+    {
+        struct sse41
+        {
+            struct constants
+            {
+                __m128i zero, ones, one, weights, delta_z, lane_bits;
+                bool full_weight;  // alpha == 1, which does not fit the 16-bit multiplier
+
+                explicit constants( z16_temporal_smoothing const & ts )
+                    : zero( _mm_setzero_si128() )
+                    , ones( _mm_set1_epi16( -1 ) )
+                    , one( _mm_set1_epi16( 1 ) )
+                    , weights( _mm_set1_epi32( ( TEMPORAL_BLEND_BIAS << 16 ) | ( ts.alpha & 0x7fff ) ) )
+                    , delta_z( _mm_set1_epi16( short( ts.delta_z ) ) )
+                    , lane_bits( _mm_setr_epi16( 1, 2, 4, 8, 16, 32, 64, 128 ) )
+                    , full_weight( ts.alpha >= 32768 )
+                {
+                }
+            };
+
+            // 4 x 8 lane masks -> 32 bits
+            static uint32_t to_bits( __m128i const m[4] )
+            {
+                return uint32_t( _mm_movemask_epi8( _mm_packs_epi16( m[0], m[1] ) ) )
+                     | uint32_t( _mm_movemask_epi8( _mm_packs_epi16( m[2], m[3] ) ) ) << 16;
+            }
+
+            static group_masks smooth( uint16_t * frame, uint16_t * last_frame, constants const & k )
+            {
+                __m128i valid[4], agree[4], last_valid[4];
+                for( int j = 0; j < 4; ++j )
+                {
+                    auto f = reinterpret_cast< __m128i * >( frame + 8 * j );
+                    auto l = reinterpret_cast< __m128i * >( last_frame + 8 * j );
+                    __m128i cur = _mm_loadu_si128( f );
+                    __m128i prev = _mm_loadu_si128( l );
+
+                    valid[j] = _mm_xor_si128( _mm_cmpeq_epi16( cur, k.zero ), k.ones );
+                    last_valid[j] = _mm_xor_si128( _mm_cmpeq_epi16( prev, k.zero ), k.ones );
+                    __m128i diff = _mm_sub_epi16( _mm_max_epu16( cur, prev ), _mm_min_epu16( cur, prev ) );
+                    __m128i close = _mm_xor_si128( _mm_cmpeq_epi16( _mm_max_epu16( diff, k.delta_z ), diff ), k.ones );
+                    agree[j] = _mm_and_si128( _mm_and_si128( valid[j], last_valid[j] ), close );
+
+                    // prev + alpha * (cur - prev): (diff, 1) pairs times (alpha, bias) pairs
+                    __m128i filtered = cur;
+                    if( ! k.full_weight )
+                    {
+                        __m128i diff = _mm_sub_epi16( cur, prev );
+                        __m128i lo = _mm_madd_epi16( _mm_unpacklo_epi16( diff, k.one ), k.weights );
+                        __m128i hi = _mm_madd_epi16( _mm_unpackhi_epi16( diff, k.one ), k.weights );
+                        __m128i step = _mm_packs_epi32( _mm_srai_epi32( lo, 15 ), _mm_srai_epi32( hi, 15 ) );
+                        filtered = _mm_add_epi16( prev, step );
+                    }
+
+                    _mm_storeu_si128( f, _mm_blendv_epi8( cur, filtered, agree[j] ) );
+                    _mm_storeu_si128( l, _mm_blendv_epi8( _mm_blendv_epi8( prev, cur, valid[j] ), filtered, agree[j] ) );
+                }
+                return { to_bits( valid ), to_bits( agree ), to_bits( last_valid ) };
+            }
+
+            static void fill( uint16_t * frame, uint16_t const * last_frame, uint32_t pixels, constants const & k )
+            {
+                for( int j = 0; j < 4; ++j, pixels >>= 8 )
+                {
+                    if( ! ( pixels & 0xff ) )
+                        continue;
+                    auto f = reinterpret_cast< __m128i * >( frame + 8 * j );
+                    __m128i lanes = _mm_and_si128( _mm_set1_epi16( short( pixels & 0xff ) ), k.lane_bits );
+                    __m128i mask = _mm_cmpeq_epi16( lanes, k.lane_bits );
+                    __m128i prev = _mm_loadu_si128( reinterpret_cast< __m128i const * >( last_frame + 8 * j ) );
+                    _mm_storeu_si128( f, _mm_blendv_epi8( _mm_loadu_si128( f ), prev, mask ) );
+                }
+            }
+        };
+    }
+
+    const bool z16_temporal_smoothing_sse41_built = true;
+
+    void z16_temporal_smoothing_sse41( z16_temporal_smoothing const & ts )
+    {
+        temporal_smooth< sse41 >( ts );
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    // Never called: the temporal filter falls back to its scalar version
+    const bool z16_temporal_smoothing_sse41_built = false;
+    void z16_temporal_smoothing_sse41( z16_temporal_smoothing const & ) {}
+}
+
+#endif // __SSE4_1__
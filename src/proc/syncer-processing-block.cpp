@@ -2,6 +2,7 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include <functional>
+#include <limits>
 #include "source.h"
 #include "sync.h"
 #include "proc/synthetic-stream.h"
@@ -11,8 +12,14 @@
 namespace librealsense
 {
     syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
-        : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
-        , _enable_opts(enable_opts.begin(), enable_opts.end())
+        : syncer_process_unit( "syncer", std::make_shared< composite_identity_matcher >( std::vector< std::shared_ptr< matcher > >() ), log )
+    {
+        _enable_opts.assign( enable_opts.begin(), enable_opts.end() );
+    }
+
+    syncer_process_unit::syncer_process_unit( const char * name, std::shared_ptr< matcher > matcher, bool log )
+        : processing_block( name )
+        , _matcher( std::move( matcher ) )
     {
         _matcher->set_callback( [this]( frame_holder f, syncronization_environment env ) {
             if( env.log )
@@ -90,5 +97,70 @@ namespace librealsense
     {
         _matcher->stop();
     }
-}
 
+    namespace
+    {
+        // Reads one of the matcher's statistics
+        class sync_statistic_option : public readonly_option
+        {
+        public:
+            sync_statistic_option( std::function< float() > query, std::string description )
+                : _query( std::move( query ) )
+                , _description( std::move( description ) )
+            {
+            }
+
+            float query() const override { return _query(); }
+            option_range get_range() const override { return { 0, std::numeric_limits< float >::max(), 0, 0 }; }
+            bool is_enabled() const override { return true; }
+            const char * get_description() const override { return _description.c_str(); }
+
+        private:
+            std::function< float() > _query;
+            std::string _description;
+        };
+    }
+
+    multi_device_syncer::multi_device_syncer()
+        : multi_device_syncer( std::make_shared< multi_device_composite_matcher >() )
+    {
+    }
+
+    multi_device_syncer::multi_device_syncer( std::shared_ptr< multi_device_composite_matcher > const & matcher )
+        : syncer_process_unit( "multi-device syncer", matcher, true )
+    {
+        auto tolerance = std::make_shared< ptr_option< float > >(
+            0.f, 100.f, 0.1f, 0.f, &_tolerance_ms,
+            "Max difference, in milliseconds, between the timestamps of frames from different devices in one "
+            "frameset; 0 allows half the frame interval" );
+        std::weak_ptr< multi_device_composite_matcher > weak = matcher;
+        tolerance->on_set( [weak]( float value ) {
+            if( auto m = weak.lock() )
+                m->set_tolerance( value );
+        } );
+        register_option( RS2_OPTION_SYNC_TOLERANCE, tolerance );
+
+        register_option( RS2_OPTION_SYNC_FRAMESETS,
+                         std::make_shared< sync_statistic_option >(
+                             [weak]() {
+                                 auto m = weak.lock();
+                                 return m ? float( m->get_statistics().framesets ) : 0.f;
+                             },
+                             "Number of framesets released" ) );
+        register_option( RS2_OPTION_SYNC_INCOMPLETE_FRAMESETS,
+                         std::make_shared< sync_statistic_option >(
+                             [weak]() {
+                                 auto m = weak.lock();
+                                 return m ? float( m->get_statistics().incomplete ) : 0.f;
+                             },
+                             "Number of framesets released without a frame from every device" ) );
+        register_option( RS2_OPTION_SYNC_LATENCY,
+                         std::make_shared< sync_statistic_option >(
+                             [weak]() {
+                                 auto m = weak.lock();
+                                 return m ? float( m->get_statistics().latency_ms ) : 0.f;
+                             },
+                             "Average time, in milliseconds, from the arrival of the oldest frame of a frameset "
+                             "until it is released" ) );
+    }
+}
@@ -16,6 +16,7 @@ namespace librealsense
 {
     class processing_block;
     class timestamp_composite_matcher;
+    class multi_device_composite_matcher;
     class syncer_process_unit : public processing_block
     {
     public:
@@ -37,6 +38,11 @@ namespace librealsense
         {
             _matcher.reset();
         }
+
+    protected:
+        // Syncs with 'matcher' instead of per-device matchers
+        syncer_process_unit( const char * name, std::shared_ptr< matcher > matcher, bool log );
+
     private:
         std::shared_ptr<matcher> _matcher;
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
@@ -44,4 +50,17 @@ namespace librealsense
         single_consumer_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
     };
+
+    // Syncs the frames of several devices into one frameset: each device's frames are synced by its own
+    // matcher, and the framesets of the different devices are then matched by their global timestamps
+    class multi_device_syncer : public syncer_process_unit
+    {
+    public:
+        multi_device_syncer();
+
+    private:
+        multi_device_syncer( std::shared_ptr< multi_device_composite_matcher > const & matcher );
+
+        float _tolerance_ms = 0.f;
+    };
 }
@@ -8,9 +8,12 @@
 #include "context.h"
 #include "stream.h"
 #include "types.h"
+#include "environment.h"
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+
 
 namespace librealsense
 {
@@ -29,10 +32,22 @@ namespace librealsense
         _source_wrapper(_source)
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK, _source.get_pool_high_water_mark_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
         _source.init(std::shared_ptr<metadata_parser_map>());
     }
 
+    void processing_block::register_processing_threads_option(int* threads, const char* description)
+    {
+        const int threads_min = 1;
+        const int threads_max = 32;
+        const int threads_step = 1;
+        const int threads_def = 1;
+        *threads = threads_def;
+        register_option(RS2_OPTION_PROCESSING_THREADS,
+            std::make_shared<ptr_option<int>>(threads_min, threads_max, threads_step, threads_def, threads, description));
+    }
+
     void processing_block::invoke(frame_holder f)
     {
         auto callback = _source.begin_callback();
@@ -166,6 +181,7 @@ namespace librealsense
         : generic_processing_block(name)
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK, _source.get_pool_high_water_mark_option());
         _source.init(std::shared_ptr<metadata_parser_map>());
 
         auto stream_selector = std::make_shared<ptr_option<int>>(RS2_STREAM_ANY, RS2_STREAM_COUNT, 1, RS2_STREAM_ANY, (int*)&_stream_filter.stream, "Stream type");
@@ -227,7 +243,8 @@ namespace librealsense
     }
 
     functional_processing_block::functional_processing_block(const char * name, rs2_format target_format, rs2_stream target_stream, rs2_extension extension_type) :
-        stream_filter_processing_block(name), _target_format(target_format), _target_stream(target_stream), _extension_type(extension_type) {}
+        stream_filter_processing_block(name), _target_format(target_format), _target_stream(target_stream), _extension_type(extension_type),
+        _workers(1, environment::get_instance().get_task_pool()) {}
 
     void functional_processing_block::init_profiles_info(const rs2::frame * f)
     {
@@ -256,8 +273,28 @@ namespace librealsense
         }
         byte* planes[1];
         planes[0] = (byte*)ret.get_data();
-
-        process_function(planes, static_cast<const byte*>(f.get_data()), width, height, height * width * _target_bpp, raw_size);
+        auto source_data = static_cast<const byte*>(f.get_data());
+
+        auto threads = environment::get_instance().get_converter_threads();
+        if (threads > 1 && vf && converts_rows_independently())
+        {
+            _workers.resize(threads);
+            // The unpacking routines work on whole groups of pixels, 32 of them for the AVX2 ones, so the bands
+            // start on one and only the last band has the tail a single pass would have
+            size_t rows_per_unit = 1;
+            while ((rows_per_unit * width) % 32)
+                ++rows_per_unit;
+            auto source_stride = f.as<rs2::video_frame>().get_stride_in_bytes();
+            _workers.parallel_for((height + rows_per_unit - 1) / rows_per_unit, [&](size_t begin, size_t end)
+            {
+                auto first = int(begin * rows_per_unit);
+                auto rows = std::min(height, int(end * rows_per_unit)) - first;
+                byte* band[1] = { planes[0] + size_t(first) * width * _target_bpp };
+                process_function(band, source_data + size_t(first) * source_stride, width, rows, rows * width * _target_bpp, raw_size);
+            }, std::max(size_t(1), 32 / rows_per_unit));
+        }
+        else
+            process_function(planes, source_data, width, height, height * width * _target_bpp, raw_size);
 
         return ret;
     }
@@ -328,7 +365,7 @@ namespace librealsense
         _actual_source.invoke_callback(std::move(result));
     }
 
-    frame_interface* synthetic_source::allocate_points(std::shared_ptr<stream_profile_interface> stream, frame_interface* original, rs2_extension frame_type)
+    frame_interface* synthetic_source::allocate_points(std::shared_ptr<stream_profile_interface> stream, frame_interface* original, rs2_extension frame_type, size_t size)
     {
         auto vid_stream = dynamic_cast<video_stream_profile_interface*>(stream.get());
         if (vid_stream)
@@ -341,7 +378,9 @@ namespace librealsense
             data.system_time = _actual_source.get_time();
             data.is_blocking = original->is_blocking();
 
-            auto res = _actual_source.alloc_frame(frame_type, vid_stream->get_width() * vid_stream->get_height() * sizeof(float) * 5, data, true);
+            if (!size)
+                size = vid_stream->get_width() * vid_stream->get_height() * sizeof(float) * 5;
+            auto res = _actual_source.alloc_frame(frame_type, size, data, true);
             if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
             res->set_sensor(original->get_sensor());
             res->set_stream(stream);
@@ -482,7 +521,9 @@ namespace librealsense
                 res->set_blocking(true);
         }
 
+        // The buffer is not zero-filled, and copy_frames() swaps what it holds into nested composites
         auto frames = cf->get_frames();
+        std::fill_n(frames, req_size, nullptr);
         for (auto&& f : holders)
             copy_frames(std::move(f), frames);
         frames -= req_size;
@@ -559,6 +600,13 @@ namespace librealsense
         _processing_blocks.back()->set_output_callback(callback);
     }
 
+    void composite_processing_block::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        processing_block::set_frame_allocator(allocator);
+        for (auto&& pb : _processing_blocks)
+            pb->set_frame_allocator(allocator);
+    }
+
     void composite_processing_block::invoke(frame_holder frames)
     {
         // Invoke the first processing block.
@@ -8,6 +8,7 @@
 #include "../source.h"
 #include <librealsense2/hpp/rs_frame.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
+#include <rsutils/concurrency/worker-pool.h>
 
 namespace librealsense
 {
@@ -34,7 +35,7 @@ namespace librealsense
         frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
 
         frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
-            frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS) override;
+            frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS, size_t size = 0) override;
 
         void frame_ready(frame_holder result) override;
 
@@ -54,9 +55,13 @@ namespace librealsense
         void set_output_callback(frame_callback_ptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        void set_frame_allocator(frame_allocator_ptr allocator) override { _source.set_frame_allocator(allocator); }
 
         virtual ~processing_block() { _source.flush(); }
     protected:
+        // Expose 'threads', the number of threads each frame is split between, as RS2_OPTION_PROCESSING_THREADS
+        void register_processing_threads_option(int* threads, const char* description = "Number of threads each frame is split between");
+
         frame_source _source;
         std::mutex _mutex;
         frame_processor_callback_ptr _callback;
@@ -149,6 +154,9 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source & source, const rs2::frame & f) override;
         virtual rs2::frame prepare_frame(const rs2::frame_source& source, const rs2::frame& f);
         virtual void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) = 0;
+        // True if process_function() converts each row on its own, so a frame can be split into bands of rows
+        // that are converted concurrently, each with its own call
+        virtual bool converts_rows_independently() const { return false; }
 
         rs2::stream_profile _target_stream_profile;
         rs2::stream_profile _source_stream_profile;
@@ -156,6 +164,7 @@ namespace librealsense
         rs2_stream _target_stream;
         rs2_extension _extension_type;
         int _target_bpp = 0;
+        worker_pool _workers;
     };
 
     // process interleaved frames with a given function
@@ -250,6 +259,7 @@ namespace librealsense
         processing_block& get(rs2_option option);
         void add(std::shared_ptr<processing_block> block);
         void set_output_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         void invoke(frame_holder frames) override;
 
     protected:
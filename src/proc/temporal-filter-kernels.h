@@ -0,0 +1,113 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+// The Z16 temporal filter over packed history bit-planes, shared by the SSE4.1, AVX2 and NEON translation units.
+// The ISA template argument does the per-pixel work on a group of 32 pixels:
+//
+//     struct constants { explicit constants( z16_temporal_smoothing const & ); };
+//     static group_masks smooth( uint16_t * frame, uint16_t * last_frame, constants const & );
+//     static void fill( uint16_t * frame, uint16_t const * last_frame, uint32_t pixels, constants const & );
+//
+// Include from those only.
+
+#pragma once
+
+#include "temporal-filter-simd.h"
+
+
+namespace librealsense
+{
+    namespace
+    {
+        // One bit per pixel of a group
+        struct group_masks
+        {
+            uint32_t valid;       // the current pixel is valid
+            uint32_t agree;       // ... and close enough to the last one to be smoothed
+            uint32_t last_valid;  // the last pixel is valid
+        };
+
+        // Pixels valid in at least persistence_valid of the last persistence_frames frames, counted with a
+        // bit-sliced adder over the history planes: all 32 pixels at once
+        inline uint32_t credible_pixels( uint32_t const * planes, z16_temporal_smoothing const & ts )
+        {
+            uint32_t count[4] = {};
+            for( int f = 1; f <= ts.persistence_frames; ++f )
+            {
+                uint32_t carry = planes[( ts.frame_index + 8 - f ) % 8];
+                for( int b = 0; b < 4 && carry; ++b )
+                {
+                    uint32_t const next = count[b] & carry;
+                    count[b] ^= carry;
+                    carry = next;
+                }
+            }
+
+            uint32_t greater = 0, equal = ~0u;
+            for( int b = 3; b >= 0; --b )
+            {
+                if( ( ts.persistence_valid >> b ) & 1 )
+                    equal &= count[b];
+                else
+                {
+                    greater |= equal & count[b];
+                    equal &= ~count[b];
+                }
+            }
+            return greater | equal;
+        }
+
+        template< class ISA >
+        inline void smooth_group( uint16_t * frame, uint16_t * last_frame, uint32_t * planes,
+                                  z16_temporal_smoothing const & ts, typename ISA::constants const & k )
+        {
+            group_masks const m = ISA::smooth( frame, last_frame, k );
+
+            // Missing pixels take the last value when it was valid often enough lately; this looks at the
+            // history before the current frame is added to it
+            uint32_t const candidates = ~m.valid & m.last_valid;
+            if( candidates )
+            {
+                uint32_t const fill = candidates & credible_pixels( planes, ts );
+                if( fill )
+                    ISA::fill( frame, last_frame, fill, k );
+            }
+
+            // A valid pixel that could not be smoothed starts a new history
+            uint32_t const restart = m.valid & ~m.agree;
+            for( int p = 0; p < 8; ++p )
+                planes[p] &= ~restart;
+            planes[ts.frame_index] = m.valid;
+        }
+
+        template< class ISA >
+        void temporal_smooth( z16_temporal_smoothing const & ts )
+        {
+            typename ISA::constants const k( ts );
+            size_t const n = TEMPORAL_PIXELS_PER_GROUP;
+
+            size_t const groups = ts.pixels / n;
+            for( size_t g = 0; g < groups; ++g )
+                smooth_group< ISA >( ts.frame + g * n, ts.last_frame + g * n, ts.history + g * 8, ts, k );
+
+            // The last, partial group goes through a zero-padded copy
+            size_t const rest = ts.pixels - groups * n;
+            if( rest )
+            {
+                uint16_t frame[TEMPORAL_PIXELS_PER_GROUP] = {};
+                uint16_t last_frame[TEMPORAL_PIXELS_PER_GROUP] = {};
+                for( size_t i = 0; i < rest; ++i )
+                {
+                    frame[i] = ts.frame[groups * n + i];
+                    last_frame[i] = ts.last_frame[groups * n + i];
+                }
+                smooth_group< ISA >( frame, last_frame, ts.history + groups * 8, ts, k );
+                for( size_t i = 0; i < rest; ++i )
+                {
+                    ts.frame[groups * n + i] = frame[i];
+                    ts.last_frame[groups * n + i] = last_frame[i];
+                }
+            }
+        }
+    }
+}
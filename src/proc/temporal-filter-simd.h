@@ -0,0 +1,47 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    // Pixels are handled in groups of this many; each group keeps its history as 8 bit-planes of one
+    // 32-bit word each (bit i of plane p: pixel i was valid in the frame with index p)
+    const size_t TEMPORAL_PIXELS_PER_GROUP = 32;
+
+    // The blend is prev + floor(alpha * (cur - prev) + bias), in 1/32768 units; the small bias makes up for
+    // alpha's rounding so exact multiples land where the floating-point computation does
+    const int TEMPORAL_BLEND_BIAS = 64;
+
+    // A Z16 frame, the filter state and its parameters, as used by temporal_filter::temp_jw_smooth<uint16_t>
+    struct z16_temporal_smoothing
+    {
+        uint16_t * frame;
+        uint16_t * last_frame;
+        uint32_t * history;         // 8 planes per group of pixels
+        size_t pixels;
+        uint16_t alpha;             // the weight of the current pixel in 1/32768 units (0 to 32768)
+        uint16_t delta_z;
+        uint8_t frame_index;        // the plane of the current frame
+        uint8_t persistence_frames; // a missing pixel is filled if it was valid in at least
+        uint8_t persistence_valid;  // 'persistence_valid' of the last 'persistence_frames' frames
+    };
+
+    // Vectorized temporal_filter::temp_jw_smooth<uint16_t>. Holes are filled as in the scalar version, but the
+    // blending is done in fixed point: a smoothed pixel may be one depth unit away from the scalar (floating
+    // point) result for the same inputs. This is rare (about 0.06% of the blends, for alphas on the option's
+    // 0.01 grid), but as the filter is recursive such a difference carries into later frames.
+    //
+    // The NEON version is only built with BUILD_WITH_NEON_TEMPORAL_FILTER: it is not exercised by the x86 tests.
+    extern const bool z16_temporal_smoothing_sse41_built;
+    void z16_temporal_smoothing_sse41( z16_temporal_smoothing const & ts );
+
+    extern const bool z16_temporal_smoothing_avx2_built;
+    void z16_temporal_smoothing_avx2( z16_temporal_smoothing const & ts );
+
+    extern const bool z16_temporal_smoothing_neon_built;
+    void z16_temporal_smoothing_neon( z16_temporal_smoothing const & ts );
+}
@@ -9,6 +9,8 @@
 #include "context.h"
 #include "proc/synthetic-stream.h"
 #include "proc/temporal-filter.h"
+#include "proc/temporal-filter-simd.h"
+#include "proc/color-formats-converter.h"
 
 #include <rsutils/string/from.h>
 
@@ -23,6 +25,24 @@ namespace librealsense
     const uint8_t persistence_default = 3;  // Credible if two of the last four frames are valid at this pixel
     const uint8_t persistence_step = 1;
 
+    // Per persistence mode: a missing pixel is credible if it was valid in 'min_valid' of the last 'frames' frames
+    struct persistence_rule
+    {
+        uint8_t frames;
+        uint8_t min_valid;
+    };
+    const persistence_rule persistence_rules[PERSISTENCE_MAP_NUM] = {
+        { 0, 1 },  // Disabled
+        { 8, 8 },  // Valid in 8/8
+        { 3, 2 },  // Valid in 2/last 3 <--- default choice in current libRS implementation
+        { 4, 2 },  // Valid in 2/last 4 <--- default choice recommended
+        { 8, 2 },  // Valid in 2/8
+        { 2, 1 },  // Valid in 1/last 2
+        { 5, 1 },  // Valid in 1/last 5
+        { 8, 1 },  // Valid in 1/8 <--- most filling
+        { 0, 0 },  // Always on
+    };
+
     //alpha -  the weight with default value 0.4, between 1 and 0 -- 1 means 100% weight from the current pixel
     const float temp_alpha_min = 0.f;
     const float temp_alpha_max = 1.f;
@@ -127,7 +147,7 @@ namespace librealsense
         // Temporal filter execution
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
             temp_jw_smooth<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
-        else
+        else if (!temp_jw_smooth_z16_simd(const_cast<void*>(tgt.get_data())))
             temp_jw_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
 
         return tgt;
@@ -141,6 +161,7 @@ namespace librealsense
         recalc_persistence_map();
         _last_frame.clear();
         _history.clear();
+        _history_planes.clear();
     }
 
     void temporal_filter::on_set_alpha(float val)
@@ -151,6 +172,7 @@ namespace librealsense
         _cur_frame_index = 0;
         _last_frame.clear();
         _history.clear();
+        _history_planes.clear();
     }
 
     void temporal_filter::on_set_delta(float val)
@@ -160,6 +182,7 @@ namespace librealsense
         _cur_frame_index = 0;
         _last_frame.clear();
         _history.clear();
+        _history_planes.clear();
     }
 
     void  temporal_filter::update_configuration(const rs2::frame& f)
@@ -183,6 +206,7 @@ namespace librealsense
 
             _history.clear();
             _history.resize(_current_frm_size_pixels*_bpp);
+            _history_planes.clear();
 
         }
     }
@@ -196,70 +220,62 @@ namespace librealsense
         return tgt;
     }
 
+    bool temporal_filter::temp_jw_smooth_z16_simd(void* frame_data)
+    {
+        enum class instruction_set { none, sse41, avx2, neon };
+        static const instruction_set isa = []()
+        {
+            if (z16_temporal_smoothing_avx2_built && has_avx2())
+                return instruction_set::avx2;
+            if (z16_temporal_smoothing_sse41_built && has_sse41())
+                return instruction_set::sse41;
+            if (z16_temporal_smoothing_neon_built)
+                return instruction_set::neon;
+            return instruction_set::none;
+        }();
+        if (isa == instruction_set::none)
+            return false;
+
+        size_t groups = (_current_frm_size_pixels + TEMPORAL_PIXELS_PER_GROUP - 1) / TEMPORAL_PIXELS_PER_GROUP;
+        if (_history_planes.size() != groups * 8)
+            _history_planes.assign(groups * 8, 0);
+
+        auto& rule = persistence_rules[_persistence_param < PERSISTENCE_MAP_NUM ? _persistence_param : 0];
+        z16_temporal_smoothing ts;
+        ts.frame = static_cast<uint16_t*>(frame_data);
+        ts.last_frame = reinterpret_cast<uint16_t*>(_last_frame.data());
+        ts.history = _history_planes.data();
+        ts.pixels = _current_frm_size_pixels;
+        ts.alpha = static_cast<uint16_t>(std::lround(_alpha_param * 32768));
+        ts.delta_z = _delta_param;
+        ts.frame_index = _cur_frame_index;
+        ts.persistence_frames = rule.frames;
+        ts.persistence_valid = rule.min_valid;
+
+        switch (isa)
+        {
+        case instruction_set::avx2: z16_temporal_smoothing_avx2(ts); break;
+        case instruction_set::sse41: z16_temporal_smoothing_sse41(ts); break;
+        default: z16_temporal_smoothing_neon(ts); break;
+        }
+
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        return true;
+    }
+
     void temporal_filter::recalc_persistence_map()
     {
         _persistence_map.fill(0);
 
+        auto& rule = persistence_rules[_persistence_param < PERSISTENCE_MAP_NUM ? _persistence_param : 0];
         for (size_t i = 0; i < _persistence_map.size(); i++)
         {
-            unsigned char last_7 = !!(i & 1);  // old
-            unsigned char last_6 = !!(i & 2);
-            unsigned char last_5 = !!(i & 4);
-            unsigned char last_4 = !!(i & 8);
-            unsigned char last_3 = !!(i & 16);
-            unsigned char last_2 = !!(i & 32);
-            unsigned char last_1 = !!(i & 64);
-            unsigned char lastFrame = !!(i & 128); // new
-
-            if (_persistence_param == 1)
-            {
-                int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
-                if (sum >= 8)  // valid in eight of the last eight frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 2) // <--- default choice in current libRS implementation
-            {
-                int sum = lastFrame + last_1 + last_2;
-                if (sum >= 2) // valid in two of the last three frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 3) // <--- default choice recommended
-            {
-                int sum = lastFrame + last_1 + last_2 + last_3;
-                if (sum >= 2)  // valid in two of the last four frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 4)
-            {
-                int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
-                if (sum >= 2) // valid in two of the last eight frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 5)
-            {
-                int sum = lastFrame + last_1;
-                if (sum >= 1) // valid in one of the last two frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 6)
-            {
-                int sum = lastFrame + last_1 + last_2 + last_3 + last_4;
-                if (sum >= 1)  // valid in one of the last five frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 7) //  <--- most filling
-            {
-                int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
-                if (sum >= 1) // valid in one of the last eight frames
-                    _persistence_map[i] = 1;
-            }
-            else if (_persistence_param == 8) //  <--- all 1's
-            {
+            // Bit 7 is the newest frame, bit 0 the oldest
+            int sum = 0;
+            for (int f = 0; f < rule.frames; f++)
+                sum += !!(i & (128 >> f));
+            if (sum >= rule.min_valid)
                 _persistence_map[i] = 1;
-            }
-            else // all others, including 0, no persistance
-            {
-            }
         }
 
         // Convert to credible enough
@@ -89,6 +89,7 @@ namespace librealsense
         void on_set_delta(float val);
 
         void recalc_persistence_map();
+        bool temp_jw_smooth_z16_simd(void* frame_data);
         uint8_t                 _persistence_param;
 
         float                   _alpha_param;               // The normalized weight of the current pixel
@@ -102,6 +103,7 @@ namespace librealsense
         rs2::stream_profile     _target_stream_profile;
         std::vector<uint8_t>    _last_frame;                // Hold the last frame received for the current profile
         std::vector<uint8_t>    _history;                   // represents the history over the last 8 frames, 1 bit per frame
+        std::vector<uint32_t>   _history_planes;            // the same, packed as bit-planes for the vectorized Z16 path
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
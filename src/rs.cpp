@@ -174,6 +174,15 @@ rs2_context* rs2_create_context(int api_version, rs2_error** error) BEGIN_API_CA
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, api_version)
 
+rs2_context* rs2_create_context_ex(int api_version, const char* json_settings, rs2_error** error) BEGIN_API_CALL
+{
+    verify_version_compatibility(api_version);
+
+    return new rs2_context{ std::make_shared< librealsense::context >( librealsense::backend_type::standard,
+                                                                       json_settings ? json_settings : "" ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, api_version)
+
 void rs2_delete_context(rs2_context* context) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(context);
@@ -1203,6 +1212,52 @@ void rs2_override_extrinsics( const rs2_sensor* sensor, const rs2_extrinsics* ex
 }
 HANDLE_EXCEPTIONS_AND_RETURN( , sensor, extrinsics )
 
+void rs2_get_frame_pool_stats( const rs2_sensor* sensor, rs2_frame_pool_stats* stats, rs2_error** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    VALIDATE_NOT_NULL( stats );
+
+    auto sb = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! sb )
+        throw std::runtime_error( "Sensor does not allocate its own frames" );
+    *stats = sb->get_frame_pool_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN( , sensor, stats )
+
+void rs2_set_frame_allocator( const rs2_sensor* sensor, rs2_frame_allocate_callback_ptr allocate,
+                              rs2_frame_free_callback_ptr free, void* user, rs2_error** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    if( ! allocate != ! free )
+        throw librealsense::invalid_value_exception( "allocate and free must be provided together" );
+
+    auto sb = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! sb )
+        throw std::runtime_error( "Sensor does not allocate its own frames" );
+
+    librealsense::frame_allocator_ptr allocator;
+    if( allocate )
+        allocator.reset( new librealsense::frame_allocator( allocate, free, user ),
+                         []( rs2_frame_allocator * p ) { p->release(); } );
+    sb->set_frame_allocator( allocator );
+}
+HANDLE_EXCEPTIONS_AND_RETURN( , sensor, allocate, free, user )
+
+void rs2_set_frame_allocator_cpp( const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error ) BEGIN_API_CALL
+{
+    // Take ownership of the allocator ASAP or else memory leaks could result if we throw!
+    librealsense::frame_allocator_ptr allocator_ptr;
+    if( allocator )
+        allocator_ptr.reset( allocator, []( rs2_frame_allocator * p ) { p->release(); } );
+
+    VALIDATE_NOT_NULL( sensor );
+    auto sb = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! sb )
+        throw std::runtime_error( "Sensor does not allocate its own frames" );
+    sb->set_frame_allocator( allocator_ptr );
+}
+HANDLE_EXCEPTIONS_AND_RETURN( , sensor, allocator )
+
 void rs2_get_dsm_params( const rs2_sensor * sensor, rs2_dsm_params * p_params_out, rs2_error** error ) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL( sensor );
@@ -1683,6 +1738,25 @@ void rs2_playback_device_stop(const rs2_device* device, rs2_error** error) BEGIN
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_playback_device_set_read_ahead(const rs2_device* device, int frames, int megabytes, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_RANGE(frames, 0, int(librealsense::playback_read_ahead::max_frames));
+    VALIDATE_RANGE(megabytes, 0, std::numeric_limits<int>::max());
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_read_ahead(frames, size_t(megabytes) << 20);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, frames, megabytes)
+
+void rs2_playback_device_get_read_ahead_stats(const rs2_device* device, rs2_playback_read_ahead_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(stats);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    *stats = playback->get_read_ahead_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stats)
+
 rs2_device* rs2_create_record_device(const rs2_device* device, const char* file, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1706,6 +1780,20 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_with_compression(const rs2_device* device, const char* file, rs2_record_compression compression, int level, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file);
+    VALIDATE_ENUM(compression);
+
+    return new rs2_device({
+        device->ctx,
+        device->info,
+        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression, level))
+        });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file, compression, level)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1730,6 +1818,15 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_get_write_stats(const rs2_device* device, rs2_record_write_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(stats);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    *stats = record_device->get_write_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stats)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -1846,6 +1943,22 @@ int rs2_pipeline_try_wait_for_frames(rs2_pipeline* pipe, rs2_frame** output_fram
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, pipe, output_frame)
 
+rs2_time_t rs2_pipeline_get_frames_latency(rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    return pipe->pipeline->get_frames_latency();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, pipe)
+
+unsigned long long rs2_pipeline_get_dropped_framesets(rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    return pipe->pipeline->get_dropped_framesets();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, pipe)
+
 void rs2_delete_pipeline(rs2_pipeline* pipe) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(pipe);
@@ -2044,6 +2157,13 @@ void rs2_config_disable_all_streams(rs2_config* config, rs2_error ** error) BEGI
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, config)
 
+void rs2_config_enable_low_latency(rs2_config* config, int enable, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+    config->config->enable_low_latency(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, enable)
+
 rs2_pipeline_profile* rs2_config_resolve(rs2_config* config, rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(config);
@@ -2112,6 +2232,14 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::multi_device_syncer>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2135,6 +2263,32 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, on_frame, user)
 
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    // Take ownership of the allocator ASAP or else memory leaks could result if we throw!
+    frame_allocator_ptr allocator_ptr;
+    if (allocator)
+        allocator_ptr.reset(allocator, [](rs2_frame_allocator* p) { p->release(); });
+
+    VALIDATE_NOT_NULL(block);
+    block->block->set_frame_allocator(allocator_ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocator)
+
+void rs2_set_processing_block_frame_allocator_fptr(rs2_processing_block* block, rs2_frame_allocate_callback_ptr allocate,
+    rs2_frame_free_callback_ptr free, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    if (!allocate != !free)
+        throw invalid_value_exception("allocate and free must be provided together");
+
+    frame_allocator_ptr allocator;
+    if (allocate)
+        allocator.reset(new frame_allocator(allocate, free, user), [](rs2_frame_allocator* p) { p->release(); });
+    block->block->set_frame_allocator(allocator);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocate, free, user)
+
 void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* queue, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -2227,6 +2381,14 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
 
+const unsigned char* rs2_get_frame_points_mask(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_validity_mask();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
 int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
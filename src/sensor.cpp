@@ -14,6 +14,7 @@
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
 #include <array>
 #include <set>
 #include <unordered_set>
@@ -64,6 +65,7 @@ void log_callback_end( uint32_t fps,
     })
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK, _source.get_pool_high_water_mark_option());
 
         register_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL, std::make_shared<librealsense::md_time_of_arrival_parser>());
 
@@ -203,6 +205,13 @@ void log_callback_end( uint32_t fps,
         target->set_unique_id(uid);
     }
 
+    void sensor_base::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        if (is_streaming())
+            throw wrong_api_call_sequence_exception("Frame allocator can not be changed while streaming!");
+        _source.set_frame_allocator(allocator);
+    }
+
     void sensor_base::set_source_owner(sensor_base* owner)
     {
         _source_owner = owner;
@@ -389,6 +398,12 @@ void log_callback_end( uint32_t fps,
 
         verify_supported_requests(requests);
 
+        // Frames lent to the user hold kernel buffers, so more of them are required to keep streaming
+        const int zero_copy_frames = _zero_copy_frames;
+        const int kernel_buffers = DEFAULT_V4L2_FRAME_BUFFERS + zero_copy_frames;
+        _lender->open(zero_copy_frames);
+        auto lender = _lender;
+
         for (auto&& req_profile : requests)
         {
             auto&& req_profile_base = std::dynamic_pointer_cast<stream_profile_base>(req_profile);
@@ -397,7 +412,7 @@ void log_callback_end( uint32_t fps,
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
                 _device->probe_and_commit(req_profile_base->get_backend_profile(),
-                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp, zero_copy_frames, lender](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     const auto&& system_time = environment::get_instance().get_time_service()->get_time();
 
@@ -451,21 +466,43 @@ void log_callback_end( uint32_t fps,
                     if (val_in_range(req_profile_base->get_format(), { RS2_FORMAT_MJPEG, RS2_FORMAT_Z16H }))
                         expected_size = static_cast<int>(f.frame_size);
 
+                    // method should be limited to use of MIPI - not for USB
+                    // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
+                    // when the resolution's width is not aligned to 64
+                    bool requires_realignment = (width * bpp >> 3) % 64 != 0 && f.frame_size > expected_size;
+
+                    // The calibration format Y12BPP is modified to be 32 bits instead of 24 due to an issue with MIPI driver
+                    // and padding that occurs in transmission.
+                    // For D4xx cameras the original 24 bit support is achieved by comparing actual vs expected size:
+                    // when it is exactly 75% of the MIPI-generated size (24/32bpp), then 24bpp-sized image will be processed
+                    if (!requires_realignment && req_profile_base->get_format() == RS2_FORMAT_Y12I)
+                        if (((expected_size>>2)*3)==sizeof(byte) * f.frame_size)
+                            expected_size = sizeof(byte) * f.frame_size;
+
+                    // Lend the backend buffer to the frame as long as the user does not hold on to
+                    // too many of them; otherwise fall back to copying so that streaming can go on
+                    std::function<void()> give_back;
+                    if (zero_copy_frames && !requires_realignment && f.frame_size >= expected_size)
+                        give_back = lender->lend(continuation);
+                    bool const zero_copy = bool(give_back);
+
                     frame_holder fh = _source.alloc_frame(
                         stream_to_frame_types( req_profile_base->get_stream_type() ),
-                        expected_size,
+                        zero_copy ? 0 : expected_size,
                         fr->additional_data,
-                        true );
+                        !zero_copy );
                     auto diff = environment::get_instance().get_time_service()->get_time() - system_time;
                     if( diff > 10 )
                         LOG_DEBUG("!! Frame allocation took " << diff << " msec");
 
                     if (fh.frame)
                     {
-                        // method should be limited to use of MIPI - not for USB
-                        // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
-                        // when the resolution's width is not aligned to 64
-                        if ((width * bpp >> 3) % 64 != 0 && f.frame_size > expected_size)
+                        if (zero_copy)
+                        {
+                            // The backend buffer is released (re-queued) when the last reference to the frame is gone
+                            fh->attach_continuation(frame_continuation(give_back, f.pixels, expected_size));
+                        }
+                        else if (requires_realignment)
                         {
                             std::vector<byte> pixels = align_width_to_64(width, height, bpp, (byte*)f.pixels);
                             assert( expected_size == sizeof(byte) * pixels.size());
@@ -473,16 +510,10 @@ void log_callback_end( uint32_t fps,
                         }
                         else
                         {
-                            // The calibration format Y12BPP is modified to be 32 bits instead of 24 due to an issue with MIPI driver
-                            // and padding that occurs in transmission.
-                            // For D4xx cameras the original 24 bit support is achieved by comparing actual vs expected size:
-                            // when it is exactly 75% of the MIPI-generated size (24/32bpp), then 24bpp-sized image will be processed
-                            if (req_profile_base->get_format() == RS2_FORMAT_Y12I)
-                                if (((expected_size>>2)*3)==sizeof(byte) * f.frame_size)
-                                    expected_size = sizeof(byte) * f.frame_size;
-                            
-                            assert(expected_size == sizeof(byte) * f.frame_size);
-                            memcpy((void*)fh->get_frame_data(), f.pixels, expected_size);
+                            // A partial frame leaves the rest of the buffer, which is not zero-filled, blank
+                            auto const copied = std::min( expected_size, sizeof( byte ) * f.frame_size );
+                            memcpy( (void *)fh->get_frame_data(), f.pixels, copied );
+                            memset( (byte *)fh->get_frame_data() + copied, 0, expected_size - copied );
                         }
 
                         auto&& video = dynamic_cast<video_frame*>(fh.frame);
@@ -496,6 +527,8 @@ void log_callback_end( uint32_t fps,
                     }
                     else
                     {
+                        if (zero_copy)
+                            give_back();
                         LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
                         return;
                     }
@@ -506,7 +539,8 @@ void log_callback_end( uint32_t fps,
 
                     // calling the continuation method, and releasing the backend frame buffer
                     // since the content of the OS frame buffer has been copied, it can released ASAP
-                    continuation();
+                    if (!zero_copy)
+                        continuation();
 
                     if (fh->get_stream().get())
                     {
@@ -526,10 +560,11 @@ void log_callback_end( uint32_t fps,
                                           stream_type,
                                           frame_number );
                     }
-                });
+                }, kernel_buffers);
             }
             catch (...)
             {
+                _lender->close();
                 for (auto&& commited_profile : commited)
                 {
                     _device->close(commited_profile);
@@ -557,6 +592,7 @@ void log_callback_end( uint32_t fps,
         {
             std::stringstream error_msg;
             error_msg << "\tFormats: \n";
+            _lender->close();
             for (auto&& profile : _internal_config)
             {
                 rs2_format fmt = fourcc_to_rs2_format(profile.format);
@@ -588,6 +624,8 @@ void log_callback_end( uint32_t fps,
         else if (!_is_opened)
             throw wrong_api_call_sequence_exception("close() failed. UVC device was not opened!");
 
+        // Frames the user still holds keep their buffers; the backend takes them back on close
+        _lender->close();
         for (auto&& profile : _internal_config)
         {
             try // Handle disconnect event
@@ -1118,10 +1156,20 @@ void log_callback_end( uint32_t fps,
         : sensor_base(name, dev, (recommended_proccesing_blocks_interface*)this),
         _device(std::move(uvc_device)),
         _user_count(0),
-        _timestamp_reader(std::move(timestamp_reader))
+        _timestamp_reader(std::move(timestamp_reader)),
+        _zero_copy_frames(0),
+        _lender(std::make_shared<frame_buffer_lender>())
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP, make_additional_data_parser(&frame_additional_data::backend_timestamp));
         register_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE, make_additional_data_parser(&frame_additional_data::raw_size));
+
+        if (_device->supports_zero_copy())
+        {
+            register_option(RS2_OPTION_ZERO_COPY_FRAMES, std::make_shared<ptr_option<int>>(0, MAX_ZERO_COPY_FRAMES, 1, 0, &_zero_copy_frames,
+                "Number of frames that may reference the kernel buffer directly instead of copying it. "
+                "Additional kernel buffers are negotiated accordingly; frames are copied once the user holds more. "
+                "Takes effect on the next stream open"));
+        }
     }
 
     iio_hid_timestamp_reader::iio_hid_timestamp_reader()
@@ -1224,6 +1272,14 @@ void log_callback_end( uint32_t fps,
         auto& raw_fourcc_to_rs2_stream_map = _raw_sensor->get_fourcc_to_rs2_stream_map();
         _fourcc_to_rs2_stream = std::make_shared<std::map<uint32_t, rs2_stream>>(fourcc_to_rs2_stream_map);
         raw_fourcc_to_rs2_stream_map = _fourcc_to_rs2_stream;
+
+        // Backend zero-copy is configured on the raw sensor, expose it to the user
+        if (auto zero_copy = _raw_sensor->get_option_handler(RS2_OPTION_ZERO_COPY_FRAMES))
+            sensor_base::register_option(RS2_OPTION_ZERO_COPY_FRAMES, zero_copy);
+
+        // Raw frames are allocated by the raw sensor, so its pool is the one worth tuning
+        sensor_base::register_option(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK,
+                                     _raw_sensor->get_option_handler(RS2_OPTION_FRAME_POOL_HIGH_WATER_MARK));
     }
 
     synthetic_sensor::~synthetic_sensor()
@@ -1573,6 +1629,8 @@ void log_callback_end( uint32_t fps,
             // Retrieve source profile from cached map and generate the relevant processing block.
             std::unordered_set<std::shared_ptr<stream_profile_interface>> current_resolved_reqs;
             auto best_pb = best_pbf->generate();
+            if (_frame_allocator)
+                best_pb->set_frame_allocator(_frame_allocator);
             register_processing_block_options(*best_pb);
             for (auto&& req : best_reqs)
             {
@@ -1810,6 +1868,28 @@ void log_callback_end( uint32_t fps,
         return _raw_sensor->is_opened();
     }
 
+    void synthetic_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        sensor_base::set_frame_allocator(allocator);
+        // Raw frames, and the frames converted from them, all land in the user's memory
+        _raw_sensor->set_frame_allocator(allocator);
+        for (auto&& entry : _profiles_to_processing_block)
+            for (auto&& pb : entry.second)
+                pb->set_frame_allocator(allocator);
+        _frame_allocator = allocator;
+    }
+
+    rs2_frame_pool_stats synthetic_sensor::get_frame_pool_stats() const
+    {
+        auto stats = sensor_base::get_frame_pool_stats();
+        auto raw_stats = _raw_sensor->get_frame_pool_stats();
+        stats.hits += raw_stats.hits;
+        stats.misses += raw_stats.misses;
+        stats.bytes_resident += raw_stats.bytes_resident;
+        return stats;
+    }
+
     void motion_sensor::create_snapshot(std::shared_ptr<motion_sensor>& snapshot) const
     {
         snapshot = std::make_shared<motion_sensor_snapshot>();
@@ -20,6 +20,7 @@
 #include "core/roi.h"
 #include "core/options.h"
 #include "source.h"
+#include "frame-buffer-lender.h"
 #include "core/extension.h"
 #include "proc/processing-blocks-factory.h"
 #include "proc/identity-processing-block.h"
@@ -70,6 +71,8 @@ namespace librealsense
             _on_open = callback;
         }
         virtual void set_frame_metadata_modifier(on_frame_md callback) { _metadata_modifier = callback; }
+        virtual rs2_frame_pool_stats get_frame_pool_stats() const { return _source.get_pool_stats(); }
+        virtual void set_frame_allocator(frame_allocator_ptr allocator);
         device_interface& get_device() override;
 
         // Make sensor inherit its owning device info by default
@@ -238,6 +241,8 @@ namespace librealsense
         void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const override;
         bool is_streaming() const override;
         bool is_opened() const override;
+        rs2_frame_pool_stats get_frame_pool_stats() const override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
 
     protected:
         void add_source_profiles_missing_data();
@@ -264,6 +269,7 @@ namespace librealsense
         std::unordered_map<stream_profile, stream_profiles> _target_to_source_profiles_map;
         std::unordered_map<rs2_format, stream_profiles> _cached_requests;
         std::vector<rs2_option> _cached_processing_blocks_options;
+        frame_allocator_ptr _frame_allocator;
     };
 
     class iio_hid_timestamp_reader : public frame_timestamp_reader
@@ -404,6 +410,8 @@ namespace librealsense
         std::vector<platform::extension_unit> _xus;
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
+        int _zero_copy_frames;                          // Max frames referencing backend buffers, 0 = always copy
+        std::shared_ptr<frame_buffer_lender> _lender;   // Backend buffers held by frames of the open stream
     };
 
     processing_blocks get_color_recommended_proccesing_blocks();
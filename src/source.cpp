@@ -10,18 +10,19 @@
 
 namespace librealsense
 {
-    class frame_queue_size : public option_base
+    class frame_source_option : public option_base
     {
     public:
-        frame_queue_size(std::atomic<uint32_t>* ptr, const option_range& opt_range)
+        frame_source_option(std::atomic<uint32_t>* ptr, const option_range& opt_range, const char* description)
             : option_base(opt_range),
-              _ptr(ptr)
+              _ptr(ptr),
+              _description(description)
         {}
 
         void set(float value) override
         {
             if (!is_valid(value))
-                throw invalid_value_exception( rsutils::string::from() << "set(frame_queue_size) failed! Given value "
+                throw invalid_value_exception( rsutils::string::from() << "set(frame_source_option) failed! Given value "
                                                                        << value << " is out of range." );
 
             *_ptr = static_cast<uint32_t>(value);
@@ -32,22 +33,30 @@ namespace librealsense
 
         bool is_enabled() const override { return true; }
 
-        const char* get_description() const override
-        {
-            return "Max number of frames you can hold at a given time. Increasing this number will reduce frame drops but increase latency, and vice versa";
-        }
+        const char* get_description() const override { return _description; }
     private:
         std::atomic<uint32_t>* _ptr;
+        const char* _description;
     };
 
     std::shared_ptr<option> frame_source::get_published_size_option()
     {
-        return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 });
+        return std::make_shared<frame_source_option>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 },
+            "Max number of frames you can hold at a given time. Increasing this number will reduce frame drops but increase latency, and vice versa");
+    }
+
+    std::shared_ptr<option> frame_source::get_pool_high_water_mark_option()
+    {
+        return std::make_shared<frame_source_option>(_pool_high_water_mark_mb.get(),
+            option_range{ 0, 4096, 1, float(frame_buffer_pool::DEFAULT_HIGH_WATER_MARK_MB) },
+            "Max size, in MB, of the idle frame buffers kept for reuse. Buffers released beyond it are freed");
     }
 
     frame_source::frame_source(uint32_t max_publish_list_size)
             : _callback(nullptr, [](rs2_frame_callback*) {}),
               _max_publish_list_size(max_publish_list_size),
+              _pool_high_water_mark_mb(std::make_shared<std::atomic<uint32_t>>(frame_buffer_pool::DEFAULT_HIGH_WATER_MARK_MB)),
+              _pool(std::make_shared<frame_buffer_pool>(_pool_high_water_mark_mb)),
               _ts(environment::get_instance().get_time_service())
     {}
 
@@ -65,8 +74,9 @@ namespace librealsense
 
         for (auto type : supported)
         {
-            _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers);
+            _archive[type] = make_archive(type, &_max_publish_list_size, _pool, _ts, metadata_parsers);
         }
+        _pool->start();
 
         _metadata_parsers = metadata_parsers;
     }
@@ -95,6 +105,26 @@ namespace librealsense
         return it->second->alloc_and_track(size, additional_data, requires_memory);
     }
 
+    rs2_frame_pool_stats frame_source::get_pool_stats() const
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        return _pool->get_stats();
+    }
+
+    void frame_source::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+
+        // Buffers already out keep the pool (and allocator) they came from
+        _pool->flush();
+        _pool = std::make_shared<frame_buffer_pool>(_pool_high_water_mark_mb, allocator);
+        for (auto&& kvp : _archive)
+        {
+            if (kvp.second)
+                kvp.second->set_frame_buffer_pool(_pool);
+        }
+    }
+
     void frame_source::set_sensor(const std::shared_ptr<sensor_interface>& s)
     {
         for (auto&& a : _archive)
@@ -145,6 +175,9 @@ namespace librealsense
             if (kvp.second)
                 kvp.second->flush();
         }
+
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        _pool->flush();
     }
 }
 
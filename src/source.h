@@ -24,6 +24,12 @@ namespace librealsense
         void reset();
 
         std::shared_ptr<option> get_published_size_option();
+        std::shared_ptr<option> get_pool_high_water_mark_option();
+
+        rs2_frame_pool_stats get_pool_stats() const;
+
+        // Payloads of frames allocated from now on come from the given allocator (or the heap, if null)
+        void set_frame_allocator(frame_allocator_ptr allocator);
 
         frame_interface* alloc_frame(rs2_extension type, size_t size, frame_additional_data additional_data, bool requires_memory) const;
 
@@ -43,7 +49,8 @@ namespace librealsense
         template<class T>
         void add_extension(rs2_extension ex)
         {
-            _archive[ex] = std::make_shared<frame_archive<T>>(&_max_publish_list_size, _ts, _metadata_parsers);
+            std::lock_guard<std::mutex> lock(_callback_mutex);
+            _archive[ex] = std::make_shared<frame_archive<T>>(&_max_publish_list_size, _pool, _ts, _metadata_parsers);
         }
 
         void set_max_publish_list_size(int qsize) {_max_publish_list_size = qsize; }
@@ -56,6 +63,8 @@ namespace librealsense
         std::map<rs2_extension, std::shared_ptr<archive_interface>> _archive;
 
         std::atomic<uint32_t> _max_publish_list_size;
+        std::shared_ptr<std::atomic<uint32_t>> _pool_high_water_mark_mb; // shared with the pools, which may outlive us
+        std::shared_ptr<frame_buffer_pool> _pool; // shared by all archives, guarded by _callback_mutex
         frame_callback_ptr _callback;
         std::shared_ptr<platform::time_service> _ts;
         std::shared_ptr<metadata_parser_map> _metadata_parsers;
@@ -116,15 +116,19 @@ namespace librealsense
     {
         for (auto&& matcher : matchers)
         {
-            for (auto&& stream : matcher->get_streams())
+            if( ! matcher->get_streams().empty() )
             {
                 matcher->set_callback(
                     [&]( frame_holder f, const syncronization_environment & env ) {
                         LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
                         sync( std::move( f ), env );
                     } );
-                _matchers[stream] = matcher;
-                _streams_id.push_back(stream);
+                auto slot = add_slot( matcher );
+                for( auto && stream : matcher->get_streams() )
+                {
+                    map_stream( stream, slot );
+                    _streams_id.push_back( stream );
+                }
             }
             for (auto&& stream : matcher->get_streams_types())
             {
@@ -135,16 +139,72 @@ namespace librealsense
         _name = create_composite_name(matchers, name);
     }
 
+    size_t composite_matcher::add_slot( std::shared_ptr< matcher > const & m )
+    {
+        // A matcher whose streams were all taken over by others is dropped, and its slot reused: a device may
+        // create a new matcher for each frame of a stream it does not match
+        for( size_t i = 0; i < _slots.size(); ++i )
+        {
+            if( ! _slots[i]->streams && ! _slots[i]->queued )
+            {
+                _slots[i].reset( new matcher_slot );
+                _slots[i]->m = m;
+                return i;
+            }
+        }
+
+        _slots.emplace_back( new matcher_slot );
+        _slots.back()->m = m;
+
+        auto const n = _slots.size();
+        _frames_arrived.reserve( n );
+        _frames_arrived_slots.reserve( n );
+        _missing_streams.reserve( n );
+        _synced_frames.reserve( n );
+        _unsynced_frames.reserve( n );
+        _synced_ids.reserve( n );
+        return n - 1;
+    }
+
+    void composite_matcher::map_stream( stream_id stream, size_t slot )
+    {
+        auto it = _stream_slots.find( stream );
+        if( it != _stream_slots.end() )
+            --_slots[it->second]->streams;
+        _stream_slots[stream] = slot;
+        ++_slots[slot]->streams;
+    }
+
+    single_consumer_frame_queue< frame_holder > & composite_matcher::queue_of( matcher_slot & slot )
+    {
+        if( ! slot.queued )
+        {
+            // A fresh queue, as if the removed one was never there
+            slot.queue.clear();
+            slot.queue.start();
+            slot.queued = true;
+        }
+        return slot.queue;
+    }
+
+    void composite_matcher::remove_queue( matcher_slot & slot )
+    {
+        slot.queue.clear();
+        slot.queued = false;
+    }
+
     void composite_matcher::dispatch(frame_holder f, const syncronization_environment& env)
     {
         clean_inactive_streams(f);
-        auto matcher = find_matcher(f);
+        auto slot = find_slot(f);
 
         //LOG_IF_ENABLE( "--> composite_matcher: " << _name, env );
 
-        if (matcher)
+        if( slot < _slots.size() )
         {
-            update_last_arrived(f, matcher.get());
+            update_last_arrived(f, slot);
+            // Held: syncing may hand the slot over to a new matcher while this one is still dispatching
+            auto matcher = _slots[slot]->m;
             matcher->dispatch(std::move(f), env);
         }
         else
@@ -155,31 +215,35 @@ namespace librealsense
     }
 
     std::shared_ptr<matcher> composite_matcher::find_matcher(const frame_holder& frame)
+    {
+        auto slot = find_slot( frame );
+        if( slot < _slots.size() )
+            return _slots[slot]->m;
+        return nullptr;
+    }
+
+    // Returns the slot of the frame's stream, creating its matcher if needed, or the number of slots if there is none
+    size_t composite_matcher::find_slot( const frame_holder & frame )
     {
         auto stream_profile = frame.frame->get_stream();
         auto stream_id = stream_profile->get_unique_id();
         auto stream_type = stream_profile->get_stream_type();
 
-        std::shared_ptr<matcher> matcher;
-        auto it = _matchers.find( stream_id );
-        if( it != _matchers.end() )
+        auto it = _stream_slots.find( stream_id );
+        if( it != _stream_slots.end() )
         {
-            matcher = it->second;
-            if( matcher )
+            auto & slot = *_slots[it->second];
+            if( ! slot.m->get_active() )
             {
-                if( ! matcher->get_active() )
-                {
-                    matcher->set_active( true );
-                    _frames_queue[matcher.get()].start();
-                }
-                return matcher;
+                slot.m->set_active( true );
+                queue_of( slot ).start();
             }
+            return it->second;
         }
         LOG_DEBUG( "no matcher found for " << rs2_stream_to_string( stream_type ) << '/'
                                            << stream_id << "; creating matcher from device..." );
 
         auto sensor = frame.frame->get_sensor().get(); //TODO: Potential deadlock if get_sensor() gets a hold of the last reference of that sensor
-        auto dev_exist = false;
         if (sensor)
         {
             const device_interface* dev = nullptr;
@@ -193,8 +257,9 @@ namespace librealsense
             }
             if (dev)
             {
-                dev_exist = true;
-                matcher = dev->create_matcher(frame);
+                auto matcher = dev->create_matcher(frame);
+                if( ! matcher )
+                    return _slots.size();
                 LOG_DEBUG( "... created " << matcher->get_name() );
 
                 matcher->set_callback(
@@ -203,13 +268,14 @@ namespace librealsense
                         sync( std::move( f ), env );
                     } );
 
+                auto slot = add_slot( matcher );
                 for (auto stream : matcher->get_streams())
                 {
-                    if (_matchers[stream])
-                    {
-                        _frames_queue.erase(_matchers[stream].get());
-                    }
-                    _matchers[stream] = matcher;
+                    // The matcher that had the stream loses its queued frames
+                    auto replaced = _stream_slots.find( stream );
+                    if( replaced != _stream_slots.end() )
+                        remove_queue( *_slots[replaced->second] );
+                    map_stream( stream, slot );
                     _streams_id.push_back(stream);
                 }
                 for (auto stream : matcher->get_streams_types())
@@ -226,6 +292,7 @@ namespace librealsense
                     _name = create_composite_name( { matcher },
                                                     _name.substr( 1, _name.length() - 2 ) );  // Remove the "()" around "(CI: )"
                 }
+                return slot;
             }
         }
         else
@@ -233,25 +300,18 @@ namespace librealsense
             LOG_DEBUG("sensor does not exist");
         }
 
-        if (!dev_exist)
-        {
-            matcher = _matchers[stream_id];
-            // We don't know what device this frame came from, so just store it under device NULL with ID matcher
-            if (!matcher)
-            {
-                _matchers[stream_id] = std::make_shared<identity_matcher>(stream_id, stream_type);
-                _streams_id.push_back(stream_id);
-                _streams_type.push_back(stream_type);
-                matcher = _matchers[stream_id];
-
-                matcher->set_callback(
-                    [&]( frame_holder f, syncronization_environment const & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-            }
-        }
-        return matcher;
+        // We don't know what device this frame came from, so just store it under device NULL with ID matcher
+        auto matcher = std::make_shared< identity_matcher >( stream_id, stream_type );
+        matcher->set_callback(
+            [&]( frame_holder f, syncronization_environment const & env ) {
+                LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
+                sync( std::move( f ), env );
+            } );
+        auto slot = add_slot( matcher );
+        map_stream( stream_id, slot );
+        _streams_id.push_back(stream_id);
+        _streams_type.push_back(stream_type);
+        return slot;
     }
 
     void composite_matcher::stop()
@@ -263,12 +323,14 @@ namespace librealsense
         set_active( false );
 
         // Stop all our queues to wake up anyone waiting on them
-        for( auto & fq : _frames_queue )
-            fq.second.stop();
+        for( auto & slot : _slots )
+            if( slot->queued )
+                slot->queue.stop();
 
         // Trickle the stop down to any children
-        for( auto m : _matchers )
-            m.second->stop();
+        for( auto & slot : _slots )
+            if( slot->streams )
+                slot->m->stop();
     }
 
     std::string
@@ -280,15 +342,13 @@ namespace librealsense
         return str;
     }
 
-    std::string
-        composite_matcher::matchers_to_string( std::vector< librealsense::matcher* > const& matchers )
+    std::string composite_matcher::slots_to_string( std::vector< size_t > const & slots )
     {
         std::string str;
         str += '[';
-        for( auto m : matchers )
+        for( auto i : slots )
         {
-            auto const & q = _frames_queue[m];
-            q.peek( [&str]( frame_holder const & fh ) {
+            _slots[i]->queue.peek( [&str]( frame_holder const & fh ) {
                 str += frame_to_string( *fh.frame );
                 } );
         }
@@ -298,20 +358,20 @@ namespace librealsense
 
     void composite_matcher::sync(frame_holder f, const syncronization_environment& env)
     {
-        auto matcher = find_matcher(f);
-        if (!matcher)
+        auto const index = find_slot(f);
+        if( index >= _slots.size() )
         {
             LOG_ERROR("didn't find any matcher for " << frame_holder_to_string(f) << " will not be synchronized");
             _callback(std::move(f), env);
             return;
         }
-        update_next_expected( matcher, f );
+        update_next_expected( index, f );
 
         // We want to keep track of a "last-arrived" frame which is our current equivalent of "now" -- it contains the
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].enqueue( std::move( f ) ) )
+        if( ! queue_of( *_slots[index] ).enqueue( std::move( f ) ) )
             // If we get stopped, nothing to do!
             return;
 
@@ -320,38 +380,34 @@ namespace librealsense
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
-
         while( true )
         {
-            missing_streams.clear();
-            frames_arrived_matchers.clear();
-            frames_arrived.clear();
-
             std::vector< frame_holder > match;
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
 
+                _missing_streams.clear();
+                _frames_arrived_slots.clear();
+                _frames_arrived.clear();
+
                 // We want to release one frame from each matcher. If a matcher has nothing queued, it is "missing" and
                 // we need to consider waiting for it:
-                for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
+                for( size_t i = 0; i < _slots.size(); ++i )
                 {
-                    librealsense::matcher * const m = s->first;
-                    if( ! s->second.peek( [&]( frame_holder & fh ) {
+                    auto & slot = *_slots[i];
+                    if( ! slot.queued )
+                        continue;
+                    if( ! slot.queue.peek( [&]( frame_holder & fh ) {
                             LOG_IF_ENABLE( "... have " << *fh.frame, env );
-                            frames_arrived.push_back( &fh );
-                            frames_arrived_matchers.push_back( m );
+                            _frames_arrived.push_back( &fh );
+                            _frames_arrived_slots.push_back( i );
                         } ) )
                     {
-                        missing_streams.push_back( m );
+                        _missing_streams.push_back( i );
                     }
                 }
-                if( frames_arrived.empty() )
+                if( _frames_arrived.empty() )
                 {
                     // LOG_IF_ENABLE( "... nothing more to do", env );
                     break;
@@ -361,40 +417,40 @@ namespace librealsense
                 // number, etc.) -- anything else we'll leave to the next iteration. The synced frames should be the
                 // earliest possible!
 
-                frame_holder * curr_sync = frames_arrived[0];
-                synced_frames.clear();
-                synced_frames.push_back( 0 );
+                frame_holder * curr_sync = _frames_arrived[0];
+                _synced_frames.clear();
+                _synced_frames.push_back( 0 );
 
                 // Sometimes we have to release newly-arrived frames even before frames we already had previously
                 // queued. If we have something like this, 'have_unsynced_frames' will be true:
-                unsynced_frames.clear();
-                for( auto i = 1; i < frames_arrived.size(); i++ )
+                _unsynced_frames.clear();
+                for( size_t i = 1; i < _frames_arrived.size(); i++ )
                 {
-                    if( are_equivalent( *curr_sync, *frames_arrived[i] ) )
+                    if( are_equivalent( *curr_sync, *_frames_arrived[i] ) )
                     {
-                        synced_frames.push_back( i );
+                        _synced_frames.push_back( i );
                     }
-                    else if( is_smaller_than( *frames_arrived[i], *curr_sync ) )
+                    else if( is_smaller_than( *_frames_arrived[i], *curr_sync ) )
                     {
-                        unsynced_frames.insert( unsynced_frames.end(), synced_frames.begin(), synced_frames.end() );
-                        synced_frames.clear();
-                        synced_frames.push_back( i );
-                        curr_sync = frames_arrived[i];
+                        _unsynced_frames.insert( _unsynced_frames.end(), _synced_frames.begin(), _synced_frames.end() );
+                        _synced_frames.clear();
+                        _synced_frames.push_back( i );
+                        curr_sync = _frames_arrived[i];
                     }
                     else
                     {
-                        unsynced_frames.push_back( i );
+                        _unsynced_frames.push_back( i );
                     }
                 }
-                bool release_synced_frames = ( synced_frames.size() != 0 );
-                if( unsynced_frames.empty() )
+                bool release_synced_frames = ( _synced_frames.size() != 0 );
+                if( _unsynced_frames.empty() )
                 {
                     // Everything (could be only one!) matches together... but if we also have
                     // something missing, we can't release anything yet...
-                    for( auto i : missing_streams )
+                    for( auto i : _missing_streams )
                     {
-                        LOG_IF_ENABLE( "... missing " << i->get_name() << ", next expected "
-                                                      << _next_expected[i],
+                        LOG_IF_ENABLE( "... missing " << _slots[i]->m->get_name() << ", next expected "
+                                                      << _slots[i]->next_expected,
                                        env );
                         if( skip_missing_stream( *curr_sync, i, last_arrived, env ) )
                         {
@@ -408,36 +464,40 @@ namespace librealsense
                 }
                 else
                 {
-                    for( auto i : unsynced_frames )
+                    for( auto i : _unsynced_frames )
                     {
-                        LOG_IF_ENABLE( "  - " << *frames_arrived[i]->frame << " is not in sync; won't be released", env );
+                        LOG_IF_ENABLE( "  - " << *_frames_arrived[i]->frame << " is not in sync; won't be released", env );
                     }
                 }
                 if( ! release_synced_frames )
                     break;
 
-                match.reserve( synced_frames.size() );
-
-                for( auto index : synced_frames )
+                // The frameset should always be with the same order of streams (the first stream carries extra
+                // meaning because it decides the frameset properties) -- so they're sorted by descending stream ID
+                // as they're dequeued; there are only a few, and each ID is only looked up once
+                match.reserve( _synced_frames.size() );
+                _synced_ids.clear();
+                for( auto arrived : _synced_frames )
                 {
                     frame_holder frame;
                     int const timeout_ms = 5000;
-                    librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].dequeue( &frame, timeout_ms );
-                    match.push_back( std::move( frame ) );
+                    if( ! _slots[_frames_arrived_slots[arrived]]->queue.dequeue( &frame, timeout_ms ) )
+                    {
+                        LOG_ERROR( "failed to dequeue a synced frame; it will be missing from the frameset" );
+                        continue;
+                    }
+
+                    int const id = frame.frame->get_stream()->get_unique_id();
+                    size_t pos = _synced_ids.size();
+                    while( pos > 0 && _synced_ids[pos - 1] < id )
+                        --pos;
+                    _synced_ids.insert( _synced_ids.begin() + pos, id );
+                    match.insert( match.begin() + pos, std::move( frame ) );
                 }
             }
 
-            // The frameset should always be with the same order of streams (the first stream carries extra
-            // meaning because it decides the frameset properties) -- so we sort them...
-            std::sort( match.begin(),
-                       match.end(),
-                       []( const frame_holder & f1, const frame_holder & f2 ) {
-                           return f1.frame->get_stream()->get_unique_id()
-                                > f2.frame->get_stream()->get_unique_id();
-                       } );
-
-
+            if( match.empty() )
+                continue;
             frame_holder composite = env.source->allocate_composite_frame(std::move(match));
             if (composite.frame)
             {
@@ -453,9 +513,9 @@ namespace librealsense
     {
     }
 
-    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, size_t slot)
     {
-        _last_arrived[m] =f->get_frame_number();
+        _slots[slot]->last_arrived = (long long)f->get_frame_number();
     }
 
     bool frame_number_composite_matcher::are_equivalent(frame_holder& a, frame_holder& b)
@@ -468,43 +528,37 @@ namespace librealsense
     }
     void frame_number_composite_matcher::clean_inactive_streams(frame_holder& f)
     {
-        std::vector<stream_id> inactive_matchers;
-        for(auto m: _matchers)
+        for( auto & slot : _slots )
         {
-            if( _last_arrived[m.second.get()]
-                && ( fabs( (long long)f->get_frame_number()
-                           - (long long)_last_arrived[m.second.get()] ) )
+            if( slot->streams
+                && slot->last_arrived >= 0
+                && ( fabs( (long long)f->get_frame_number() - slot->last_arrived ) )
                        > 5 )
             {
                 std::stringstream s;
                 s << "clean inactive stream in "<<_name;
-                for (auto stream : m.second->get_streams_types())
+                for (auto stream : slot->m->get_streams_types())
                 {
                     s << stream << " ";
                 }
                 LOG_DEBUG(s.str());
 
-                inactive_matchers.push_back(m.first);
-                m.second->set_active(false);
+                slot->m->set_active(false);
+                queue_of( *slot ).clear();
             }
         }
-
-        for(auto id: inactive_matchers)
-        {
-            _frames_queue[_matchers[id].get()].clear();
-        }
     }
 
     bool
     frame_number_composite_matcher::skip_missing_stream( frame_interface const * const synced_frame,
-                                                         matcher * missing,
+                                                         size_t missing,
                                                          frame_header const & last_arrived,
                                                          const syncronization_environment & env )
     {
-         if(!missing->get_active())
+         if(!_slots[missing]->m->get_active())
              return true;
 
-        auto next_expected = _next_expected[missing];
+        auto next_expected = _slots[missing]->next_expected;
 
         if(synced_frame->get_frame_number() - next_expected > 4 || synced_frame->get_frame_number() < next_expected)
         {
@@ -513,10 +567,9 @@ namespace librealsense
         return false;
     }
 
-    void frame_number_composite_matcher::update_next_expected(
-        std::shared_ptr< matcher > const & matcher, const frame_holder & f )
+    void frame_number_composite_matcher::update_next_expected( size_t slot, const frame_holder & f )
     {
-        _next_expected[matcher.get()] = f.frame->get_frame_number()+1.;
+        _slots[slot]->next_expected = f.frame->get_frame_number()+1.;
     }
 
     std::pair<double, double> extract_timestamps(frame_holder & a, frame_holder & b)
@@ -559,16 +612,9 @@ namespace librealsense
         return ts.first < ts.second;
     }
 
-    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, size_t slot)
     {
-        if(f->supports_frame_metadata(RS2_FRAME_METADATA_ACTUAL_FPS))
-            _fps[m] = (uint32_t)f->get_frame_metadata(RS2_FRAME_METADATA_ACTUAL_FPS);
-        else
-            _fps[m] = f->get_stream()->get_framerate();
-
-        auto const now = environment::get_instance().get_time_service()->get_time();
-        //LOG_DEBUG( _name << ": _last_arrived[" << m->get_name() << "] = " << now );
-        _last_arrived[m] = now;
+        // Nothing to keep: skip_missing_stream() measures against the frames themselves
     }
 
     unsigned int timestamp_composite_matcher::get_fps( frame_interface const * f )
@@ -590,9 +636,7 @@ namespace librealsense
         return fps;
     }
 
-    void
-    timestamp_composite_matcher::update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                                       const frame_holder & f )
+    void timestamp_composite_matcher::update_next_expected( size_t slot, const frame_holder & f )
     {
         auto fps = get_fps( f );
         auto gap = 1000.f / (float)fps;
@@ -600,8 +644,8 @@ namespace librealsense
         auto ts = f.frame->get_frame_timestamp();
         auto ne = ts + gap;
         //LOG_DEBUG( "... next_expected = {timestamp}" << ts << " + {gap}(1000/{fps}" << fps << ") = " << ne );
-        _next_expected[matcher.get()] = ne;
-        _next_expected_domain[matcher.get()] = f.frame->get_frame_timestamp_domain();
+        _slots[slot]->next_expected = ne;
+        _slots[slot]->next_expected_domain = f.frame->get_frame_timestamp_domain();
     }
 
     void timestamp_composite_matcher::clean_inactive_streams(frame_holder& f)
@@ -610,25 +654,25 @@ namespace librealsense
     }
 
     bool timestamp_composite_matcher::skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                                           matcher * missing,
+                                                           size_t missing,
                                                            frame_header const & last_arrived,
                                                            const syncronization_environment & env )
     {
         // true : frameset is ready despite the missing stream (no use waiting) -- "skip" it
         // false: the missing stream is relevant and our frameset isn't ready yet!
 
-        if(!missing->get_active())
+        auto & slot = *_slots[missing];
+        if(!slot.m->get_active())
             return true;
 
         //LOG_IF_ENABLE( "...     matcher " << synced[0]->get_name(), env );
 
-        auto next_expected = _next_expected[missing];
+        auto next_expected = slot.next_expected;
         // LOG_IF_ENABLE( "...     next    " << std::fixed << next_expected, env );
 
-        auto it = _next_expected_domain.find( missing );
-        if( it != _next_expected_domain.end() )
+        if( slot.next_expected_domain != RS2_TIMESTAMP_DOMAIN_COUNT )
         {
-            if( it->second != last_arrived.timestamp_domain )
+            if( slot.next_expected_domain != last_arrived.timestamp_domain )
             {
                 // LOG_IF_ENABLE( "...     not the same domain: frameset not ready!", env );
                 // D457 dev - return false removed
@@ -697,13 +741,9 @@ namespace librealsense
             }
             LOG_IF_ENABLE( "...     exceeded cutout of {NE+7*gap}" << ( next_expected + threshold ) << "; deactivating matcher!", env );
 
-            auto const q_it = _frames_queue.find( missing );
-            if( q_it != _frames_queue.end() )
-            {
-                if( q_it->second.empty() )
-                    _frames_queue.erase( q_it );
-            }
-            missing->set_active( false );
+            if( slot.queue.empty() )
+                remove_queue( slot );
+            slot.m->set_active( false );
             return true;
         }
 
@@ -718,6 +758,143 @@ namespace librealsense
         return abs(a - b) < (gap / 2);
     }
 
+    namespace
+    {
+        // Global time is the host clock, as is the system time of frames
+        double host_time( frame_header const & h )
+        {
+            if( h.timestamp_domain == RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME
+                || h.timestamp_domain == RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME )
+                return h.timestamp;
+            return h.system_time;
+        }
+
+        unsigned int frame_fps( frame_interface const * f )
+        {
+            uint32_t fps = 0;
+            if( f->supports_frame_metadata( RS2_FRAME_METADATA_ACTUAL_FPS ) )
+                fps = (uint32_t)f->get_frame_metadata( RS2_FRAME_METADATA_ACTUAL_FPS );
+            if( ! fps )
+                fps = f->get_stream()->get_framerate();
+            return fps ? fps : 1;
+        }
+    }
+
+    multi_device_composite_matcher::multi_device_composite_matcher()
+        : composite_matcher( {}, "MD: " )
+        , _tolerance_ms( 0.f )
+    {
+    }
+
+    void multi_device_composite_matcher::set_callback( sync_callback f )
+    {
+        composite_matcher::set_callback( [this, f]( frame_holder fs, const syncronization_environment & env ) {
+            update_statistics( fs );
+            f( std::move( fs ), env );
+        } );
+    }
+
+    // Called from sync(), where dispatch() already keeps other threads out
+    void multi_device_composite_matcher::update_statistics( frame_holder const & frameset )
+    {
+        auto const now = environment::get_instance().get_time_service()->get_time();
+        double oldest = now;
+        _released_slots.clear();
+        auto add = [&]( frame_interface const * f ) {
+            auto const arrived = f->get_frame_system_time();
+            if( arrived > 0 && arrived < oldest )
+                oldest = arrived;
+            auto it = _stream_slots.find( f->get_stream()->get_unique_id() );
+            if( it != _stream_slots.end()
+                && std::find( _released_slots.begin(), _released_slots.end(), it->second ) == _released_slots.end() )
+                _released_slots.push_back( it->second );
+        };
+        if( auto composite = dynamic_cast< const composite_frame * >( frameset.frame ) )
+        {
+            for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+                add( composite->get_frame( int( i ) ) );
+        }
+        else
+            add( frameset.frame );
+
+        size_t active = 0;
+        for( auto & slot : _slots )
+            if( slot->streams && slot->m->get_active() )
+                ++active;
+
+        std::lock_guard< std::mutex > lock( _statistics_mutex );
+        ++_statistics.framesets;
+        if( _released_slots.size() < active )
+            ++_statistics.incomplete;
+        _total_latency_ms += now - oldest;
+        _statistics.latency_ms = _total_latency_ms / _statistics.framesets;
+    }
+
+    multi_device_composite_matcher::statistics multi_device_composite_matcher::get_statistics() const
+    {
+        std::lock_guard< std::mutex > lock( _statistics_mutex );
+        return _statistics;
+    }
+
+    bool multi_device_composite_matcher::are_equivalent( frame_holder & a, frame_holder & b )
+    {
+        return are_equivalent( host_time( a->get_header() ),
+                               host_time( b->get_header() ),
+                               std::min( frame_fps( a ), frame_fps( b ) ) );
+    }
+
+    bool multi_device_composite_matcher::is_smaller_than( frame_holder & a, frame_holder & b )
+    {
+        if( ! a || ! b )
+            return false;
+        return host_time( a->get_header() ) < host_time( b->get_header() );
+    }
+
+    bool multi_device_composite_matcher::are_equivalent( double a, double b, unsigned int fps ) const
+    {
+        float const tolerance = _tolerance_ms;
+        if( tolerance > 0 )
+            return std::abs( a - b ) <= tolerance;
+        return std::abs( a - b ) < 500. / fps;
+    }
+
+    void multi_device_composite_matcher::update_next_expected( size_t slot, const frame_holder & f )
+    {
+        _slots[slot]->next_expected = host_time( f->get_header() ) + 1000. / frame_fps( f );
+        _slots[slot]->next_expected_domain = f->get_frame_timestamp_domain();
+    }
+
+    bool multi_device_composite_matcher::skip_missing_stream( frame_interface const * waiting_to_be_released,
+                                                              size_t missing,
+                                                              frame_header const & last_arrived,
+                                                              const syncronization_environment & env )
+    {
+        // As in the timestamp matcher, but in host time: a device whose next frame is late by more than a few
+        // frames is no longer waited for until it sends one
+        auto & slot = *_slots[missing];
+        if( ! slot.m->get_active() )
+            return true;
+
+        auto const fps = frame_fps( waiting_to_be_released );
+        auto const next_expected = slot.next_expected;
+        auto const now = host_time( last_arrived );
+        if( now > next_expected )
+        {
+            auto const threshold = 7 * 1000. / fps;
+            if( now - next_expected < threshold )
+                return false;
+            LOG_IF_ENABLE( "...     exceeded cutout of {NE+7*gap}" << ( next_expected + threshold )
+                                                                    << "; deactivating matcher!",
+                           env );
+            if( slot.queue.empty() )
+                remove_queue( slot );
+            slot.m->set_active( false );
+            return true;
+        }
+
+        return ! are_equivalent( host_time( waiting_to_be_released->get_header() ), next_expected, fps );
+    }
+
     composite_identity_matcher::composite_identity_matcher(
         std::vector< std::shared_ptr< matcher > > const & matchers )
         : composite_matcher( matchers, "CI: " )
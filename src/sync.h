@@ -10,6 +10,8 @@
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <unordered_map>
+#include <atomic>
 
 namespace librealsense
 {
@@ -129,12 +131,12 @@ namespace librealsense
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) = 0;
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) = 0;
         virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
+                                          size_t missing,
                                           frame_header const & last_arrived,
                                           const syncronization_environment & env )
             = 0;
         virtual void clean_inactive_streams(frame_holder& f) = 0;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) = 0;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) = 0;
 
         void dispatch(frame_holder f, const syncronization_environment& env) override;
         void sync(frame_holder f, const syncronization_environment& env) override;
@@ -142,17 +144,45 @@ namespace librealsense
         virtual void stop() override;
 
         static std::string frames_to_string( std::vector< frame_holder* > const& );
-        std::string matchers_to_string( std::vector< matcher* > const& );
+        std::string slots_to_string( std::vector< size_t > const& );
 
     protected:
-        virtual void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                           const frame_holder & f )
-            = 0;
+        // Each matcher we sync between has a slot, indexed by the streams it provides. The slot holds the
+        // frames waiting to be synced, and what the derived matchers keep about the matcher. Slots are never
+        // removed (only reused once their matcher has no streams left), so a frame costs one lookup of its
+        // stream, and syncing it allocates nothing.
+        struct matcher_slot
+        {
+            std::shared_ptr< matcher > m;
+            size_t streams = 0;  // mapped to this slot; none once all were taken over by other matchers
+
+            // Only queues that were sent a frame take part in syncing
+            single_consumer_frame_queue< frame_holder > queue;
+            bool queued = false;
+
+            double next_expected = 0;
+            rs2_timestamp_domain next_expected_domain = RS2_TIMESTAMP_DOMAIN_COUNT;  // COUNT until known
+            long long last_arrived = -1;  // frame number, -1 until one arrives
+        };
+
+        virtual void update_next_expected( size_t slot, const frame_holder & f ) = 0;
+
+        size_t find_slot( const frame_holder & f );
+        size_t add_slot( std::shared_ptr< matcher > const & m );
+        void map_stream( stream_id stream, size_t slot );
+        single_consumer_frame_queue< frame_holder > & queue_of( matcher_slot & slot );
+        void remove_queue( matcher_slot & slot );
 
-        std::map<matcher*, single_consumer_frame_queue<frame_holder>> _frames_queue;
-        std::map<stream_id, std::shared_ptr<matcher>> _matchers;
-        std::map<matcher*, double> _next_expected;
-        std::map<matcher*, rs2_timestamp_domain> _next_expected_domain;
+        std::vector< std::unique_ptr< matcher_slot > > _slots;
+        std::unordered_map< stream_id, size_t > _stream_slots;
+
+        // Scratch space for sync(), reserved for all the slots up front
+        std::vector< frame_holder * > _frames_arrived;
+        std::vector< size_t > _frames_arrived_slots;
+        std::vector< size_t > _missing_streams;
+        std::vector< size_t > _synced_frames;
+        std::vector< size_t > _unsynced_frames;
+        std::vector< int > _synced_ids;
 
         std::mutex _mutex;
     };
@@ -167,18 +197,17 @@ namespace librealsense
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
+                                          size_t missing,
                                           frame_header const & last_arrived,
                                           const syncronization_environment & env ) override
         {
             return false;
         }
         virtual void clean_inactive_streams(frame_holder& f) override {}
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override {}
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override {}
 
     protected:
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override
+        void update_next_expected( size_t slot, const frame_holder & f ) override
         {
         }
     };
@@ -188,19 +217,15 @@ namespace librealsense
     public:
         frame_number_composite_matcher(
             std::vector< std::shared_ptr< matcher > > const & matchers );
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override;
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  size_t missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
         void clean_inactive_streams(frame_holder& f) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
-
-    private:
-         std::map<matcher*,unsigned long long> _last_arrived;
+        void update_next_expected( size_t slot, const frame_holder & f ) override;
     };
 
     class timestamp_composite_matcher : public composite_matcher
@@ -209,20 +234,60 @@ namespace librealsense
         timestamp_composite_matcher( std::vector< std::shared_ptr< matcher > > const & matchers );
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override;
         void clean_inactive_streams(frame_holder& f) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  size_t missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
+        void update_next_expected( size_t slot, const frame_holder & f ) override;
 
     private:
         unsigned int get_fps( frame_interface const * f );
         bool are_equivalent( double a, double b, unsigned int fps );
-        std::map<matcher*, double> _last_arrived;
-        std::map<matcher*, unsigned int> _fps;
+    };
+
+    // Matches the framesets of several devices, each first synced by its device's own matcher, by host time:
+    // frames in the global-time domain carry timestamps global_timestamp_reader already mapped to the host
+    // clock, and other frames go by when they arrived. A frameset is released once every active device has
+    // a frame within the tolerance of it, or has fallen behind by more than a few frames.
+    class multi_device_composite_matcher : public composite_matcher
+    {
+    public:
+        struct statistics
+        {
+            unsigned long long framesets = 0;
+            unsigned long long incomplete = 0;  // without a frame from every active device
+            double latency_ms = 0;              // average, from the arrival of the oldest frame
+        };
+
+        multi_device_composite_matcher();
+
+        void set_callback( sync_callback f ) override;
+
+        // 0 allows half the frame interval of the slower of two frames
+        void set_tolerance( float ms ) { _tolerance_ms = ms; }
+        statistics get_statistics() const;
+
+        bool are_equivalent( frame_holder & a, frame_holder & b ) override;
+        bool is_smaller_than( frame_holder & a, frame_holder & b ) override;
+        void update_last_arrived( frame_holder & f, size_t slot ) override {}
+        void clean_inactive_streams( frame_holder & f ) override {}
+        bool skip_missing_stream( frame_interface const * waiting_to_be_released,
+                                  size_t missing,
+                                  frame_header const & last_arrived,
+                                  const syncronization_environment & env ) override;
+        void update_next_expected( size_t slot, const frame_holder & f ) override;
+
+    private:
+        bool are_equivalent( double a, double b, unsigned int fps ) const;
+        void update_statistics( frame_holder const & frameset );
+
+        std::atomic< float > _tolerance_ms;
 
+        std::vector< size_t > _released_slots;  // scratch for update_statistics()
+        mutable std::mutex _statistics_mutex;
+        statistics _statistics;
+        double _total_latency_ms = 0;
     };
 }
@@ -283,6 +283,22 @@ const char * get_string( rs2_playback_status value )
 #undef CASE
 }
 
+const char * get_string( rs2_record_compression value )
+{
+#define CASE( X ) STRCASE( RECORD_COMPRESSION, X )
+    switch( value )
+    {
+    CASE( NONE )
+    CASE( LZ4 )
+    CASE( LZ4_HC )
+    CASE( ZSTD )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_log_severity value )
 {
 #define CASE( X ) STRCASE( LOG_SEVERITY, X )
@@ -402,6 +418,16 @@ const char * get_string( rs2_option value )
     CASE( AUTO_GAIN_LIMIT_TOGGLE )
     CASE( EMITTER_FREQUENCY )
     case RS2_OPTION_DEPTH_AUTO_EXPOSURE_MODE:  return "Auto Exposure Mode";
+    CASE( ZERO_COPY_FRAMES )
+    CASE( FRAME_POOL_HIGH_WATER_MARK )
+    CASE( PROCESSING_THREADS )
+    CASE( VERTEX_FORMAT )
+    CASE( VALID_POINTS_ONLY )
+    CASE( TEXTURE_COORDINATES )
+    CASE( SYNC_TOLERANCE )
+    CASE( SYNC_FRAMESETS )
+    CASE( SYNC_INCOMPLETE_FRAMESETS )
+    CASE( SYNC_LATENCY )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -447,6 +473,8 @@ const char * get_string( rs2_format value )
     CASE( Z16H )
     CASE( FG )
     CASE( Y411 )
+    CASE( XYZ16F )
+    CASE( XYZ16 )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -658,6 +686,7 @@ const char * rs2_sr300_visual_preset_to_string( rs2_sr300_visual_preset preset )
 const char * rs2_log_severity_to_string( rs2_log_severity severity ) { return librealsense::get_string( severity ); }
 const char * rs2_exception_type_to_string( rs2_exception_type type ) { return librealsense::get_string( type ); }
 const char * rs2_playback_status_to_string( rs2_playback_status status ) { return librealsense::get_string( status ); }
+const char * rs2_record_compression_to_string( rs2_record_compression compression ) { return librealsense::get_string( compression ); }
 const char * rs2_extension_type_to_string( rs2_extension type ) { return librealsense::get_string( type ); }
 const char * rs2_matchers_to_string( rs2_matchers matcher ) { return librealsense::get_string( matcher ); }
 const char * rs2_frame_metadata_to_string( rs2_frame_metadata_value metadata ) { return librealsense::get_string( metadata ); }
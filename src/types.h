@@ -397,6 +397,7 @@ namespace librealsense
     RS2_ENUM_HELPERS(rs2_log_severity, LOG_SEVERITY)
     RS2_ENUM_HELPERS(rs2_notification_category, NOTIFICATION_CATEGORY)
     RS2_ENUM_HELPERS(rs2_playback_status, PLAYBACK_STATUS)
+    RS2_ENUM_HELPERS(rs2_record_compression, RECORD_COMPRESSION)
     RS2_ENUM_HELPERS(rs2_matchers, MATCHER)
     RS2_ENUM_HELPERS(rs2_sensor_mode, SENSOR_MODE)
     RS2_ENUM_HELPERS(rs2_l500_visual_preset, L500_VISUAL_PRESET)
@@ -689,6 +690,27 @@ namespace librealsense
         void release() override { delete this; }
     };
 
+    class frame_allocator : public rs2_frame_allocator
+    {
+        rs2_frame_allocate_callback_ptr allocate_fptr;
+        rs2_frame_free_callback_ptr free_fptr;
+        void * user;
+    public:
+        frame_allocator(rs2_frame_allocate_callback_ptr allocate, rs2_frame_free_callback_ptr free, void * user)
+            : allocate_fptr(allocate), free_fptr(free), user(user) {}
+
+        void * allocate(int size) override { return allocate_fptr(size, user); }
+        void deallocate(void * buffer, int size) override
+        {
+            try { free_fptr(buffer, size, user); }
+            catch (...)
+            {
+                LOG_ERROR("Received an exception from frame allocator free callback!");
+            }
+        }
+        void release() override { delete this; }
+    };
+
     class internal_frame_processor_fptr_callback : public rs2_frame_processor_callback
     {
         rs2_frame_processor_callback_ptr fptr;
@@ -825,6 +847,7 @@ namespace librealsense
     };
 
     typedef std::shared_ptr<rs2_frame_callback> frame_callback_ptr;
+    typedef std::shared_ptr<rs2_frame_allocator> frame_allocator_ptr;
     typedef std::shared_ptr<rs2_frame_processor_callback> frame_processor_callback_ptr;
     typedef std::shared_ptr<rs2_notifications_callback> notifications_callback_ptr;
     typedef std::shared_ptr<rs2_calibration_change_callback> calibration_change_callback_ptr;
@@ -1068,19 +1091,22 @@ namespace librealsense
     {
         std::function<void()> continuation;
         const void* protected_data = nullptr;
+        size_t protected_size = 0;   // size of protected_data, when the frame does not own a buffer of its own
 
         frame_continuation(const frame_continuation &) = delete;
         frame_continuation & operator=(const frame_continuation &) = delete;
     public:
         frame_continuation() : continuation([]() {}) {}
 
-        explicit frame_continuation(std::function<void()> continuation, const void* protected_data) : continuation(continuation), protected_data(protected_data) {}
+        explicit frame_continuation(std::function<void()> continuation, const void* protected_data, size_t protected_size = 0)
+            : continuation(continuation), protected_data(protected_data), protected_size(protected_size) {}
 
 
-        frame_continuation(frame_continuation && other) : continuation(std::move(other.continuation)), protected_data(other.protected_data)
+        frame_continuation(frame_continuation && other) : continuation(std::move(other.continuation)), protected_data(other.protected_data), protected_size(other.protected_size)
         {
             other.continuation = []() {};
             other.protected_data = nullptr;
+            other.protected_size = 0;
         }
 
         void operator()()
@@ -1088,23 +1114,28 @@ namespace librealsense
             continuation();
             continuation = []() {};
             protected_data = nullptr;
+            protected_size = 0;
         }
 
         void reset()
         {
             protected_data = nullptr;
+            protected_size = 0;
             continuation = [](){};
         }
 
         const void* get_data() const { return protected_data; }
+        size_t get_size() const { return protected_size; }
 
         frame_continuation & operator=(frame_continuation && other)
         {
             continuation();
             protected_data = other.protected_data;
+            protected_size = other.protected_size;
             continuation = other.continuation;
             other.continuation = []() {};
             other.protected_data = nullptr;
+            other.protected_size = 0;
             return *this;
         }
 
@@ -50,8 +50,15 @@
 #include "ros/message_event.h"
 #include "ros/serialization.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <ios>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <stdexcept>
@@ -115,10 +122,61 @@ public:
 
     void            setCompression(CompressionType compression);  //!< Set the compression method to use for writing chunks
     CompressionType getCompression() const;                       //!< Get the compression method to use for writing chunks
+    static bool     isCompressionSupported(CompressionType compression);  //!< Whether chunks can be written and read with the compression method
+
+    //! Set the compression level to use for writing chunks
+    /*!
+     * \param level For LZ4, 0 for (fast) LZ4 or the LZ4-HC level (1 to 12); for ZSTD, the Zstandard level (0 for its default)
+     *
+     * Levels, like ZSTD, need chunk write-behind (see setChunkWriteBehind).
+     */
+    void            setCompressionLevel(int level);
+    int             getCompressionLevel() const;
     std::tuple<std::string, uint64_t, uint64_t> getCompressionInfo() const;
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
 
+    typedef std::function<void(std::function<void()>)> Executor;  //!< Runs a function on another thread
+
+    //! Read ahead the chunks that follow the one being read
+    /*!
+     * \param chunks   How many chunks to keep ready past the one being read; 0 to read each chunk when needed
+     * \param executor Where the chunks read ahead are decompressed
+     *
+     * The chunks are read from the file by the thread reading the bag, but decompressed by the
+     * executor, so reading a compressed bag does not wait for decompression.
+     */
+    void            setChunkReadAhead(uint32_t chunks, Executor executor);
+    uint32_t        getChunkReadAhead() const;
+
+    //! Compress and write chunks on other threads
+    /*!
+     * \param max_pending_chunks How many filled chunks may wait to be compressed and written before writing
+     *                           a message waits for them; 0 to write messages to the file as they come
+     * \param executor           Where the chunks are compressed and written
+     *
+     * Writing a message then only serializes it into the chunk being filled. Filled chunks are compressed
+     * in parallel and appended to the file in order, each chunk's data with a single write.
+     * Must be set before the first message is written, and cannot be used in append mode.
+     *
+     * Can throw BagException
+     */
+    void            setChunkWriteBehind(uint32_t max_pending_chunks, Executor executor);
+    uint32_t        getChunkWriteBehind() const;
+
+    //! How writing chunks on other threads keeps up
+    struct WriteStats
+    {
+        uint32_t pending_chunks;   //!< filled chunks not written yet
+        uint64_t chunks_written;
+        uint64_t bytes_in;         //!< chunk data written, before compression
+        uint64_t bytes_out;        //!< chunk data written, after compression
+        uint64_t stalls;           //!< times writing a message waited for the pending chunks
+        uint64_t stall_ns;         //!< time spent waiting for the pending chunks
+        uint64_t write_ns;         //!< time spent writing chunks to the file
+    };
+    WriteStats      getWriteStats() const;
+
     //! Write a message into the bag file
     /*!
      * \param topic The topic name
@@ -196,7 +254,7 @@ private:
     void appendConnectionRecordToBuffer(Buffer& buf, ConnectionInfo const* connection_info);
     template<class T>
     void writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& time, T const& msg);
-    void writeIndexRecords();
+    void writeIndexRecords(std::map<uint32_t, std::multiset<IndexEntry> > const& connection_indexes);
     void writeConnectionRecords();
     void writeChunkInfoRecords();
     void startWritingChunk(rs2rosinternal::Time time);
@@ -226,8 +284,49 @@ private:
     void     decompressRawChunk(ChunkHeader const& chunk_header) const;
     void     decompressBz2Chunk(ChunkHeader const& chunk_header) const;
     void     decompressLz4Chunk(ChunkHeader const& chunk_header) const;
+    void     decompressZstdChunk(ChunkHeader const& chunk_header) const;
+    void     decompressBuffer(std::string const& compression, Buffer& dest, Buffer& source) const;
+
+    // Chunk read-ahead
+
+    struct PrefetchedChunk
+    {
+        ChunkHeader             header;
+        Buffer                  compressed;
+        Buffer                  data;
+        std::atomic<bool>       claimed;   //!< whoever claims the chunk decompresses it
+        bool                    done;
+        std::exception_ptr      error;
+        std::mutex              mutex;
+        std::condition_variable done_cv;
+
+        PrefetchedChunk() : claimed(false), done(false) { }
+    };
+
+    void     prefetchChunks(uint64_t chunk_pos) const;
+    void     decompressPrefetchedChunk(PrefetchedChunk& chunk, bool wait) const;
+    void     clearPrefetchedChunks() const;
     uint32_t getChunkOffset() const;
 
+    // Chunk write-behind
+
+    struct PendingChunk
+    {
+        ChunkInfo                                      info;       //!< pos is the index of the chunk
+        CompressionType                                compression;
+        int                                            compression_level;
+        std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes;
+        Buffer                                         data;
+        Buffer                                         compressed;
+        bool                                           ready;      //!< compressed, and may be written
+    };
+
+    void     queuePendingChunk();
+    void     writeBehind(std::shared_ptr<PendingChunk> const& chunk);
+    void     compressPendingChunk(PendingChunk& chunk);
+    uint64_t writePendingChunk(PendingChunk& chunk);
+    void     waitForPendingChunks();
+
     // Record header I/O
 
     void writeHeader(rs2rosinternal::M_string const& fields);
@@ -271,6 +370,7 @@ private:
     mutable ChunkedFile file_;
     int                 version_;
     CompressionType     compression_;
+    int                 compression_level_;
     uint32_t            chunk_threshold_;
     uint32_t            bag_revision_;
 
@@ -305,6 +405,23 @@ private:
     mutable Buffer*  current_buffer_;
 
     mutable uint64_t decompressed_chunk_;      //!< position of decompressed chunk
+
+    uint32_t         chunk_read_ahead_;        //!< number of chunks to read ahead
+    Executor         chunk_executor_;          //!< decompresses the chunks read ahead
+    mutable std::map<uint64_t, std::shared_ptr<PrefetchedChunk>> prefetched_chunks_;  //!< by chunk position
+    mutable std::shared_ptr<PrefetchedChunk> current_prefetched_chunk_;               //!< holds current_buffer_
+
+    uint32_t         write_behind_;            //!< number of filled chunks that may be pending
+    Executor         write_executor_;          //!< compresses and writes the pending chunks
+    mutable std::mutex                        write_mutex_;
+    std::condition_variable                   write_cv_;         //!< notified when a pending chunk is written
+    std::deque<std::shared_ptr<PendingChunk>> pending_chunks_;   //!< in the order they go in the file
+    std::vector<std::shared_ptr<PendingChunk>> free_chunks_;     //!< written, with buffers to reuse
+    std::vector<uint64_t>                     written_chunk_pos_; //!< by chunk index
+    uint32_t                                  write_tasks_;      //!< given to the executor and not done
+    bool                                      writing_;          //!< some task is writing pending chunks
+    std::exception_ptr                        write_error_;
+    WriteStats                                write_stats_;
 };
 
 } // namespace rosbag
@@ -512,8 +629,11 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
 
     {
         // Seek to the end of the file (needed in case previous operation was a read)
-        seek(0, std::ios::end);
-        file_size_ = file_.getOffset();
+        // With write-behind, the file is only written to by the executor.
+        if (!write_behind_) {
+            seek(0, std::ios::end);
+            file_size_ = file_.getOffset();
+        }
 
         // Write the chunk header if we're starting a new chunk
         if (!chunk_open_)
@@ -538,7 +658,8 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
             }
             connections_[conn_id] = connection_info;
 
-            writeConnectionRecord(connection_info);
+            if (!write_behind_)
+                writeConnectionRecord(connection_info);
             appendConnectionRecordToBuffer(outgoing_chunk_buffer_, connection_info);
         }
 
@@ -580,36 +701,51 @@ void Bag::writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& t
     header[CONNECTION_FIELD_NAME] = toHeaderString(&conn_id);
     header[TIME_FIELD_NAME]       = toHeaderString(&time);
 
-    // Assemble message in memory first, because we need to write its length
     uint32_t msg_ser_len = rs2rosinternal::serialization::serializationLength(msg);
 
-    record_buffer_.setSize(msg_ser_len);
+    if (write_behind_) {
+        // The whole chunk is written later: serialize straight into it
+        appendHeaderToBuffer(outgoing_chunk_buffer_, header);
+        appendDataLengthToBuffer(outgoing_chunk_buffer_, msg_ser_len);
 
-    rs2rosinternal::serialization::OStream s(record_buffer_.getData(), msg_ser_len);
+        uint32_t offset = outgoing_chunk_buffer_.getSize();
+        outgoing_chunk_buffer_.setSize(offset + msg_ser_len);
+        rs2rosinternal::serialization::OStream s(outgoing_chunk_buffer_.getData() + offset, msg_ser_len);
+        rs2rosinternal::serialization::serialize(s, msg);
 
-    // todo: serialize into the outgoing_chunk_buffer & remove record_buffer_
-    rs2rosinternal::serialization::serialize(s, msg);
+        CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [chunk %llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
+                  (unsigned long long) curr_chunk_info_.pos, offset, conn_id, time.sec, time.nsec, msg_ser_len);
+    }
+    else {
+        // Assemble message in memory first, because we need to write its length
+        record_buffer_.setSize(msg_ser_len);
 
-    // We do an extra seek here since writing our data record may
-    // have indirectly moved our file-pointer if it was a
-    // MessageInstance for our own bag
-    seek(0, std::ios::end);
-    file_size_ = file_.getOffset();
+        rs2rosinternal::serialization::OStream s(record_buffer_.getData(), msg_ser_len);
 
-    CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [%llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
-              (unsigned long long) file_.getOffset(), getChunkOffset(), conn_id, time.sec, time.nsec, msg_ser_len);
+        // todo: serialize into the outgoing_chunk_buffer & remove record_buffer_
+        rs2rosinternal::serialization::serialize(s, msg);
 
-    writeHeader(header);
-    writeDataLength(msg_ser_len);
-    write((char*) record_buffer_.getData(), msg_ser_len);
+        // We do an extra seek here since writing our data record may
+        // have indirectly moved our file-pointer if it was a
+        // MessageInstance for our own bag
+        seek(0, std::ios::end);
+        file_size_ = file_.getOffset();
+
+        CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [%llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
+                  (unsigned long long) file_.getOffset(), getChunkOffset(), conn_id, time.sec, time.nsec, msg_ser_len);
 
-    // todo: use better abstraction than appendHeaderToBuffer
-    appendHeaderToBuffer(outgoing_chunk_buffer_, header);
-    appendDataLengthToBuffer(outgoing_chunk_buffer_, msg_ser_len);
+        writeHeader(header);
+        writeDataLength(msg_ser_len);
+        write((char*) record_buffer_.getData(), msg_ser_len);
 
-    uint32_t offset = outgoing_chunk_buffer_.getSize();
-    outgoing_chunk_buffer_.setSize(outgoing_chunk_buffer_.getSize() + msg_ser_len);
-    memcpy(outgoing_chunk_buffer_.getData() + offset, record_buffer_.getData(), msg_ser_len);
+        // todo: use better abstraction than appendHeaderToBuffer
+        appendHeaderToBuffer(outgoing_chunk_buffer_, header);
+        appendDataLengthToBuffer(outgoing_chunk_buffer_, msg_ser_len);
+
+        uint32_t offset = outgoing_chunk_buffer_.getSize();
+        outgoing_chunk_buffer_.setSize(outgoing_chunk_buffer_.getSize() + msg_ser_len);
+        memcpy(outgoing_chunk_buffer_.getData() + offset, record_buffer_.getData(), msg_ser_len);
+    }
 
     // Update the current chunk time range
     if (time > curr_chunk_info_.end_time)
@@ -95,6 +95,7 @@ static const uint32_t CHUNK_INFO_VERSION = 1;
 static const std::string COMPRESSION_NONE = "none";
 static const std::string COMPRESSION_BZ2  = "bz2";
 static const std::string COMPRESSION_LZ4  = "lz4";
+static const std::string COMPRESSION_ZSTD = "zstd";
 
 } // namespace rosbag
 
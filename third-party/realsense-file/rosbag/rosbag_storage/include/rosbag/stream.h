@@ -54,6 +54,7 @@ namespace compression
         Uncompressed = 0,
         BZ2          = 1,
         LZ4          = 2,
+        ZSTD         = 3,
     };
 }
 typedef compression::CompressionType CompressionType;
@@ -37,6 +37,8 @@
 #endif
 #include <signal.h>
 #include <assert.h>
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <map>
 #include <tuple>
@@ -45,6 +47,10 @@
 #include "console_bridge/console.h"
 #include <memory.h>
 
+#ifdef RS2_USE_ZSTD
+#include <zstd.h>
+#endif
+
 using std::map;
 using std::string;
 using std::vector;
@@ -55,10 +61,14 @@ using rs2rosinternal::Time;
 
 namespace rosbag {
 
+// As when compressing while writing (see LZ4Stream)
+static const int LZ4_BLOCK_SIZE_ID = 6;
+
 Bag::Bag() :
     mode_(bagmode::Write),
     version_(0),
     compression_(compression::Uncompressed),
+    compression_level_(0),
     chunk_threshold_(768 * 1024),  // 768KB chunks
     bag_revision_(0),
     file_size_(0),
@@ -69,12 +79,18 @@ Bag::Bag() :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    chunk_read_ahead_(0),
+    write_behind_(0),
+    write_tasks_(0),
+    writing_(false),
+    write_stats_()
 {
 }
 
 Bag::Bag(string const& filename, uint32_t mode) :
     compression_(compression::Uncompressed),
+    compression_level_(0),
     chunk_threshold_(768 * 1024),  // 768KB chunks
     bag_revision_(0),
     file_size_(0),
@@ -85,13 +101,28 @@ Bag::Bag(string const& filename, uint32_t mode) :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    chunk_read_ahead_(0),
+    write_behind_(0),
+    write_tasks_(0),
+    writing_(false),
+    write_stats_()
 {
     open(filename, mode);
 }
 
 Bag::~Bag() {
-    close();
+    // Closing writes what's left, and reports an earlier failure to write behind: it's only logged here
+    string const filename = getFileName();
+    try {
+        close();
+    }
+    catch (std::exception const& e) {
+        CONSOLE_BRIDGE_logError("Error closing %s: %s", filename.c_str(), e.what());
+    }
+    catch (...) {
+        CONSOLE_BRIDGE_logError("Error closing %s", filename.c_str());
+    }
 }
 
 void Bag::open(string const& filename, uint32_t mode) {
@@ -160,9 +191,19 @@ void Bag::close() {
     if (!file_.isOpen())
         return;
 
-    if (mode_ & bagmode::Write || mode_ & bagmode::Append)
-        closeWrite();
+    // The file is closed even when what's left fails to be written
+    std::exception_ptr error;
+    if (mode_ & bagmode::Write || mode_ & bagmode::Append) {
+        try {
+            closeWrite();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+    }
 
+    clearPrefetchedChunks();
+    decompressed_chunk_ = 0;
     file_.close();
 
     topic_connection_ids_.clear();
@@ -173,6 +214,9 @@ void Bag::close() {
     chunks_.clear();
     connection_indexes_.clear();
     curr_chunk_connection_indexes_.clear();
+
+    if (error)
+        std::rethrow_exception(error);
 }
 
 void Bag::closeWrite() {
@@ -185,6 +229,37 @@ uint64_t Bag::getSize()     const { return file_size_;          }
 
 uint32_t Bag::getChunkThreshold() const { return chunk_threshold_; }
 
+uint32_t Bag::getChunkReadAhead() const { return chunk_read_ahead_; }
+
+void Bag::setChunkReadAhead(uint32_t chunks, Executor executor) {
+    clearPrefetchedChunks();
+    decompressed_chunk_ = 0;
+
+    chunk_read_ahead_ = executor ? chunks : 0;
+    chunk_executor_ = std::move(executor);
+}
+
+uint32_t Bag::getChunkWriteBehind() const { return write_behind_; }
+
+void Bag::setChunkWriteBehind(uint32_t max_pending_chunks, Executor executor) {
+    // Chunks are known by their index until written, so all must be written behind
+    if (chunk_open_ || !chunks_.empty())
+        throw BagException("Chunk write-behind must be set before writing");
+
+    write_behind_ = executor ? max_pending_chunks : 0;
+    write_executor_ = std::move(executor);
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    write_stats_ = WriteStats();
+}
+
+Bag::WriteStats Bag::getWriteStats() const {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    WriteStats stats = write_stats_;
+    stats.pending_chunks = static_cast<uint32_t>(pending_chunks_.size());
+    return stats;
+}
+
 void Bag::setChunkThreshold(uint32_t chunk_threshold) {
     if (file_.isOpen() && chunk_open_)
         stopWritingChunk();
@@ -240,13 +315,39 @@ void Bag::setCompression(CompressionType compression) {
 
     if (!(compression == compression::Uncompressed ||
           compression == compression::BZ2 ||
-          compression == compression::LZ4)) {
+          compression == compression::LZ4 ||
+          compression == compression::ZSTD)) {
         throw BagException( "Unknown compression type: " + std::to_string( (int)compression ) );
     }
+    if (compression == compression::ZSTD && !isCompressionSupported(compression))
+        throw BagException("Zstandard compression is not supported by this build");
 
     compression_ = compression;
 }
 
+bool Bag::isCompressionSupported(CompressionType compression) {
+    switch (compression) {
+    case compression::Uncompressed:
+    case compression::LZ4:
+        return true;
+#ifdef RS2_USE_ZSTD
+    case compression::ZSTD:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+int Bag::getCompressionLevel() const { return compression_level_; }
+
+void Bag::setCompressionLevel(int level) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+
+    compression_level_ = level;
+}
+
 // Version
 
 void Bag::writeVersion() {
@@ -293,7 +394,11 @@ void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
 
+    if (write_behind_)
+        waitForPendingChunks();
+
     seek(0, std::ios::end);
+    file_size_ = file_.getOffset();
 
     index_data_pos_ = file_.getOffset();
     writeConnectionRecords();
@@ -438,18 +543,31 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (write_behind_)
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
 }
 
 void Bag::startWritingChunk(Time time) {
+    // Only whole chunks can be compressed with these
+    if (!write_behind_ && (compression_ == compression::ZSTD || compression_level_ != 0))
+        throw BagException("Zstandard compression and compression levels need chunk write-behind");
+
     // Initialize chunk info
-    curr_chunk_info_.pos        = file_.getOffset();
+    // With write-behind, where the chunk goes is only known once the chunks before it are written: until
+    // then, it goes by its index
+    curr_chunk_info_.pos        = write_behind_ ? chunks_.size() : file_.getOffset();
     curr_chunk_info_.start_time = time;
     curr_chunk_info_.end_time   = time;
 
+    if (write_behind_) {
+        chunk_open_ = true;
+        return;
+    }
+
     // Write the chunk header, with a place-holder for the data sizes (we'll fill in when the chunk is finished)
     writeChunkHeader(compression_, 0, 0);
 
@@ -466,6 +584,13 @@ void Bag::stopWritingChunk() {
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
+    if (write_behind_) {
+        queuePendingChunk();
+        curr_chunk_info_.connection_counts.clear();
+        chunk_open_ = false;
+        return;
+    }
+
     // Get the uncompressed and compressed sizes
     uint32_t uncompressed_size = getChunkOffset();
     file_.setWriteMode(compression::Uncompressed);
@@ -479,7 +604,7 @@ void Bag::stopWritingChunk() {
 
     // Write out the indexes and clear them
     seek(end_of_chunk_pos);
-    writeIndexRecords();
+    writeIndexRecords(curr_chunk_connection_indexes_);
     curr_chunk_connection_indexes_.clear();
 
     // Clear the connection counts
@@ -494,7 +619,8 @@ void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size
     switch (compression) {
     case compression::Uncompressed: chunk_header.compression = COMPRESSION_NONE; break;
     case compression::BZ2:          chunk_header.compression = COMPRESSION_BZ2;  break;
-    case compression::LZ4:          chunk_header.compression = COMPRESSION_LZ4;
+    case compression::LZ4:          chunk_header.compression = COMPRESSION_LZ4;  break;
+    case compression::ZSTD:         chunk_header.compression = COMPRESSION_ZSTD; break;
     //case compression::ZLIB:         chunk_header.compression = COMPRESSION_ZLIB; break;
     }
     chunk_header.compressed_size   = compressed_size;
@@ -512,6 +638,177 @@ void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size
     writeDataLength(chunk_header.compressed_size);
 }
 
+// Chunk write-behind
+
+void Bag::queuePendingChunk() {
+    std::shared_ptr<PendingChunk> chunk;
+    {
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        // When chunks are filled faster than they are written, the disk (or compression) holds the writer back
+        if (pending_chunks_.size() >= write_behind_ && !write_error_) {
+            ++write_stats_.stalls;
+            auto start = std::chrono::steady_clock::now();
+            write_cv_.wait(lock, [this]() { return pending_chunks_.size() < write_behind_ || write_error_; });
+            write_stats_.stall_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+        if (write_error_)
+            std::rethrow_exception(write_error_);
+
+        if (free_chunks_.empty())
+            chunk = std::make_shared<PendingChunk>();
+        else {
+            chunk = std::move(free_chunks_.back());
+            free_chunks_.pop_back();
+        }
+    }
+
+    // The chunk takes the filled buffer, and leaves one that was written, already large enough, to fill next
+    chunk->info        = curr_chunk_info_;
+    chunk->compression = compression_;
+    chunk->compression_level = compression_level_;
+    chunk->ready       = false;
+    chunk->connection_indexes.swap(curr_chunk_connection_indexes_);
+    curr_chunk_connection_indexes_.clear();
+    chunk->data.swap(outgoing_chunk_buffer_);
+    outgoing_chunk_buffer_.setSize(0);
+
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        pending_chunks_.push_back(chunk);
+        ++write_tasks_;
+    }
+    write_executor_([this, chunk]() { writeBehind(chunk); });
+}
+
+void Bag::writeBehind(std::shared_ptr<PendingChunk> const& chunk) {
+    std::exception_ptr error;
+    try {
+        compressPendingChunk(*chunk);
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    chunk->ready = true;
+    if (error && !write_error_)
+        write_error_ = error;
+
+    // Chunks are compressed in any order, but written in order: by whoever finds the next ones ready while
+    // no one else is writing
+    while (!writing_ && !pending_chunks_.empty() && pending_chunks_.front()->ready) {
+        std::shared_ptr<PendingChunk> next = pending_chunks_.front();
+        bool const failed = write_error_ != nullptr;
+        writing_ = true;
+        lock.unlock();
+
+        uint64_t pos = 0;
+        error = nullptr;
+        auto start = std::chrono::steady_clock::now();
+        try {
+            // Once writing failed, the file is broken: what's left is dropped
+            if (!failed)
+                pos = writePendingChunk(*next);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        auto write_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        lock.lock();
+        writing_ = false;
+        if (error && !write_error_)
+            write_error_ = error;
+        if (!failed && !error) {
+            ++write_stats_.chunks_written;
+            write_stats_.bytes_in  += next->data.getSize();
+            write_stats_.bytes_out += next->compression == compression::Uncompressed ? next->data.getSize() : next->compressed.getSize();
+            write_stats_.write_ns  += write_ns;
+        }
+        written_chunk_pos_.push_back(pos);
+        pending_chunks_.pop_front();
+        next->connection_indexes.clear();
+        free_chunks_.push_back(std::move(next));
+        write_cv_.notify_all();
+    }
+
+    --write_tasks_;
+    write_cv_.notify_all();
+}
+
+void Bag::compressPendingChunk(PendingChunk& chunk) {
+    switch (chunk.compression) {
+    case compression::Uncompressed:
+        break;
+    case compression::LZ4:
+    {
+        // Room for incompressible data, with the stream's block headers and checksums
+        uint32_t const size = chunk.data.getSize();
+        unsigned int compressed_size = size + size / 255 + 16 + 8 * (size / roslz4_blockSizeFromIndex(LZ4_BLOCK_SIZE_ID) + 1) + 64;
+        int ret;
+        for (;;) {
+            chunk.compressed.setSize(compressed_size);
+            ret = roslz4_buffToBuffCompressLevel((char*) chunk.data.getData(), size,
+                                                 (char*) chunk.compressed.getData(), &compressed_size,
+                                                 LZ4_BLOCK_SIZE_ID, chunk.compression_level);
+            if (ret != ROSLZ4_OUTPUT_SMALL)
+                break;
+            compressed_size = chunk.compressed.getSize() * 2;
+        }
+        if (ret != ROSLZ4_OK)
+            throw BagException("Error compressing chunk: " + std::to_string(ret));
+        chunk.compressed.setSize(compressed_size);
+        break;
+    }
+#ifdef RS2_USE_ZSTD
+    case compression::ZSTD:
+    {
+        chunk.compressed.setSize(static_cast<uint32_t>(ZSTD_compressBound(chunk.data.getSize())));
+        size_t ret = ZSTD_compress(chunk.compressed.getData(), chunk.compressed.getSize(),
+                                   chunk.data.getData(), chunk.data.getSize(), chunk.compression_level);
+        if (ZSTD_isError(ret))
+            throw BagException(string("Error compressing chunk: ") + ZSTD_getErrorName(ret));
+        chunk.compressed.setSize(static_cast<uint32_t>(ret));
+        break;
+    }
+#endif
+    default:
+        throw BagException("Unsupported compression for chunk write-behind: " + std::to_string((int) chunk.compression));
+    }
+}
+
+uint64_t Bag::writePendingChunk(PendingChunk& chunk) {
+    Buffer& data = chunk.compression == compression::Uncompressed ? chunk.data : chunk.compressed;
+
+    uint64_t pos = file_.getOffset();
+    writeChunkHeader(chunk.compression, data.getSize(), chunk.data.getSize());
+    write((char*) data.getData(), data.getSize());
+    writeIndexRecords(chunk.connection_indexes);
+    return pos;
+}
+
+void Bag::waitForPendingChunks() {
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    write_cv_.wait(lock, [this]() { return pending_chunks_.empty() && !write_tasks_; });
+    free_chunks_.clear();
+
+    std::vector<uint64_t> positions;
+    positions.swap(written_chunk_pos_);
+    if (write_error_) {
+        std::exception_ptr error = write_error_;
+        write_error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+    lock.unlock();
+
+    // The chunks are all written: what went by their index now goes by their position
+    for (ChunkInfo& chunk_info : chunks_)
+        chunk_info.pos = positions.at(chunk_info.pos);
+    for (auto& i : connection_indexes_)
+        for (IndexEntry const& e : i.second)
+            const_cast<IndexEntry&>(e).chunk_pos = positions.at(e.chunk_pos);  // the order is by time only
+}
+
 void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
     rs2rosinternal::Header header;
     if (!readHeader(header) || !readDataLength(chunk_header.compressed_size))
@@ -530,8 +827,8 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
-void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& connection_indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = connection_indexes.begin(); i != connection_indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -788,6 +1085,20 @@ void Bag::decompressChunk(uint64_t chunk_pos) const {
         return;
     }
 
+    if (chunk_read_ahead_) {
+        if (decompressed_chunk_ != chunk_pos) {
+            prefetchChunks(chunk_pos);
+            auto chunk = prefetched_chunks_.at(chunk_pos);
+            decompressPrefetchedChunk(*chunk, true);
+            if (chunk->error)
+                std::rethrow_exception(chunk->error);
+            current_prefetched_chunk_ = chunk;
+            decompressed_chunk_ = chunk_pos;
+        }
+        current_buffer_ = &current_prefetched_chunk_->data;
+        return;
+    }
+
     current_buffer_ = &decompress_buffer_;
 
     if (decompressed_chunk_ == chunk_pos)
@@ -807,12 +1118,103 @@ void Bag::decompressChunk(uint64_t chunk_pos) const {
         decompressBz2Chunk(chunk_header);
     else if (chunk_header.compression == COMPRESSION_LZ4)
         decompressLz4Chunk(chunk_header);
+    else if (chunk_header.compression == COMPRESSION_ZSTD)
+        decompressZstdChunk(chunk_header);
     else
         throw BagFormatException("Unknown compression: " + chunk_header.compression);
 
     decompressed_chunk_ = chunk_pos;
 }
 
+// Read the chunk at chunk_pos and the ones after it, and start decompressing the ones after it
+void Bag::prefetchChunks(uint64_t chunk_pos) const {
+    vector<uint64_t> window(1, chunk_pos);
+    auto next = std::upper_bound(chunks_.begin(), chunks_.end(), chunk_pos,
+                                 [](uint64_t pos, ChunkInfo const& info) { return pos < info.pos; });
+    for (auto it = next; it != chunks_.end() && window.size() <= chunk_read_ahead_; ++it)
+        window.push_back(it->pos);
+
+    // The chunk before is kept too: messages of chunks that overlap in time alternate between them
+    uint64_t keep_from = chunk_pos;
+    auto prev = next;
+    if (prev != chunks_.begin() && (--prev)->pos == chunk_pos && prev != chunks_.begin())
+        keep_from = (--prev)->pos;
+
+    // Whatever is out of the window (e.g., after a seek) is finished before it is dropped, as it uses the file
+    for (auto it = prefetched_chunks_.begin(); it != prefetched_chunks_.end();) {
+        if (it->first < keep_from || it->first > window.back()) {
+            decompressPrefetchedChunk(*it->second, true);
+            it = prefetched_chunks_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto pos : window) {
+        if (prefetched_chunks_.count(pos))
+            continue;
+
+        auto chunk = std::make_shared<PrefetchedChunk>();
+        try {
+            seek(pos);
+            readChunkHeader(chunk->header);
+            if (chunk->header.compression == COMPRESSION_NONE) {
+                chunk->data.setSize(chunk->header.compressed_size);
+                file_.read((char*) chunk->data.getData(), chunk->header.compressed_size);
+                chunk->claimed = true;
+                chunk->done = true;
+            }
+            else if (chunk->header.compression == COMPRESSION_LZ4 || chunk->header.compression == COMPRESSION_ZSTD) {
+                chunk->compressed.setSize(chunk->header.compressed_size);
+                file_.read((char*) chunk->compressed.getData(), chunk->header.compressed_size);
+            }
+            else
+                throw BagFormatException("Unknown compression: " + chunk->header.compression);
+        }
+        catch (...) {
+            // Only an error in the chunk being read now is thrown now
+            if (pos == chunk_pos)
+                throw;
+            chunk->error = std::current_exception();
+            chunk->claimed = true;
+            chunk->done = true;
+        }
+        prefetched_chunks_[pos] = chunk;
+
+        // The chunk being read is decompressed right away, by whoever waits for it
+        if (pos != chunk_pos && !chunk->done)
+            chunk_executor_([this, chunk]() { decompressPrefetchedChunk(*chunk, false); });
+    }
+}
+
+// Whoever gets here first decompresses the chunk: a thread of the executor, or the reader when it needs
+// the chunk before the executor got to it. With wait, return only once the chunk is decompressed.
+void Bag::decompressPrefetchedChunk(PrefetchedChunk& chunk, bool wait) const {
+    if (!chunk.claimed.exchange(true)) {
+        try {
+            chunk.data.setSize(chunk.header.uncompressed_size);
+            decompressBuffer(chunk.header.compression, chunk.data, chunk.compressed);
+        }
+        catch (...) {
+            chunk.error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(chunk.mutex);
+        chunk.done = true;
+        chunk.done_cv.notify_all();
+    }
+    else if (wait) {
+        std::unique_lock<std::mutex> lock(chunk.mutex);
+        chunk.done_cv.wait(lock, [&chunk]() { return chunk.done; });
+    }
+}
+
+void Bag::clearPrefetchedChunks() const {
+    for (auto& kvp : prefetched_chunks_)
+        decompressPrefetchedChunk(*kvp.second, true);
+    prefetched_chunks_.clear();
+    current_prefetched_chunk_.reset();
+}
+
 void Bag::readMessageDataRecord102(uint64_t offset, rs2rosinternal::Header& header) const {
     CONSOLE_BRIDGE_logDebug("readMessageDataRecord: offset=%llu", (unsigned long long) offset);
 
@@ -881,6 +1283,39 @@ void Bag::decompressLz4Chunk(ChunkHeader const& chunk_header) const {
     // todo check read was successful
 }
 
+void Bag::decompressZstdChunk(ChunkHeader const& chunk_header) const {
+    assert(chunk_header.compression == COMPRESSION_ZSTD);
+
+    CONSOLE_BRIDGE_logDebug("zstd compressed_size: %d uncompressed_size: %d",
+             chunk_header.compressed_size, chunk_header.uncompressed_size);
+
+    chunk_buffer_.setSize(chunk_header.compressed_size);
+    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+
+    decompress_buffer_.setSize(chunk_header.uncompressed_size);
+    decompressBuffer(chunk_header.compression, decompress_buffer_, chunk_buffer_);
+}
+
+// Decompress a whole chunk; dest is already the size of the uncompressed chunk
+void Bag::decompressBuffer(string const& compression, Buffer& dest, Buffer& source) const {
+    if (compression == COMPRESSION_LZ4) {
+        file_.decompress(compression::LZ4, dest.getData(), dest.getSize(), source.getData(), source.getSize());
+    }
+    else if (compression == COMPRESSION_ZSTD) {
+#ifdef RS2_USE_ZSTD
+        size_t ret = ZSTD_decompress(dest.getData(), dest.getSize(), source.getData(), source.getSize());
+        if (ZSTD_isError(ret))
+            throw BagException(string("Error decompressing chunk: ") + ZSTD_getErrorName(ret));
+        if (ret != dest.getSize())
+            throw BagFormatException("Decompressed chunk size does not match its header");
+#else
+        throw BagException("Zstandard compression is not supported by this build");
+#endif
+    }
+    else
+        throw BagFormatException("Unknown compression: " + compression);
+}
+
 rs2rosinternal::Header Bag::readMessageDataHeader(IndexEntry const& index_entry) {
     rs2rosinternal::Header header;
     uint32_t data_size;
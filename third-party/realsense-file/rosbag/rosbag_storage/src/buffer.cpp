@@ -34,6 +34,7 @@
 
 #include <stdlib.h>
 #include <assert.h>
+#include <utility>
 
 #include "rosbag/buffer.h"
 
@@ -56,6 +57,12 @@ void Buffer::setSize(uint32_t size) {
     ensureCapacity(size);
 }
 
+void Buffer::swap(Buffer& other) {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+}
+
 void Buffer::ensureCapacity(uint32_t capacity) {
     if (capacity <= capacity_)
         return;
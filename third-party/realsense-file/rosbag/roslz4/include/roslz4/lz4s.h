@@ -74,6 +74,8 @@ typedef struct {
 int roslz4_blockSizeFromIndex(int block_id);
 
 int roslz4_compressStart(roslz4_stream *stream, int block_size_id);
+// A level above 0 compresses with LZ4-HC at that level (up to LZ4HC_CLEVEL_MAX)
+int roslz4_compressStartLevel(roslz4_stream *stream, int block_size_id, int level);
 int roslz4_compress(roslz4_stream *stream, int action);
 void roslz4_compressEnd(roslz4_stream *stream);
 
@@ -85,6 +87,9 @@ void roslz4_decompressEnd(roslz4_stream *str);
 int roslz4_buffToBuffCompress(char *input, unsigned int input_size,
                               char *output, unsigned int *output_size,
                               int block_size_id);
+int roslz4_buffToBuffCompressLevel(char *input, unsigned int input_size,
+                                   char *output, unsigned int *output_size,
+                                   int block_size_id, int level);
 int roslz4_buffToBuffDecompress(char *input, unsigned int input_size,
                                 char *output, unsigned int *output_size);
 
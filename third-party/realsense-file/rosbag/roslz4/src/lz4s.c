@@ -33,6 +33,7 @@
 ********************************************************************/
 
 #include "roslz4/lz4s.h"
+#include "../../../lz4/lz4hc.h"
 
 #include "xxhash.h"
 
@@ -87,6 +88,8 @@ typedef struct {
 
   int finished; // 1 if done compressing/decompressing; 0 otherwise
 
+  int compression_level; // LZ4-HC level, or 0 for (fast) LZ4
+
   void* xxh32_state;
 
   // Compression state
@@ -181,10 +184,18 @@ int bufferToOutput(roslz4_stream *str) {
         state->buffer_offset, str->output_left);
 
   // Shrink output by 1 to detect if data is not compressible
-  uint32_t comp_size = LZ4_compress_default(state->buffer,
-                                            str->output_next + 4,
-                                            state->buffer_offset,
-                                            uncomp_size - 1);
+  // Blocks compressed by LZ4-HC are decompressed like any other
+  uint32_t comp_size;
+  if (state->compression_level > 0) {
+    comp_size = LZ4_compress_HC(state->buffer, str->output_next + 4,
+                                state->buffer_offset, uncomp_size - 1,
+                                state->compression_level);
+  } else {
+    comp_size = LZ4_compress_default(state->buffer,
+                                     str->output_next + 4,
+                                     state->buffer_offset,
+                                     uncomp_size - 1);
+  }
   uint32_t wrote;
   if (comp_size > 0) {
     DEBUG("bufferToOutput() Compressed to %i bytes\n", comp_size);
@@ -246,6 +257,8 @@ int streamStateAlloc(roslz4_stream *str) {
 
   state->finished = 0;
 
+  state->compression_level = 0;
+
   state->xxh32_state = XXH32_init(0);
   state->stream_checksum = 0;
   state->stream_checksum_read = 0;
@@ -301,8 +314,14 @@ int roslz4_blockSizeFromIndex(int block_id) {
 }
 
 int roslz4_compressStart(roslz4_stream *str, int block_size_id) {
+  return roslz4_compressStartLevel(str, block_size_id, 0);
+}
+
+int roslz4_compressStartLevel(roslz4_stream *str, int block_size_id,
+                              int level) {
   int ret = streamStateAlloc(str);
   if (ret < 0) { return ret; }
+  ((stream_state*) str->state)->compression_level = level;
   return streamResizeBuffer(str, block_size_id);
 }
 
@@ -565,6 +584,13 @@ void roslz4_decompressEnd(roslz4_stream *str) {
 int roslz4_buffToBuffCompress(char *input, unsigned int input_size,
                               char *output, unsigned int *output_size,
                               int block_size_id) {
+  return roslz4_buffToBuffCompressLevel(input, input_size, output, output_size,
+                                        block_size_id, 0);
+}
+
+int roslz4_buffToBuffCompressLevel(char *input, unsigned int input_size,
+                                   char *output, unsigned int *output_size,
+                                   int block_size_id, int level) {
   roslz4_stream stream;
   stream.input_next = input;
   stream.input_left = input_size;
@@ -572,7 +598,7 @@ int roslz4_buffToBuffCompress(char *input, unsigned int input_size,
   stream.output_left = *output_size;
 
   int ret;
-  ret = roslz4_compressStart(&stream, block_size_id);
+  ret = roslz4_compressStartLevel(&stream, block_size_id, level);
   if (ret != ROSLZ4_OK) { return ret; }
 
   while (stream.input_left > 0 && ret != ROSLZ4_STREAM_END) {
@@ -2,6 +2,7 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include "ring-queue.h"
 #include <queue>
 #include <mutex>
 #include <condition_variable>
@@ -194,10 +195,11 @@ public:
 };
 
 // A single_consumer_queue meant to hold frame_holder objects
+// Frames flow through these at high rates, so the lock-free ring is used
 template<class T>
 class single_consumer_frame_queue
 {
-    single_consumer_queue<T> _queue;
+    single_consumer_ring_queue<T> _queue;
 
 public:
     single_consumer_frame_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
@@ -0,0 +1,386 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <cstdint>
+#include <type_traits>
+#include <new>
+
+
+// Waits for a condition that other threads announce through notify().
+// The condition is usually met within microseconds on the frame path, so we first spin (yielding
+// the CPU) for a while and only then block. Announcing is free when no one is blocked.
+class adaptive_waiter
+{
+    static const int SPIN_COUNT = 100;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::atomic< int > _sleepers;
+
+public:
+    adaptive_waiter()
+        : _sleepers( 0 )
+    {
+    }
+
+    // Wait until pred() is true or the timeout expires
+    // Returns the last result of pred()
+    template< class Pred >
+    bool wait_for( std::chrono::steady_clock::duration timeout, Pred pred )
+    {
+        for( int i = 0; i < SPIN_COUNT; ++i )
+        {
+            if( pred() )
+                return true;
+            std::this_thread::yield();
+        }
+
+        auto const deadline = std::chrono::steady_clock::now() + timeout;
+        std::unique_lock< std::mutex > lock( _mutex );
+        _sleepers.fetch_add( 1 );  // must be visible before pred() is re-evaluated, see notify()
+        bool const result = _cv.wait_until( lock, deadline, pred );
+        _sleepers.fetch_sub( 1 );
+        return result;
+    }
+
+    // Wait (with no timeout) until pred() is true
+    template< class Pred >
+    void wait( Pred pred )
+    {
+        while( ! wait_for( std::chrono::seconds( 1 ), pred ) )
+            ;
+    }
+
+    // Call after making pred() true for a waiter
+    void notify()
+    {
+        // Pairs with the increment in wait_for(): either the waiter sees the new state, or we see it
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if( _sleepers.load() )
+        {
+            // Make sure the waiter is either not yet checking pred() or already blocked
+            { std::lock_guard< std::mutex > lock( _mutex ); }
+            _cv.notify_all();
+        }
+    }
+};
+
+
+// Bounded, fixed-capacity alternative to single_consumer_queue, with the same interface and
+// semantics (drop-oldest enqueue, blocking enqueue, timed dequeue, stop/start).
+//
+// Any number of threads may enqueue without locking: slots are claimed on a power-of-2 ring, each
+// with its own sequence number (D. Vyukov's bounded queue). blocking_enqueue() claims a slot only
+// while the queue holds fewer than its capacity, so it never grows past it. Removal is done by the single
+// consumer, and by producers only when they have to drop the oldest item to make room, and is
+// serialized by a spin-lock that is uncontended in the common case. Nothing is allocated once the
+// queue is constructed.
+//
+template< class T >
+class single_consumer_ring_queue
+{
+    // Values are constructed in place only while a cell is occupied, so T need not be
+    // default-constructible
+    struct cell
+    {
+        std::atomic< size_t > seq;
+        typename std::aligned_storage< sizeof( T ), alignof( T ) >::type storage;
+
+        T & value() { return *reinterpret_cast< T * >( &storage ); }
+        T const & value() const { return *reinterpret_cast< T const * >( &storage ); }
+    };
+
+    std::unique_ptr< cell[] > _cells;
+    size_t const _mask;
+
+    // Producers and consumer touch different ends of the ring; keep them on different cache lines
+    char _pad0[64];
+    std::atomic< size_t > _tail;  // next position to be claimed by a producer
+    char _pad1[64];
+    std::atomic< size_t > _head;  // next position to be removed
+    mutable std::atomic< bool > _removing;
+    char _pad2[64];
+
+    unsigned int const _cap;
+    std::atomic< bool > _accepting;
+
+    std::function< void( T const & ) > const _on_drop_callback;
+
+    adaptive_waiter _deq_waiter;  // not empty signal
+    adaptive_waiter _enq_waiter;  // not full signal
+
+    static size_t ring_size( unsigned int cap )
+    {
+        // One extra slot so producers racing past the capacity do not have to wait for each other
+        size_t size = 2;
+        while( size < size_t( cap ) + 1 )
+            size <<= 1;
+        return size;
+    }
+
+    class removal_lock
+    {
+        std::atomic< bool > & _flag;
+
+    public:
+        removal_lock( std::atomic< bool > & flag )
+            : _flag( flag )
+        {
+            while( _flag.exchange( true, std::memory_order_acquire ) )
+                std::this_thread::yield();
+        }
+        ~removal_lock() { _flag.store( false, std::memory_order_release ); }
+    };
+
+public:
+    explicit single_consumer_ring_queue< T >( unsigned int cap = 10,
+                                              std::function< void( T const & ) > on_drop_callback = nullptr )
+        : _cells( new cell[ring_size( cap )] )
+        , _mask( ring_size( cap ) - 1 )
+        , _tail( 0 )
+        , _head( 0 )
+        , _removing( false )
+        , _cap( cap )
+        , _accepting( true )
+        , _on_drop_callback( on_drop_callback )
+    {
+        for( size_t i = 0; i <= _mask; ++i )
+            _cells[i].seq.store( i, std::memory_order_relaxed );
+    }
+
+    ~single_consumer_ring_queue()
+    {
+        removal_lock lock( _removing );
+        while( _try_pop( nullptr ) )
+            ;
+    }
+
+    single_consumer_ring_queue( single_consumer_ring_queue const & ) = delete;
+    single_consumer_ring_queue & operator=( single_consumer_ring_queue const & ) = delete;
+
+    // Enqueue an item onto the queue.
+    // If the queue grows beyond capacity, the front will be removed, losing whatever was there!
+    bool enqueue( T && item )
+    {
+        if( ! _accepting )
+        {
+            if( _on_drop_callback )
+                _on_drop_callback( item );
+            return false;
+        }
+
+        while( ! _try_push( item, _mask + 1 ) )
+        {
+            // The ring is full: make room at the expense of the oldest item
+            if( ! _drop_front() )
+                std::this_thread::yield();
+        }
+
+        while( size() > _cap )
+            if( ! _drop_front() )
+                break;
+
+        _after_push();
+        return true;
+    }
+
+    // Enqueue an item, but wait for room if there isn't any
+    // Returns true if the enqueue succeeded
+    bool blocking_enqueue( T && item )
+    {
+        for( ;; )
+        {
+            _enq_waiter.wait( [this]() { return size() < _cap || ! _accepting; } );
+            if( ! _accepting )
+            {
+                // We shouldn't be adding anything to the queue when we're stopping
+                if( _on_drop_callback )
+                    _on_drop_callback( item );
+                return false;
+            }
+            // Room is claimed along with the slot: other producers may have taken what we waited for
+            if( _try_push( item, _cap ) )
+                break;
+        }
+
+        _after_push();
+        return true;
+    }
+
+    // Remove one item; if unavailable, wait for it
+    // Return true if an item was removed -- otherwise, false
+    bool dequeue( T * item, unsigned int timeout_ms )
+    {
+        if( ! _deq_waiter.wait_for( std::chrono::milliseconds( timeout_ms ),
+                                    [this]() { return ! _accepting || _front_ready(); } ) )
+            return false;
+
+        return try_dequeue( item );
+    }
+
+    // Remove one item if available; do not wait for one
+    // Return true if an item was removed -- otherwise, false
+    bool try_dequeue( T * item )
+    {
+        {
+            removal_lock lock( _removing );
+            if( ! _try_pop( item ) )
+                return false;
+        }
+
+        // We've made room -- let whoever is waiting for room know about it
+        _enq_waiter.notify();
+        return true;
+    }
+
+    template< class Fn >
+    bool peek( Fn fn ) const
+    {
+        removal_lock lock( _removing );
+        if( ! _front_ready() )
+            return false;
+        fn( static_cast< T const & >( _cells[_head.load( std::memory_order_relaxed ) & _mask].value() ) );
+        return true;
+    }
+
+    template< class Fn >
+    bool peek( Fn fn )
+    {
+        removal_lock lock( _removing );
+        if( ! _front_ready() )
+            return false;
+        fn( _cells[_head.load( std::memory_order_relaxed ) & _mask].value() );
+        return true;
+    }
+
+    void stop()
+    {
+        // We no longer accept any more items!
+        _accepting = false;
+
+        clear();
+    }
+
+    void clear()
+    {
+        {
+            removal_lock lock( _removing );
+            while( _try_pop( nullptr ) )
+                ;
+        }
+
+        // Wake up anyone who is waiting for room to enqueue, or waiting for something to dequeue -- there's nothing now
+        _enq_waiter.notify();
+        _deq_waiter.notify();
+    }
+
+    void start() { _accepting = true; }
+
+    bool started() const { return _accepting; }
+    bool stopped() const { return ! started(); }
+
+    // Includes items still being written by their producers
+    size_t size() const
+    {
+        size_t const head = _head.load( std::memory_order_acquire );
+        size_t const tail = _tail.load( std::memory_order_acquire );
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const { return ! size(); }
+
+    unsigned int capacity() const { return _cap; }
+
+private:
+    // Claim the next free slot and move the item into it; false (and the item is left untouched)
+    // if the ring is full, or if the queue already holds 'limit' items
+    bool _try_push( T & item, size_t limit )
+    {
+        size_t pos = _tail.load( std::memory_order_relaxed );
+        for( ;; )
+        {
+            // The head only moves forward, so a stale head can only make the queue look fuller; a
+            // stale position (behind the head) fails the claim below
+            size_t const head = _head.load( std::memory_order_acquire );
+            if( pos >= head && pos - head >= limit )
+                return false;
+
+            cell & c = _cells[pos & _mask];
+            size_t const seq = c.seq.load( std::memory_order_acquire );
+            auto const diff = static_cast< std::intptr_t >( seq ) - static_cast< std::intptr_t >( pos );
+            if( diff == 0 )
+            {
+                if( _tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    new( &c.storage ) T( std::move( item ) );
+                    c.seq.store( pos + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if( diff < 0 )
+                return false;
+            else
+                pos = _tail.load( std::memory_order_relaxed );
+        }
+    }
+
+    // True if the item at the head of the ring was fully written
+    bool _front_ready() const
+    {
+        size_t const pos = _head.load( std::memory_order_relaxed );
+        return _cells[pos & _mask].seq.load( std::memory_order_acquire ) == pos + 1;
+    }
+
+    // Move the front item into 'item' (or discard it, if null)
+    // Must be called under the removal lock
+    bool _try_pop( T * item )
+    {
+        size_t const pos = _head.load( std::memory_order_relaxed );
+        cell & c = _cells[pos & _mask];
+        if( c.seq.load( std::memory_order_acquire ) != pos + 1 )
+            return false;  // empty, or the producer has yet to finish writing
+
+        if( item )
+            *item = std::move( c.value() );
+        c.value().~T();
+        c.seq.store( pos + _mask + 1, std::memory_order_release );
+        _head.store( pos + 1, std::memory_order_release );
+        return true;
+    }
+
+    bool _drop_front()
+    {
+        // The dropped item is moved out so the callback (and its destruction) run outside the lock
+        typename std::aligned_storage< sizeof( T ), alignof( T ) >::type storage;
+        T * dropped;
+        {
+            removal_lock lock( _removing );
+            if( ! _front_ready() )
+                return false;
+            dropped = new( &storage ) T( std::move( _cells[_head.load( std::memory_order_relaxed ) & _mask].value() ) );
+            _try_pop( nullptr );
+        }
+        if( _on_drop_callback )
+            _on_drop_callback( *dropped );
+        dropped->~T();
+        return true;
+    }
+
+    void _after_push()
+    {
+        // A stop() may have raced with us: it does not expect anything left in the queue
+        if( ! _accepting )
+            clear();
+
+        // We pushed something -- let others know there's something to dequeue
+        _deq_waiter.notify();
+    }
+};
@@ -0,0 +1,90 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <cstdint>
+
+
+// A set of threads that run tasks for any number of clients.
+//
+// Each thread has its own queue: tasks submitted by one of the threads go to its own queue, others
+// are spread between the queues, and a thread whose queue is empty steals from the others. So
+// clients that split their work into bands (see parallel_for) share the threads instead of each
+// starting its own.
+//
+// The threads are started when first needed, or by configure().
+//
+class task_pool
+{
+public:
+    typedef std::function< void() > task;
+    typedef std::function< void( size_t begin, size_t end ) > band_function;
+
+    struct settings
+    {
+        size_t size = default_size();  // number of threads
+        std::vector< int > cpus;       // the CPUs the threads may run on; empty for any
+        int priority = 0;              // real-time priority of the threads; 0 for normal
+    };
+
+    // One thread less than the CPUs, as whoever waits for the tasks also runs some
+    static size_t default_size();
+
+    explicit task_pool( size_t size = default_size() );
+    ~task_pool();
+
+    task_pool( task_pool const & ) = delete;
+    task_pool & operator=( task_pool const & ) = delete;
+
+    // Restart the threads with new settings, after finishing the tasks already submitted
+    // Returns false if the CPUs or the priority could not be applied (e.g., no permission for
+    // real-time priority): the threads run regardless, but without them.
+    bool configure( settings const & );
+    settings get_settings() const;
+    size_t size() const { return _size; }
+
+    // Run the task on one of the threads; with no threads, it is run right away
+    // Exceptions thrown by the task are ignored.
+    void submit( task && );
+
+    // Call fn over bands covering [0, count), no smaller than min_band items (except for the last),
+    // using no more than max_threads threads including the caller, and return once all are done.
+    // The caller runs bands too and never waits for a band no thread has started, so nested and
+    // concurrent calls are fine. An exception thrown by fn is rethrown once all bands are done.
+    void parallel_for( size_t count, band_function const & fn, size_t max_threads, size_t min_band = 1 );
+
+private:
+    struct worker
+    {
+        std::mutex mutex;
+        std::deque< task > tasks;
+        std::thread thread;
+    };
+
+    void start_threads();
+    void stop_threads();
+    void run( size_t index );
+    bool try_run_one( size_t index );
+    static bool apply_settings( settings const & );
+
+    mutable std::mutex _mutex;
+    std::condition_variable _work_cv;
+    std::condition_variable _started_cv;
+    settings _settings;
+    std::atomic< size_t > _size;
+    std::vector< std::unique_ptr< worker > > _workers;
+    bool _started;
+    bool _stopping;
+    size_t _queued;        // tasks in the queues
+    size_t _setup_done;    // threads that applied the settings
+    bool _setup_failed;
+    size_t _next_queue;
+};
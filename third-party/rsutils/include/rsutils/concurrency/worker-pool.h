@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include "task-pool.h"
+
+#include <atomic>
+#include <memory>
+
+
+// Splits a range of work items (rows, columns...) between a number of threads.
+//
+// parallel_for() splits [0, count) into consecutive bands and returns once all of them were
+// processed. The calling thread processes bands too, so a pool of size 1 simply calls the
+// function over the whole range.
+//
+// The threads come from a task_pool: either one of the worker pool's own, or one shared with
+// other worker pools, of which each uses no more than its size.
+//
+class worker_pool
+{
+public:
+    typedef task_pool::band_function band_function;
+
+    // 'size' is the number of threads taking part in parallel_for(), including the caller
+    // Without a task_pool, the worker pool starts its own threads.
+    explicit worker_pool( size_t size = 1, std::shared_ptr< task_pool > pool = nullptr );
+
+    worker_pool( worker_pool const & ) = delete;
+    worker_pool & operator=( worker_pool const & ) = delete;
+
+    // Change the number of threads; with its own threads, waits for a running parallel_for() to finish
+    void resize( size_t size );
+    size_t size() const { return _size; }
+
+    // Call fn over bands covering [0, count), no smaller than min_band items (except for the last)
+    // Bands may run concurrently and in any order; an exception thrown by fn is rethrown here once
+    // all bands are done.
+    void parallel_for( size_t count, band_function const & fn, size_t min_band = 1 );
+
+private:
+    std::shared_ptr< task_pool > _pool;
+    bool const _own_pool;
+    std::atomic< size_t > _size;
+};
@@ -0,0 +1,328 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/concurrency/task-pool.h>
+
+#include <algorithm>
+#include <exception>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+// Each thread gets a few bands so a slow band (e.g., one full of holes) does not hold the others
+static const size_t BANDS_PER_THREAD = 4;
+
+// The pool and queue of the thread we're on, if it's one of a pool's
+static thread_local task_pool const * current_pool = nullptr;
+static thread_local size_t current_queue = 0;
+
+
+namespace {
+
+
+// The state of one parallel_for(), shared with the tasks that help with it
+struct parallel_job
+{
+    task_pool::band_function const * fn;
+    size_t count;
+    size_t band;
+    size_t n_bands;
+    std::atomic< size_t > next_band;
+    std::atomic< size_t > done_bands;
+
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::exception_ptr exception;
+
+    // Run bands until none are left to start
+    void run()
+    {
+        for( ;; )
+        {
+            size_t const b = next_band.fetch_add( 1 );
+            if( b >= n_bands )
+                break;
+            try
+            {
+                ( *fn )( b * band, std::min( ( b + 1 ) * band, count ) );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                if( ! exception )
+                    exception = std::current_exception();
+            }
+            if( done_bands.fetch_add( 1 ) + 1 == n_bands )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                done_cv.notify_all();
+            }
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock< std::mutex > lock( mutex );
+        done_cv.wait( lock, [this]() { return done_bands == n_bands; } );
+    }
+};
+
+
+}  // namespace
+
+
+size_t task_pool::default_size()
+{
+    auto const cpus = std::thread::hardware_concurrency();
+    return cpus > 1 ? cpus - 1 : 0;
+}
+
+
+task_pool::task_pool( size_t size )
+    : _size( size )
+    , _started( false )
+    , _stopping( false )
+    , _queued( 0 )
+    , _setup_done( 0 )
+    , _setup_failed( false )
+    , _next_queue( 0 )
+{
+    _settings.size = size;
+}
+
+
+task_pool::~task_pool()
+{
+    stop_threads();
+}
+
+
+bool task_pool::configure( settings const & s )
+{
+    stop_threads();
+
+    std::unique_lock< std::mutex > lock( _mutex );
+    _settings = s;
+    _size = s.size;
+    start_threads();
+    _started_cv.wait( lock, [this]() { return _setup_done == _workers.size(); } );
+    return ! _setup_failed;
+}
+
+
+task_pool::settings task_pool::get_settings() const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return _settings;
+}
+
+
+// Called with the lock held
+void task_pool::start_threads()
+{
+    _stopping = false;
+    _setup_done = 0;
+    _setup_failed = false;
+    for( size_t i = 0; i < _settings.size; ++i )
+        _workers.emplace_back( new worker );
+    for( size_t i = 0; i < _workers.size(); ++i )
+        _workers[i]->thread = std::thread( [this, i]() { run( i ); } );
+    _started = true;
+}
+
+
+void task_pool::stop_threads()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ! _started )
+            return;
+        _stopping = true;
+    }
+    _work_cv.notify_all();
+    for( auto & w : _workers )
+        w->thread.join();
+
+    std::lock_guard< std::mutex > lock( _mutex );
+    _workers.clear();
+    _started = false;
+}
+
+
+bool task_pool::apply_settings( settings const & s )
+{
+    bool ok = true;
+#ifdef _WIN32
+    if( ! s.cpus.empty() )
+    {
+        DWORD_PTR mask = 0;
+        for( int cpu : s.cpus )
+            if( cpu >= 0 && cpu < int( 8 * sizeof( mask ) ) )
+                mask |= DWORD_PTR( 1 ) << cpu;
+        ok = mask && SetThreadAffinityMask( GetCurrentThread(), mask );
+    }
+    if( s.priority > 0 && ! SetThreadPriority( GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL ) )
+        ok = false;
+#else
+    if( ! s.cpus.empty() )
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO( &set );
+        for( int cpu : s.cpus )
+            if( cpu >= 0 && cpu < CPU_SETSIZE )
+                CPU_SET( cpu, &set );
+        // On Linux, 0 is the calling thread
+        ok = CPU_COUNT( &set ) && ! sched_setaffinity( 0, sizeof( set ), &set );
+#else
+        ok = false;  // no thread affinity on macOS
+#endif
+    }
+    if( s.priority > 0 )
+    {
+        sched_param param = {};
+        param.sched_priority = std::min( std::max( s.priority, sched_get_priority_min( SCHED_FIFO ) ),
+                                         sched_get_priority_max( SCHED_FIFO ) );
+        if( pthread_setschedparam( pthread_self(), SCHED_FIFO, &param ) )
+            ok = false;
+    }
+#endif
+    return ok;
+}
+
+
+void task_pool::run( size_t index )
+{
+    current_pool = this;
+    current_queue = index;
+
+    std::unique_lock< std::mutex > lock( _mutex );
+    auto const s = _settings;
+    lock.unlock();
+    bool const ok = apply_settings( s );
+    lock.lock();
+    if( ! ok )
+        _setup_failed = true;
+    if( ++_setup_done == _workers.size() )
+        _started_cv.notify_all();
+
+    for( ;; )
+    {
+        // Tasks left when stopping are still run
+        _work_cv.wait( lock, [this]() { return _stopping || _queued; } );
+        if( ! _queued )
+            break;
+        lock.unlock();
+        while( try_run_one( index ) )
+            ;
+        lock.lock();
+    }
+}
+
+
+bool task_pool::try_run_one( size_t index )
+{
+    task t;
+    // Our own queue first, newest first as it's likely still in the cache; then steal the oldest of the others'
+    for( size_t i = 0; i < _workers.size() && ! t; ++i )
+    {
+        auto & w = *_workers[( index + i ) % _workers.size()];
+        std::lock_guard< std::mutex > lock( w.mutex );
+        if( w.tasks.empty() )
+            continue;
+        if( ! i )
+        {
+            t = std::move( w.tasks.back() );
+            w.tasks.pop_back();
+        }
+        else
+        {
+            t = std::move( w.tasks.front() );
+            w.tasks.pop_front();
+        }
+    }
+    if( ! t )
+        return false;
+
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        --_queued;
+    }
+    try
+    {
+        t();
+    }
+    catch( ... )
+    {
+    }
+    return true;
+}
+
+
+void task_pool::submit( task && t )
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    if( ! _started && ! _stopping )
+        start_threads();
+    if( _workers.empty() || _stopping )
+    {
+        lock.unlock();
+        try
+        {
+            t();
+        }
+        catch( ... )
+        {
+        }
+        return;
+    }
+
+    size_t const index = current_pool == this ? current_queue : _next_queue++ % _workers.size();
+    {
+        std::lock_guard< std::mutex > queue_lock( _workers[index]->mutex );
+        _workers[index]->tasks.push_back( std::move( t ) );
+    }
+    ++_queued;
+    lock.unlock();
+    _work_cv.notify_one();
+}
+
+
+void task_pool::parallel_for( size_t count, band_function const & fn, size_t max_threads, size_t min_band )
+{
+    if( ! count )
+        return;
+
+    size_t const threads = std::min( max_threads, _size + 1 );
+    if( threads <= 1 || count <= min_band )
+    {
+        fn( 0, count );
+        return;
+    }
+
+    auto job = std::make_shared< parallel_job >();
+    size_t const n_bands = threads * BANDS_PER_THREAD;
+    job->fn = &fn;
+    job->count = count;
+    job->band = std::max( ( count + n_bands - 1 ) / n_bands, std::max( min_band, size_t( 1 ) ) );
+    job->n_bands = ( count + job->band - 1 ) / job->band;
+    job->next_band = 0;
+    job->done_bands = 0;
+
+    // Helpers that start after all bands were taken return right away, without touching fn
+    for( size_t i = 1; i < std::min( threads, job->n_bands ); ++i )
+        submit( [job]() { job->run(); } );
+
+    job->run();
+    job->wait();
+    if( job->exception )
+        std::rethrow_exception( job->exception );
+}
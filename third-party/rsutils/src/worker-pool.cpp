@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <algorithm>
+
+
+worker_pool::worker_pool( size_t size, std::shared_ptr< task_pool > pool )
+    : _pool( pool )
+    , _own_pool( ! pool )
+    , _size( std::max( size, size_t( 1 ) ) )
+{
+    if( _own_pool )
+        _pool = std::make_shared< task_pool >( _size - 1 );
+}
+
+
+void worker_pool::resize( size_t size )
+{
+    size = std::max( size, size_t( 1 ) );
+    if( size == _size )
+        return;
+    _size = size;
+    if( _own_pool )
+    {
+        task_pool::settings s = _pool->get_settings();
+        s.size = size - 1;
+        _pool->configure( s );
+    }
+}
+
+
+void worker_pool::parallel_for( size_t count, band_function const & fn, size_t min_band )
+{
+    _pool->parallel_for( count, fn, _size, min_band );
+}
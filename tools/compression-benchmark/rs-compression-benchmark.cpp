@@ -0,0 +1,148 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/bag.h"
+#include "rosbag/view.h"
+#include "sensor_msgs/Image.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tclap/CmdLine.h"
+
+using namespace TCLAP;
+
+struct codec
+{
+    std::string name;
+    rosbag::compression::CompressionType type;
+    int level;
+};
+
+struct result
+{
+    double ratio;
+    double write_mbps;
+    double read_mbps;
+};
+
+// "/device_0/sensor_0/Depth_0/image/data" -> "Depth"
+static std::string stream_of(std::string const & topic)
+{
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    while (begin < topic.size())
+    {
+        auto end = topic.find('/', begin);
+        if (end == std::string::npos)
+            end = topic.size();
+        if (end > begin)
+            parts.push_back(topic.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    if (parts.size() < 3)
+        return topic;
+    auto stream = parts[2];
+    auto underscore = stream.rfind('_');
+    return underscore == std::string::npos ? stream : stream.substr(0, underscore);
+}
+
+// Writes the images the way the recorder does, with the chunks compressed on this thread so the time is
+// that of one core, then reads them back
+static result run(std::vector<rosbag::MessageInstance> const & images, codec const & c, std::string const & file)
+{
+    typedef std::chrono::duration<double> seconds;
+    auto start = std::chrono::high_resolution_clock::now();
+    rosbag::Bag out;
+    out.open(file, rosbag::BagMode::Write);
+    out.setCompression(c.type);
+    out.setCompressionLevel(c.level);
+    out.setChunkWriteBehind(2, [](std::function<void()> task) { task(); });
+    for (auto const & m : images)
+        out.write(m.getTopic(), m.getTime(), m.instantiate<sensor_msgs::Image>());
+    out.close();
+    seconds write_time = std::chrono::high_resolution_clock::now() - start;
+    auto stats = out.getWriteStats();
+
+    start = std::chrono::high_resolution_clock::now();
+    rosbag::Bag in;
+    in.open(file, rosbag::BagMode::Read);
+    size_t read = 0;
+    for (auto const & m : rosbag::View(in))
+        if (m.instantiate<sensor_msgs::Image>())
+            ++read;
+    in.close();
+    seconds read_time = std::chrono::high_resolution_clock::now() - start;
+    std::remove(file.c_str());
+    if (read != images.size())
+        throw std::runtime_error("read back " + std::to_string(read) + " of " + std::to_string(images.size()) + " images");
+
+    double const mb = stats.bytes_in / 1e6;
+    return { stats.bytes_out ? double(stats.bytes_in) / stats.bytes_out : 0., mb / write_time.count(), mb / read_time.count() };
+}
+
+int main(int argc, char * argv[]) try
+{
+    CmdLine cmd("librealsense rs-compression-benchmark tool", ' ');
+    UnlabeledValueArg<std::string> input("input", "Recording to take the images from", true, "", "file");
+    ValueArg<int> frames("n", "frames", "Images of each stream to use", false, 100, "");
+    ValueArg<std::string> temp("t", "temp", "Temporary file to write the images to", false, "compression-benchmark.bag", "");
+    cmd.add(input);
+    cmd.add(frames);
+    cmd.add(temp);
+    cmd.parse(argc, argv);
+
+    rosbag::Bag bag;
+    bag.open(input.getValue(), rosbag::BagMode::Read);
+    std::map<std::string, std::vector<rosbag::MessageInstance>> streams;
+    for (auto const & m : rosbag::View(bag))
+    {
+        if (m.getDataType() != "sensor_msgs/Image")
+            continue;
+        auto & images = streams[stream_of(m.getTopic())];
+        if (images.size() < size_t(frames.getValue()))
+            images.push_back(m);
+    }
+    if (streams.empty())
+    {
+        std::cerr << input.getValue() << " has no images" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<codec> codecs = {
+        { "none", rosbag::compression::Uncompressed, 0 },
+        { "lz4", rosbag::compression::LZ4, 0 },
+        { "lz4-hc", rosbag::compression::LZ4, 3 },
+        { "lz4-hc", rosbag::compression::LZ4, 9 },
+        { "lz4-hc", rosbag::compression::LZ4, 12 },
+    };
+    if (rosbag::Bag::isCompressionSupported(rosbag::compression::ZSTD))
+        for (int level : { 1, 3, 9, 19 })
+            codecs.push_back({ "zstd", rosbag::compression::ZSTD, level });
+    else
+        std::cout << "Zstandard is not supported by this build (see BUILD_WITH_ZSTD)" << std::endl;
+
+    std::cout << std::left << std::setw(12) << "stream" << std::setw(8) << "codec" << std::right << std::setw(6) << "level"
+              << std::setw(8) << "ratio" << std::setw(13) << "write MB/s" << std::setw(12) << "read MB/s" << std::endl;
+    for (auto const & stream : streams)
+    {
+        for (auto const & c : codecs)
+        {
+            auto r = run(stream.second, c, temp.getValue());
+            std::cout << std::left << std::setw(12) << stream.first << std::setw(8) << c.name << std::right << std::setw(6) << c.level
+                      << std::fixed << std::setprecision(2) << std::setw(8) << r.ratio
+                      << std::setprecision(1) << std::setw(13) << r.write_mbps << std::setw(12) << r.read_mbps << std::endl;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e)
+{
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include "../recorded-frames.h"
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/sse/avx-align.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace librealsense;
+
+// The arithmetic of get_texture_map_sse() in sse-align.cpp, one pixel at a time and in the same order
+static void distort( rs2_distortion dist, float & x, float & y, float const c[5] )
+{
+    if( dist == RS2_DISTORTION_MODIFIED_BROWN_CONRADY )
+    {
+        float r2 = x * x + y * y;
+        float r3 = c[1] * ( r2 * r2 ) + c[4] * ( r2 * ( r2 * r2 ) );
+        float f = 1 + ( c[0] * r2 + r3 );
+        float x_f = x * f, y_f = y * f;
+        float r4 = c[3] * ( r2 + 2 * ( x_f * x_f ) );
+        x = x_f + ( 2 * ( c[2] * ( x_f * y_f ) ) + r4 );
+        y = y_f + ( 2 * ( c[3] * ( x_f * y_f ) ) + r4 );
+    }
+    else if( dist == RS2_DISTORTION_BROWN_CONRADY )
+    {
+        float r2 = x * x + y * y;
+        float f = ( ( 1 + c[0] * r2 ) + ( c[1] * r2 ) * r2 ) + ( ( c[4] * r2 ) * r2 ) * r2;
+        float dx = ( x * f + ( ( 2 * c[2] ) * x ) * y ) + c[3] * ( r2 + ( 2 * x ) * x );
+        float dy = ( y * f + ( ( 2 * c[3] ) * x ) * y ) + c[2] * ( r2 + ( 2 * y ) * y );
+        x = dx;
+        y = dy;
+    }
+}
+
+static void texture_map_scalar( uint16_t const * depth, float depth_scale, size_t count, float const * map_x,
+                                float const * map_y, int32_t * pixels, rs2_intrinsics const & to,
+                                rs2_extrinsics const & e, rs2_distortion dist )
+{
+    auto r = e.rotation;
+    auto t = e.translation;
+    for( size_t i = 0; i < count; ++i )
+    {
+        float d = float( depth[i] ) * depth_scale;
+        if( ! d )
+        {
+            pixels[2 * i] = pixels[2 * i + 1] = 0;
+            continue;
+        }
+        float px = d * map_x[i], py = d * map_y[i];
+        float x = r[0] * px + ( r[3] * py + ( r[6] * d + t[0] ) );
+        float y = r[1] * px + ( r[4] * py + ( r[7] * d + t[1] ) );
+        float z = r[2] * px + ( r[5] * py + ( r[8] * d + t[2] ) );
+        x = x / z;
+        y = y / z;
+        distort( dist, x, y, to.coeffs );
+        pixels[2 * i] = int32_t( std::nearbyint( ( x * to.fx + to.ppx ) + 0.5f ) );
+        pixels[2 * i + 1] = int32_t( std::nearbyint( ( y * to.fy + to.ppy ) + 0.5f ) );
+    }
+}
+
+typedef size_t ( *texture_map_kernel )( uint16_t const *, float, size_t, float const *, float const *, int32_t *,
+                                        rs2_intrinsics const &, rs2_extrinsics const &, rs2_distortion );
+
+static void compare_texture_map( texture_map_kernel kernel, size_t width )
+{
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    REQUIRE( recording.color );
+    auto const depth_profile = recording.depth.get_profile().as< rs2::video_stream_profile >();
+    auto const color_profile = recording.color.get_profile().as< rs2::video_stream_profile >();
+    auto const depth_intrin = depth_profile.get_intrinsics();
+    auto const depth_to_color = depth_profile.get_extrinsics_to( color_profile );
+    auto const depth = reinterpret_cast< uint16_t const * >( recording.depth.get_data() );
+    auto const depth_scale = recording.depth.get_units();
+
+    // The rays through the top-left corners of the depth pixels, as the SSE align computes them
+    size_t const size = size_t( depth_intrin.width ) * depth_intrin.height;
+    std::vector< float > map_x( size ), map_y( size );
+    for( int y = 0, i = 0; y < depth_intrin.height; ++y )
+        for( int x = 0; x < depth_intrin.width; ++x, ++i )
+        {
+            map_x[i] = ( x - 0.5f - depth_intrin.ppx ) / depth_intrin.fx;
+            map_y[i] = ( y - 0.5f - depth_intrin.ppy ) / depth_intrin.fy;
+        }
+
+    auto to = color_profile.get_intrinsics();
+    float const coeffs[5] = { 0.180086836f, -0.534179211f, -0.00139013783f, 0.000118769123f, 0.470662683f };
+    std::copy( coeffs, coeffs + 5, to.coeffs );
+    for( auto dist : { RS2_DISTORTION_NONE, RS2_DISTORTION_MODIFIED_BROWN_CONRADY, RS2_DISTORTION_BROWN_CONRADY } )
+    {
+        CAPTURE( dist );
+        to.model = dist;
+        // A count that is not a multiple of the width, to leave a tail
+        size_t const count = size - 3;
+        std::vector< int32_t > expected( 2 * count ), pixels( 2 * count, -1 );
+        texture_map_scalar( depth, depth_scale, count, map_x.data(), map_y.data(), expected.data(), to, depth_to_color, dist );
+        auto const done = kernel( depth, depth_scale, count, map_x.data(), map_y.data(), pixels.data(), to, depth_to_color, dist );
+        CHECK( done == count / width * width );
+        pixels.resize( 2 * done );
+        expected.resize( 2 * done );
+        CHECK( pixels == expected );
+    }
+}
+
+TEST_CASE( "AVX2 align texture map matches the SSE arithmetic", "[align][avx]" )
+{
+    if( ! align_texture_map_avx2_built || ! has_avx2() )
+    {
+        std::cout << "AVX2 is not available - skipping test" << std::endl;
+        return;
+    }
+    compare_texture_map( align_texture_map_avx2, 8 );
+}
+
+TEST_CASE( "AVX-512 align texture map matches the SSE arithmetic", "[align][avx]" )
+{
+    if( ! align_texture_map_avx512_built || ! has_avx512() )
+    {
+        std::cout << "AVX-512 is not available - skipping test" << std::endl;
+        return;
+    }
+    compare_texture_map( align_texture_map_avx512, 16 );
+}
+
+TEST_CASE( "AVX-512 align z-buffer matches the scalar loop", "[align][avx]" )
+{
+    if( ! align_z_buffer_avx512_built || ! has_avx512() )
+    {
+        std::cout << "AVX-512 is not available - skipping test" << std::endl;
+        return;
+    }
+
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    auto const z = reinterpret_cast< uint16_t const * >( recording.depth.get_data() );
+    size_t const count = size_t( recording.depth.get_width() ) * recording.depth.get_height() - 5;
+
+    // Recorded depth to pixels of smaller images, so that many depth pixels land on the same one (and some
+    // outside it); the odd-sized one has a last pixel that is not part of a 32-bit word
+    int const width = recording.depth.get_width(), height = recording.depth.get_height();
+    for( auto to_size : { std::make_pair( width, height ), std::make_pair( 160, 120 ), std::make_pair( 41, 31 ) } )
+    {
+        int const to_width = to_size.first, to_height = to_size.second;
+        CAPTURE( to_width );
+        CAPTURE( to_height );
+        std::vector< int32_t > pixels( 2 * count );
+        for( size_t i = 0; i < count; ++i )
+        {
+            pixels[2 * i] = int32_t( i % width ) * to_width / width - 1;
+            pixels[2 * i + 1] = int32_t( i / width ) * to_height / height + ( z[i] & 1 );
+        }
+
+        std::vector< uint16_t > expected( size_t( to_width ) * to_height, 0 ), dest( expected.size(), 0 );
+        auto scalar = [&]( size_t begin, std::vector< uint16_t > & out ) {
+            for( size_t i = begin; i < count; ++i )
+            {
+                int const x = pixels[2 * i], y = pixels[2 * i + 1];
+                if( ! z[i] || x < 0 || y < 0 || x >= to_width || y >= to_height )
+                    continue;
+                auto & d = out[y * to_width + x];
+                d = d ? std::min( d, z[i] ) : z[i];
+            }
+        };
+        scalar( 0, expected );
+        REQUIRE( std::any_of( expected.begin(), expected.end(), []( uint16_t d ) { return d != 0; } ) );
+        auto const done = align_z_buffer_avx512( z, pixels.data(), count, dest.data(), to_width, to_height );
+        CHECK( done == count / 16 * 16 );
+        scalar( done, dest );
+        CHECK( dest == expected );
+    }
+}
@@ -0,0 +1,153 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include "../recorded-frames.h"
+#include <librealsense2/rsutil.h>
+#include <src/proc/align.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace librealsense;
+
+// The depth pixel corners as align mapped them before the rays were cached: deprojected on every frame
+template< class TRANSFER_PIXEL >
+static void align_uncached( rs2_intrinsics const & depth_intrin, uint16_t const * z_pixels, float z_scale,
+                            rs2_extrinsics const & depth_to_other, rs2_intrinsics const & other_intrin,
+                            TRANSFER_PIXEL transfer_pixel )
+{
+    for( int depth_y = 0; depth_y < depth_intrin.height; ++depth_y )
+    {
+        int depth_pixel_index = depth_y * depth_intrin.width;
+        for( int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index )
+        {
+            float const depth = z_scale * z_pixels[depth_pixel_index];
+            if( ! depth )
+                continue;
+
+            int other_corner[2][2];
+            for( int corner = 0; corner < 2; ++corner )
+            {
+                float const offset = corner ? 0.5f : -0.5f;
+                float depth_pixel[2] = { depth_x + offset, depth_y + offset }, depth_point[3], other_point[3], other_pixel[2];
+                rs2_deproject_pixel_to_point( depth_point, &depth_intrin, depth_pixel, depth );
+                rs2_transform_point_to_point( other_point, &depth_to_other, depth_point );
+                rs2_project_point_to_pixel( other_pixel, &other_intrin, other_point );
+                other_corner[corner][0] = static_cast< int >( other_pixel[0] + 0.5f );
+                other_corner[corner][1] = static_cast< int >( other_pixel[1] + 0.5f );
+            }
+            if( other_corner[0][0] < 0 || other_corner[0][1] < 0 || other_corner[1][0] >= other_intrin.width
+                || other_corner[1][1] >= other_intrin.height )
+                continue;
+
+            for( int y = other_corner[0][1]; y <= other_corner[1][1]; ++y )
+                for( int x = other_corner[0][0]; x <= other_corner[1][0]; ++x )
+                    transfer_pixel( depth_pixel_index, y * other_intrin.width + x );
+        }
+    }
+}
+
+// The align block itself, rather than the vectorized one rs2::align picks on x86
+static rs2::filter scalar_align( rs2_stream to )
+{
+    return rs2::filter( std::shared_ptr< rs2_processing_block >( new rs2_processing_block( std::make_shared< align >( to ) ),
+                                                                 rs2_delete_processing_block ) );
+}
+
+TEST_CASE( "cached rays deproject like rs2_deproject_pixel_to_point", "[align]" )
+{
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    auto const z_pixels = reinterpret_cast< uint16_t const * >( recording.depth.get_data() );
+    auto const z_scale = recording.depth.get_units();
+    auto recorded = recording.depth.get_profile().as< rs2::video_stream_profile >().get_intrinsics();
+
+    // The recorded calibration, and the models with distortion to undo
+    std::vector< rs2_intrinsics > intrinsics( 3, recorded );
+    intrinsics[1].model = RS2_DISTORTION_BROWN_CONRADY;
+    intrinsics[2].model = RS2_DISTORTION_INVERSE_BROWN_CONRADY;
+    for( int i = 1; i < 3; ++i )
+    {
+        float const coeffs[5] = { 0.180086836f, -0.534179211f, -0.00139013783f, 0.000118769123f, 0.470662683f };
+        std::copy( coeffs, coeffs + 5, intrinsics[i].coeffs );
+    }
+
+    align_ray_cache rays;
+    for( auto const & intrin : intrinsics )
+    {
+        CAPTURE( intrin.model );
+        CHECK( rays.update( intrin ) );
+        CHECK( ! rays.update( intrin ) );
+
+        for( int y = 0, i = 0; y < intrin.height; ++y )
+            for( int x = 0; x < intrin.width; ++x, ++i )
+            {
+                float const depth = z_scale * z_pixels[i];
+                if( ! depth )
+                    continue;
+                float top_left[2] = { x - 0.5f, y - 0.5f }, bottom_right[2] = { x + 0.5f, y + 0.5f }, point[3];
+                rs2_deproject_pixel_to_point( point, &intrin, top_left, depth );
+                REQUIRE( depth * rays.top_left()[i].x == point[0] );
+                REQUIRE( depth * rays.top_left()[i].y == point[1] );
+                rs2_deproject_pixel_to_point( point, &intrin, bottom_right, depth );
+                REQUIRE( depth * rays.bottom_right()[i].x == point[0] );
+                REQUIRE( depth * rays.bottom_right()[i].y == point[1] );
+            }
+    }
+}
+
+TEST_CASE( "align with cached rays matches deprojecting every frame", "[align]" )
+{
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    REQUIRE( recording.color );
+    auto const depth_profile = recording.depth.get_profile().as< rs2::video_stream_profile >();
+    auto const color_profile = recording.color.get_profile().as< rs2::video_stream_profile >();
+    auto const depth_intrin = depth_profile.get_intrinsics();
+    auto const color_intrin = color_profile.get_intrinsics();
+    auto const depth_to_color = depth_profile.get_extrinsics_to( color_profile );
+    auto const z_pixels = reinterpret_cast< uint16_t const * >( recording.depth.get_data() );
+    auto const z_scale = recording.depth.get_units();
+    auto const bpp = recording.color.get_bytes_per_pixel();
+
+    SECTION( "depth to color" )
+    {
+        std::vector< uint16_t > expected( size_t( color_intrin.width ) * color_intrin.height, 0 );
+        align_uncached( depth_intrin, z_pixels, z_scale, depth_to_color, color_intrin, [&]( int from, int to ) {
+            expected[to] = expected[to] ? std::min( expected[to], z_pixels[from] ) : z_pixels[from];
+        } );
+        REQUIRE( std::any_of( expected.begin(), expected.end(), []( uint16_t z ) { return z != 0; } ) );
+
+        // Twice: the second frame uses the rays cached by the first
+        auto block = scalar_align( RS2_STREAM_COLOR );
+        for( int i = 0; i < 2; ++i )
+        {
+            auto aligned = block.process( recording.frameset() ).as< rs2::frameset >().get_depth_frame();
+            REQUIRE( aligned );
+            REQUIRE( aligned.get_data_size() == int( expected.size() * sizeof( uint16_t ) ) );
+            CHECK( ! std::memcmp( aligned.get_data(), expected.data(), expected.size() * sizeof( uint16_t ) ) );
+        }
+    }
+
+    SECTION( "color to depth" )
+    {
+        auto const color_pixels = static_cast< uint8_t const * >( recording.color.get_data() );
+        std::vector< uint8_t > expected( size_t( depth_intrin.width ) * depth_intrin.height * bpp, 0 );
+        align_uncached( depth_intrin, z_pixels, z_scale, depth_to_color, color_intrin, [&]( int from, int to ) {
+            std::memcpy( &expected[from * bpp], color_pixels + to * bpp, bpp );
+        } );
+
+        auto block = scalar_align( RS2_STREAM_DEPTH );
+        for( int i = 0; i < 2; ++i )
+        {
+            auto aligned = block.process( recording.frameset() ).as< rs2::frameset >().get_color_frame();
+            REQUIRE( aligned );
+            REQUIRE( aligned.get_data_size() == int( expected.size() ) );
+            CHECK( ! std::memcmp( aligned.get_data(), expected.data(), expected.size() ) );
+        }
+    }
+}
@@ -0,0 +1,101 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <src/environment.h>
+#include <src/proc/color-formats-converter.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace librealsense;
+
+// Converts a frame of a software sensor with 'threads' converter threads. The block converts another frame first,
+// whose memory it then reuses, so that pixels left unconverted do not pass for converted ones.
+static std::vector< uint8_t > convert( std::shared_ptr< functional_processing_block > converter,
+                                       std::pair< rs2::frame, rs2::frame > const & frames, size_t threads )
+{
+    environment::get_instance().set_converter_threads( threads );
+    rs2::filter block( std::shared_ptr< rs2_processing_block >( new rs2_processing_block( converter ), rs2_delete_processing_block ) );
+    block.process( frames.second );
+    auto const & f = frames.first;
+    auto out = block.process( f ).as< rs2::video_frame >();
+    environment::get_instance().set_converter_threads( 1 );
+    REQUIRE( out );
+    REQUIRE( out.get_width() == f.as< rs2::video_frame >().get_width() );
+    auto data = static_cast< uint8_t const * >( out.get_data() );
+    return std::vector< uint8_t >( data, data + out.get_data_size() );
+}
+
+// A frame of some detail, in a format of 'bpp' bytes per pixel, and another one of the same size
+static std::pair< rs2::frame, rs2::frame > make_frames( rs2_format format, int bpp, int width, int height )
+{
+    static rs2::software_device dev;
+    static auto sensor = dev.add_sensor( "Color" );
+    rs2_intrinsics intrinsics{ width, height, width / 2.f, height / 2.f, 100, 100, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    static int uid = 0;
+    auto profile = sensor.add_video_stream( { RS2_STREAM_COLOR, 0, uid++, width, height, 30, bpp, format, intrinsics } );
+
+    rs2::frame_queue frames( 2, true );
+    sensor.open( profile );
+    sensor.start( frames );
+    // The frames own their pixels, as they outlive this function
+    size_t const size = size_t( width ) * height * bpp;
+    for( int n = 1; n <= 2; ++n )
+    {
+        auto pixels = new uint8_t[size];
+        for( size_t i = 0; i < size; ++i )
+            pixels[i] = uint8_t( ( i * 7 * n + i / width ) % 251 );
+        sensor.on_video_frame( { pixels, []( void * p ) { delete[] static_cast< uint8_t * >( p ); }, width * bpp, bpp,
+                                 n * 33., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, profile } );
+    }
+    auto f = frames.wait_for_frame();
+    auto other = frames.wait_for_frame();
+    sensor.stop();
+    sensor.close();
+    return { f, other };
+}
+
+TEST_CASE( "converters split into bands convert like a single pass", "[converters]" )
+{
+    // Enough threads for the bands, however many CPUs there are
+    auto pool = environment::get_instance().get_task_pool();
+    auto settings = pool->get_settings();
+    settings.size = 7;
+    REQUIRE( pool->configure( settings ) );
+
+    // 424 is not a whole number of 16- or 32-pixel blocks per row, nor of 32-pixel blocks per two rows; 312 rows
+    // split into bands of an odd number of rows
+    for( auto size : { std::make_pair( 424, 240 ), std::make_pair( 424, 312 ), std::make_pair( 640, 480 ),
+                       std::make_pair( 848, 100 ), std::make_pair( 1280, 720 ) } )
+    {
+        int const width = size.first, height = size.second;
+        CAPTURE( width );
+        CAPTURE( height );
+
+        auto yuy2 = make_frames( RS2_FORMAT_YUYV, 2, width, height );
+        auto uyvy = make_frames( RS2_FORMAT_UYVY, 2, width, height );
+        auto bgr = make_frames( RS2_FORMAT_BGR8, 3, width, height );
+        for( auto format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8, RS2_FORMAT_Y16 } )
+        {
+            CAPTURE( format );
+            auto expected = convert( std::make_shared< yuy2_converter >( format ), yuy2, 1 );
+            for( size_t threads : { 2, 3, 8 } )
+            {
+                CAPTURE( threads );
+                CHECK( convert( std::make_shared< yuy2_converter >( format ), yuy2, threads ) == expected );
+            }
+        }
+        for( auto format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGRA8 } )
+        {
+            CAPTURE( format );
+            auto expected = convert( std::make_shared< uyvy_converter >( format ), uyvy, 1 );
+            CHECK( convert( std::make_shared< uyvy_converter >( format ), uyvy, 3 ) == expected );
+        }
+        auto expected = convert( std::make_shared< bgr_to_rgb >(), bgr, 1 );
+        CHECK( convert( std::make_shared< bgr_to_rgb >(), bgr, 3 ) == expected );
+    }
+}
@@ -0,0 +1,103 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/mjpeg-decoder.h>
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <cstdio>  // jpeglib.h needs FILE
+#include <vector>
+
+#include <jpeglib.h>
+
+using namespace librealsense;
+
+// A width x height RGB image with some detail, compressed with a restart marker every 'restart_rows' MCU rows
+static std::vector< uint8_t > make_jpeg( int width, int height, int h_samp, int v_samp, int restart_rows )
+{
+    std::vector< uint8_t > rgb( size_t( width ) * height * 3 );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            auto p = &rgb[( size_t( y ) * width + x ) * 3];
+            p[0] = uint8_t( x * 255 / width );
+            p[1] = uint8_t( y * 255 / height );
+            p[2] = uint8_t( ( x * y ) % 251 );
+        }
+
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr errors;
+    cinfo.err = jpeg_std_error( &errors );
+    jpeg_create_compress( &cinfo );
+    unsigned char * out = nullptr;
+    unsigned long out_size = 0;
+    jpeg_mem_dest( &cinfo, &out, &out_size );
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults( &cinfo );
+    jpeg_set_quality( &cinfo, 90, TRUE );
+    cinfo.comp_info[0].h_samp_factor = h_samp;
+    cinfo.comp_info[0].v_samp_factor = v_samp;
+    cinfo.restart_in_rows = restart_rows;
+    jpeg_start_compress( &cinfo, TRUE );
+    while( cinfo.next_scanline < cinfo.image_height )
+    {
+        JSAMPROW row = &rgb[size_t( cinfo.next_scanline ) * width * 3];
+        jpeg_write_scanlines( &cinfo, &row, 1 );
+    }
+    jpeg_finish_compress( &cinfo );
+    jpeg_destroy_compress( &cinfo );
+
+    std::vector< uint8_t > jpeg( out, out + out_size );
+    free( out );
+    return jpeg;
+}
+
+static void compare_banded_vs_single_pass( std::vector< uint8_t > const & jpeg, int width, int height )
+{
+    for( auto format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8 } )
+    {
+        CAPTURE( format );
+        size_t const bpp = format == RS2_FORMAT_Y8 ? 1 : format == RS2_FORMAT_RGB8 ? 3 : 4;
+
+        worker_pool single( 1 );
+        std::vector< uint8_t > expected( width * height * bpp );
+        REQUIRE( decode_mjpeg( jpeg.data(), jpeg.size(), format, expected.data(), width, height, single ) );
+
+        for( size_t threads : { 2, 3, 8 } )
+        {
+            CAPTURE( threads );
+            worker_pool workers( threads );
+            std::vector< uint8_t > banded( width * height * bpp, 0xCD );
+            REQUIRE( decode_mjpeg( jpeg.data(), jpeg.size(), format, banded.data(), width, height, workers ) );
+            CHECK( banded == expected );
+        }
+    }
+}
+
+TEST_CASE( "restart-interval bands decode like a single pass", "[mjpeg]" )
+{
+    // 4:2:2, as the cameras send: 16x8 MCUs, 60 rows of them at 480 lines
+    compare_banded_vs_single_pass( make_jpeg( 640, 480, 2, 1, 1 ), 640, 480 );
+    // Intervals of several MCU rows, with a last one that is cut short
+    compare_banded_vs_single_pass( make_jpeg( 424, 240, 2, 1, 7 ), 424, 240 );
+    // 4:4:4
+    compare_banded_vs_single_pass( make_jpeg( 320, 200, 1, 1, 2 ), 320, 200 );
+}
+
+TEST_CASE( "images that cannot be split are decoded in a single pass", "[mjpeg]" )
+{
+    // Vertical chroma subsampling smooths across MCU rows
+    compare_banded_vs_single_pass( make_jpeg( 640, 480, 2, 2, 1 ), 640, 480 );
+    // No restart markers
+    compare_banded_vs_single_pass( make_jpeg( 640, 480, 2, 1, 0 ), 640, 480 );
+}
+
+#endif  // RS2_USE_LIBJPEG_TURBO
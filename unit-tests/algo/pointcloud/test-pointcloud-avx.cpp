@@ -0,0 +1,132 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include "../recorded-frames.h"
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/sse/sse-pointcloud.h>
+#include <src/proc/sse/avx-pointcloud.h>
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace librealsense;
+
+// The cloud of the recorded depth, textured by the recorded color, as rs2::pointcloud::map_to() and calculate()
+// make it
+static rs2::points calculate( std::shared_ptr< pointcloud > pc, recorded_depth_color const & recording,
+                              bool occlusion_removal = true )
+{
+    rs2::filter block( std::shared_ptr< rs2_processing_block >( new rs2_processing_block( pc ), rs2_delete_processing_block ) );
+    if( ! occlusion_removal )
+        block.set_option( RS2_OPTION_FILTER_MAGNITUDE, 1.f );
+    auto const color_profile = recording.color.get_profile();
+    block.set_option( RS2_OPTION_STREAM_FILTER, float( color_profile.stream_type() ) );
+    block.set_option( RS2_OPTION_STREAM_FORMAT_FILTER, float( color_profile.format() ) );
+    block.set_option( RS2_OPTION_STREAM_INDEX_FILTER, float( color_profile.stream_index() ) );
+    block.process( recording.color );
+    auto points = block.process( recording.depth ).as< rs2::points >();
+    REQUIRE( points );
+    return points;
+}
+
+static void require_same_cloud( rs2::points const & a, rs2::points const & b )
+{
+    REQUIRE( a.size() == b.size() );
+    CHECK( ! std::memcmp( a.get_vertices(), b.get_vertices(), a.size() * sizeof( rs2::vertex ) ) );
+    CHECK( ! std::memcmp( a.get_texture_coordinates(), b.get_texture_coordinates(),
+                          a.size() * sizeof( rs2::texture_coordinate ) ) );
+}
+
+TEST_CASE( "AVX pointcloud matches the SSE one", "[pointcloud][avx]" )
+{
+    if( ! pointcloud_avx::is_supported() )
+    {
+        std::cout << "AVX2 is not available - skipping test" << std::endl;
+        return;
+    }
+
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    REQUIRE( recording.color );
+    require_same_cloud( calculate( std::make_shared< pointcloud_avx >(), recording ),
+                        calculate( std::make_shared< pointcloud_sse >(), recording ) );
+}
+
+TEST_CASE( "AVX pointcloud matches the scalar one", "[pointcloud][avx]" )
+{
+    if( ! pointcloud_avx::is_supported() )
+    {
+        std::cout << "AVX2 is not available - skipping test" << std::endl;
+        return;
+    }
+
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    REQUIRE( recording.color );
+    auto avx = calculate( std::make_shared< pointcloud_avx >(), recording );
+    auto scalar = calculate( std::make_shared< pointcloud >(), recording );
+    REQUIRE( avx.size() == scalar.size() );
+
+    // The scalar cloud goes through rs2_deproject_pixel_to_point() and rs2_project_point_to_pixel(), which
+    // round differently
+    auto const vertices = avx.get_vertices(), expected_vertices = scalar.get_vertices();
+    auto const texcoords = avx.get_texture_coordinates(), expected_texcoords = scalar.get_texture_coordinates();
+    for( size_t i = 0; i < avx.size(); ++i )
+    {
+        CAPTURE( i );
+        REQUIRE( vertices[i].x == approx( expected_vertices[i].x ) );
+        REQUIRE( vertices[i].y == approx( expected_vertices[i].y ) );
+        REQUIRE( vertices[i].z == approx( expected_vertices[i].z ) );
+        REQUIRE( texcoords[i].u == approx( expected_texcoords[i].u ) );
+        REQUIRE( texcoords[i].v == approx( expected_texcoords[i].v ) );
+    }
+}
+
+// pointcloud_avx uses AVX-512 when it can; the AVX2 kernels are compared on their own, against the SSE cloud
+TEST_CASE( "AVX2 pointcloud kernels match the SSE cloud", "[pointcloud][avx]" )
+{
+    if( ! pointcloud_avx2_built || ! has_avx2() )
+    {
+        std::cout << "AVX2 is not available - skipping test" << std::endl;
+        return;
+    }
+
+    recorded_depth_color recording;
+    REQUIRE( recording.depth );
+    REQUIRE( recording.color );
+    // Without occlusion removal, which zeroes some of the points and texture coordinates the kernels write
+    auto sse = calculate( std::make_shared< pointcloud_sse >(), recording, false );
+
+    auto const depth_profile = recording.depth.get_profile().as< rs2::video_stream_profile >();
+    auto const color_profile = recording.color.get_profile().as< rs2::video_stream_profile >();
+    auto const depth_intrin = depth_profile.get_intrinsics();
+    auto const color_intrin = color_profile.get_intrinsics();
+    auto const depth_to_color = depth_profile.get_extrinsics_to( color_profile );
+    REQUIRE( depth_intrin.model != RS2_DISTORTION_INVERSE_BROWN_CONRADY );
+
+    // The per-pixel rays of pointcloud_sse::preprocess()
+    size_t const size = sse.size();
+    std::vector< float > map_x( size ), map_y( size );
+    for( int h = 0, i = 0; h < depth_intrin.height; ++h )
+        for( int w = 0; w < depth_intrin.width; ++w, ++i )
+        {
+            map_x[i] = ( w - depth_intrin.ppx ) / depth_intrin.fx;
+            map_y[i] = ( h - depth_intrin.ppy ) / depth_intrin.fy;
+        }
+
+    // Only the whole blocks the kernels do are compared
+    std::vector< float > points( 3 * size ), texture( 2 * size ), pixels( 2 * size );
+    auto const depth = reinterpret_cast< uint16_t const * >( recording.depth.get_data() );
+    auto const deprojected = deproject_depth_avx2( depth, recording.depth.get_units(), size, map_x.data(), map_y.data(), points.data() );
+    CHECK( deprojected == size / 8 * 8 );
+    CHECK( ! std::memcmp( points.data(), sse.get_vertices(), deprojected * sizeof( rs2::vertex ) ) );
+
+    auto const mapped = get_texture_map_avx2( reinterpret_cast< float const * >( sse.get_vertices() ), size, color_intrin,
+                                              depth_to_color, texture.data(), pixels.data() );
+    CHECK( mapped == size / 8 * 8 );
+    CHECK( ! std::memcmp( texture.data(), sse.get_texture_coordinates(), mapped * sizeof( rs2::texture_coordinate ) ) );
+}
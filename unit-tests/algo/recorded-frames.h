@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/rs.hpp>
+
+#include <chrono>
+#include <string>
+
+
+// A file of unit-tests/resources, which are found relative to this header
+inline std::string resource_path( std::string const & name )
+{
+    std::string dir = __FILE__;
+    dir.resize( dir.find_last_of( "/\\" ) + 1 );
+    return dir + "../resources/" + name;
+}
+
+
+// The depth and color frames of single_depth_color_640x480.bag, played back without a device
+class recorded_depth_color
+{
+public:
+    recorded_depth_color()
+    {
+        auto playback = _ctx.load_device( resource_path( "single_depth_color_640x480.bag" ) );
+        playback.set_real_time( false );
+        _device = playback;
+
+        // Paused until every sensor is started, or the first to start can read the other's frame before it does
+        rs2::frame_queue frames( 100, true );
+        auto sensors = playback.query_sensors();
+        playback.pause();
+        for( auto & sensor : sensors )
+        {
+            sensor.open( sensor.get_stream_profiles() );
+            sensor.start( frames );
+        }
+        playback.resume();
+        auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+        while( ( ! depth || ! color ) && std::chrono::steady_clock::now() < timeout )
+        {
+            rs2::frame f;
+            if( ! frames.try_wait_for_frame( &f, 100 ) )
+                continue;
+            if( auto d = f.as< rs2::depth_frame >() )
+                depth = d;
+            else if( f.get_profile().stream_type() == RS2_STREAM_COLOR )
+                color = f.as< rs2::video_frame >();
+        }
+        for( auto & sensor : sensors )
+        {
+            sensor.stop();
+            sensor.close();
+        }
+    }
+
+    // Both frames in a frameset, as the align block takes them
+    rs2::frameset frameset() const
+    {
+        rs2::frame_queue result;
+        rs2::processing_block bundle( [this]( rs2::frame, rs2::frame_source & source ) {
+            source.frame_ready( source.allocate_composite_frame( { depth, color } ) );
+        } );
+        bundle.start( result );
+        bundle.invoke( depth );
+        return result.wait_for_frame();
+    }
+
+    rs2::depth_frame depth = rs2::frame();
+    rs2::video_frame color = rs2::frame();
+
+private:
+    rs2::context _ctx;
+    rs2::device _device;
+};
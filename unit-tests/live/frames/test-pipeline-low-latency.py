@@ -0,0 +1,48 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+# test:device D400*
+
+import pyrealsense2 as rs
+from rspy import test, log
+import time
+
+
+# A slow consumer of a low-latency pipeline should get the newest frames set, not the one it missed while busy:
+# the frames it gets should be no older than a couple of frames, and the ones it missed should be counted as dropped
+
+fps = 30
+max_latency_ms = 3 * 1000 / fps
+
+dev = test.find_first_device_or_exit()
+
+cfg = rs.config()
+cfg.enable_stream( rs.stream.depth, rs.format.z16, fps )
+cfg.enable_stream( rs.stream.infrared, 1, rs.format.y8, fps )
+cfg.enable_low_latency()
+
+
+################################################################################################
+test.start( "Slow consumer gets fresh frames" )
+
+pipe = rs.pipeline()
+pipe.start( cfg )
+test.check_equal( pipe.get_frames_latency(), 0 )
+for i in range( 30 ):    # let auto-exposure settle
+    pipe.wait_for_frames()
+
+dropped = pipe.get_dropped_framesets()
+for i in range( 5 ):
+    time.sleep( 0.5 )    # busy for about 15 frames
+    fs = pipe.wait_for_frames()
+    latency = pipe.get_frames_latency()
+    log.d( "frame", fs.get_frame_number(), "latency", latency, "ms; dropped", pipe.get_dropped_framesets() )
+    test.check( latency > 0 )
+    test.check( latency < max_latency_ms )
+test.check( pipe.get_dropped_framesets() >= dropped + 5 * 10 )
+
+pipe.stop()
+test.finish()
+
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,69 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+# test:device D400*
+
+import pyrealsense2 as rs
+from rspy import test, log
+import time
+import platform
+
+# Zero-copy frame delivery lends the backend (V4L2) buffers to the frames themselves.
+# Verify frames keep flowing, with the right size, while the user holds on to more frames
+# than there are lendable buffers (the sensor must fall back to copying them)
+
+if platform.system() != 'Linux':
+    log.i( "Zero-copy frame delivery is only supported by the V4L2 backend" )
+    test.print_results_and_exit()
+
+dev = test.find_first_device_or_exit()
+depth_sensor = dev.first_depth_sensor()
+
+if not depth_sensor.supports( rs.option.zero_copy_frames ):
+    log.i( "Depth sensor does not support zero-copy frames" )
+    test.print_results_and_exit()
+
+dp = next( p for p in depth_sensor.profiles
+           if p.fps() == 30
+           and p.stream_type() == rs.stream.depth
+           and p.format() == rs.format.z16 )
+vp = dp.as_video_stream_profile()
+expected_size = vp.width() * vp.height() * 2
+
+lendable = 2
+held_frames = []
+frames_received = 0
+bad_size_frames = 0
+
+def frame_cb( frame ):
+    global frames_received, bad_size_frames
+    frames_received += 1
+    if frame.get_data_size() != expected_size:
+        bad_size_frames += 1
+    # Hold on to more frames than may be lent
+    if len( held_frames ) < 2 * lendable:
+        frame.keep()
+        held_frames.append( frame )
+
+
+#####################################################################################################
+test.start( "Zero-copy frames keep streaming while the user holds frames" )
+depth_sensor.set_option( rs.option.zero_copy_frames, lendable )
+test.check_equal( depth_sensor.get_option( rs.option.zero_copy_frames ), lendable )
+
+depth_sensor.open( dp )
+depth_sensor.start( frame_cb )
+time.sleep( 3 )
+depth_sensor.stop()
+depth_sensor.close()
+
+test.check_equal( len( held_frames ), 2 * lendable )
+test.check( frames_received > 2 * lendable + 30 )
+test.check_equal( bad_size_frames, 0 )
+held_frames.clear()
+depth_sensor.set_option( rs.option.zero_copy_frames, 0 )
+test.finish()
+
+
+#####################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,49 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#test:timeout 60
+#test:device D400*
+
+import os
+import pyrealsense2 as rs2
+from rspy import test, log, repo
+
+# Reading ahead must not change what is played: non real time playback of the same file, with and
+# without read-ahead, should give the same frames
+filename = os.path.join( repo.build, 'unit-tests', 'recordings', 'recording_deadlock.bag' )
+log.d( 'file:', filename )
+
+
+def play( read_ahead ):
+    pipeline = rs2.pipeline()
+    config = rs2.config()
+    config.enable_all_streams()
+    config.enable_device_from_file( filename, repeat_playback=False )
+    profile = pipeline.start( config )
+    playback = profile.get_device().as_playback()
+    playback.set_real_time( False )
+    playback.set_read_ahead( read_ahead )
+    frames = set()    # the syncer may put the same frame in more than one frameset
+    success = True
+    while success:
+        success, fs = pipeline.try_wait_for_frames( 1000 )
+        if success:
+            frames.update( ( f.get_profile().stream_type(), f.get_frame_number() ) for f in fs )
+    stats = playback.get_read_ahead_stats()
+    pipeline.stop()
+    return frames, stats
+
+
+#############################################################################################
+test.start( "Playback with read-ahead plays the same frames" )
+
+expected, _ = play( 0 )
+actual, stats = play( 8 )
+log.d( 'stalls', stats.stalls, 'full', stats.full )
+test.check( len( expected ) > 0 )
+test.check_equal_lists( sorted( actual ), sorted( expected ))
+test.check( stats.queued_frames <= 8 )
+
+test.finish()
+#############################################################################################
+test.print_results_and_exit()
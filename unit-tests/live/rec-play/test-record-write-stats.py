@@ -0,0 +1,51 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#test:timeout 60
+#test:device D400*
+
+import os, tempfile, time
+import pyrealsense2 as rs2
+from rspy import test, log
+
+# Chunks of a recording are compressed and written on other threads: what was recorded must all be played back,
+# and no more chunks than allowed may be waiting to be written
+temp_dir = tempfile.mkdtemp()
+filename = os.path.join( temp_dir, 'rec.bag' )
+log.d( 'file:', filename )
+
+#############################################################################################
+test.start( "Recording writes its chunks behind" )
+
+pipeline = rs2.pipeline()
+config = rs2.config()
+config.enable_stream( rs2.stream.depth )
+config.enable_record_to_file( filename )
+profile = pipeline.start( config )
+recorder = profile.get_device().as_recorder()
+time.sleep( 3 )
+stats = recorder.get_write_stats()
+log.d( 'written', stats.chunks_written, 'pending', stats.pending_chunks, 'stalls', stats.stalls, 'stall ms', stats.stall_ms )
+test.check( stats.chunks_written > 0 )
+test.check( stats.pending_chunks <= 8 )
+pipeline.stop()
+del recorder, profile, pipeline    # closes the file
+
+config = rs2.config()
+config.enable_device_from_file( filename, repeat_playback=False )
+pipeline = rs2.pipeline()
+profile = pipeline.start( config )
+profile.get_device().as_playback().set_real_time( False )
+frames = 0
+success = True
+while success:
+    success, fs = pipeline.try_wait_for_frames( 1000 )
+    if success:
+        frames += 1
+pipeline.stop()
+log.d( 'played', frames, 'frames' )
+test.check( frames > 30 )
+
+test.finish()
+#############################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,107 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// A recording of software-device depth frames, played back as fast as the pipeline takes them: a pipeline that is
+// not low-latency holds the playback back for a slow consumer, while a low-latency one replaces the framesets the
+// consumer is too slow for, and counts them as dropped.
+
+namespace {
+
+int const FPS = 30;
+int const FRAMES = 60;
+int const W = 16, H = 16, BPP = 2;
+
+
+std::string record_depth( std::string const & filename )
+{
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10, 10, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    auto depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, FPS, BPP, RS2_FORMAT_Z16, intrinsics } );
+    sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+    {
+        rs2::recorder recorder( filename, dev );
+        sensor.open( depth );
+        sensor.start( []( rs2::frame ) {} );
+        std::vector< uint16_t > pixels( W * H, 1000 );
+        for( int i = 1; i <= FRAMES; ++i )
+            sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * BPP, BPP, i * 1000. / FPS,
+                                     RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth } );
+        sensor.stop();
+        sensor.close();
+    }
+    return filename;
+}
+
+
+struct consumed
+{
+    std::vector< unsigned long long > numbers;
+    unsigned long long dropped = 0;
+};
+
+
+// Waits a while after the first frameset, as if busy with it, then takes the rest as they come
+consumed consume( std::string const & filename, bool low_latency )
+{
+    rs2::config cfg;
+    cfg.enable_device_from_file( filename, false );
+    if( low_latency )
+        cfg.enable_low_latency();
+    rs2::pipeline pipe;
+    // The frames were recorded in a burst: playing them in real time would deliver them all at once, before the
+    // pipeline started waiting for the consumer
+    rs2::playback( cfg.resolve( pipe ).get_device() ).set_real_time( false );
+    pipe.start( cfg );
+
+    consumed result;
+    rs2::frameset fs;
+    while( pipe.try_wait_for_frames( &fs, 1000 ) )
+    {
+        if( result.numbers.empty() )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+        result.numbers.push_back( fs.get_depth_frame().get_frame_number() );
+    }
+    result.dropped = pipe.get_dropped_framesets();
+    pipe.stop();
+    return result;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "low-latency pipeline drops the framesets of a slow consumer", "[pipeline]" )
+{
+    auto const filename = record_depth( "test-low-latency.bag" );
+
+    SECTION( "not low-latency: the playback waits for the consumer" )
+    {
+        auto result = consume( filename, false );
+        CHECK( result.dropped == 0 );
+        REQUIRE( result.numbers.size() == FRAMES );
+        for( size_t i = 0; i < result.numbers.size(); ++i )
+            CHECK( result.numbers[i] == i + 1 );
+    }
+
+    SECTION( "low-latency: newer framesets replace the ones not taken" )
+    {
+        auto result = consume( filename, true );
+        REQUIRE( ! result.numbers.empty() );
+        CHECK( result.dropped > 0 );
+        CHECK( result.numbers.size() + result.dropped == FRAMES );
+        for( size_t i = 1; i < result.numbers.size(); ++i )
+            CHECK( result.numbers[i] > result.numbers[i - 1] );
+        CHECK( result.numbers.back() == FRAMES );
+    }
+
+    std::remove( filename.c_str() );
+}
@@ -0,0 +1,222 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/context.h>
+#include <src/media/ros/ros_reader_factory.h>
+#include <src/media/playback/playback_read_ahead.h>
+
+#include <functional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+using namespace librealsense::device_serializer;
+
+// Plays through a read-ahead stage the way playback_device does, and with read-ahead on and off compares what is
+// played: the frames, in order. After a frame is played, the streams or the position are changed, as playback_device
+// changes them, on the reader while the read-ahead is stopped.
+
+namespace {
+
+std::string const bag = std::string( __FILE__ ).substr( 0, std::string( __FILE__ ).find_last_of( "/\\" ) + 1 )
+                      + "../resources/single_depth_color_640x480.bag";
+
+stream_identifier const depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+stream_identifier const color{ 0, 1, RS2_STREAM_COLOR, 0 };
+
+typedef std::function< std::shared_ptr< reader >() > reader_factory;
+typedef std::function< void( reader &, playback_read_ahead & ) > action;
+
+
+// Reads frames without data, several to a timestamp, the way ros_reader reads a recording: seeking is limited to the
+// duration, which ends before the last timestamp, and enabling a stream starts over from the next timestamp to read
+// (or from the beginning, at the end)
+class scripted_reader : public reader
+{
+    struct item
+    {
+        nanoseconds time;
+        stream_identifier stream;
+    };
+    std::vector< item > _items;
+    std::set< stream_identifier > _enabled;
+    size_t _next = 0;
+    std::string _name = "scripted";
+
+public:
+    scripted_reader()
+    {
+        for( int t = 1; t <= 4; ++t )
+        {
+            _items.push_back( { nanoseconds( 100 * t ), depth } );
+            _items.push_back( { nanoseconds( 100 * t ), color } );
+        }
+    }
+
+    device_snapshot query_device_description( const nanoseconds & ) override { return {}; }
+
+    std::shared_ptr< serialized_data > read_next_data() override
+    {
+        while( _next < _items.size() && ! _enabled.count( _items[_next].stream ) )
+            ++_next;
+        if( _next == _items.size() )
+            return std::make_shared< serialized_end_of_file >();
+        auto & next = _items[_next++];
+        return std::make_shared< serialized_frame >( next.time, next.stream, nullptr );
+    }
+
+    void seek_to_time( const nanoseconds & time ) override
+    {
+        if( time > query_duration() )
+            throw invalid_value_exception( "out of playback length" );
+        _next = 0;
+        while( _next < _items.size() && _items[_next].time < time )
+            ++_next;
+    }
+
+    nanoseconds query_duration() const override { return _items.back().time - _items.front().time; }
+    void reset() override { _next = 0; }
+
+    void enable_stream( const std::vector< stream_identifier > & streams ) override
+    {
+        auto next = _next;
+        while( next < _items.size() && ! _enabled.count( _items[next].stream ) )
+            ++next;
+        _enabled.insert( streams.begin(), streams.end() );
+        if( next == _items.size() )
+            next = 0;
+        else
+            while( next > 0 && _items[next - 1].time == _items[next].time )
+                --next;
+        _next = next;
+    }
+
+    void disable_stream( const std::vector< stream_identifier > & streams ) override
+    {
+        for( auto & stream : streams )
+            _enabled.erase( stream );
+    }
+
+    const std::string & get_file_name() const override { return _name; }
+    std::vector< std::shared_ptr< serialized_data > > fetch_last_frames( const nanoseconds & ) override { return {}; }
+};
+
+
+std::vector< std::string > play( reader_factory const & make_reader, size_t read_ahead_frames,
+                                 std::vector< stream_identifier > const & streams, size_t after_frames,
+                                 action const & act )
+{
+    auto reader = make_reader();
+    playback_read_ahead read_ahead( reader );
+    read_ahead.configure( read_ahead_frames, 0 );
+    reader->enable_stream( streams );
+
+    std::vector< std::string > played;
+    for( ;; )
+    {
+        auto data = read_ahead.read_next_data();
+        if( data->is< serialized_end_of_file >() )
+            break;
+        auto frame = data->as< serialized_frame >();
+        if( ! frame )
+            continue;
+        std::ostringstream name;
+        name << rs2_stream_to_string( frame->stream_id.stream_type ) << " @" << frame->get_timestamp().count();
+        if( frame->frame )
+            name << " #" << frame->frame->get_frame_number();
+        played.push_back( name.str() );
+        if( played.size() == after_frames && act )
+        {
+            // Let something be read ahead, for it to be dropped
+            for( int i = 0; read_ahead_frames && ! read_ahead.get_stats().queued_frames && i < 100; ++i )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            act( *reader, read_ahead );
+        }
+    }
+    read_ahead.stop( false );
+    return played;
+}
+
+
+void compare( reader_factory const & make_reader, std::vector< stream_identifier > const & streams,
+              size_t after_frames, action const & act )
+{
+    auto const expected = play( make_reader, 0, streams, after_frames, act );
+    REQUIRE( ! expected.empty() );
+    for( size_t frames : { 1, 2, 16 } )
+    {
+        CAPTURE( frames );
+        CHECK( play( make_reader, frames, streams, after_frames, act ) == expected );
+    }
+}
+
+
+void seek_to_start( reader & r, playback_read_ahead & read_ahead )
+{
+    read_ahead.stop( false );
+    r.seek_to_time( nanoseconds( 0 ) );
+}
+
+void enable_color( reader & r, playback_read_ahead & read_ahead )
+{
+    read_ahead.stop( true );
+    r.enable_stream( { color } );
+}
+
+void disable_color( reader & r, playback_read_ahead & read_ahead )
+{
+    read_ahead.stop( true );
+    r.disable_stream( { color } );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "read-ahead plays the same frames of a recording", "[playback][read-ahead]" )
+{
+    reader_factory make_reader = []() {
+        return make_ros_reader( bag, std::make_shared< context >( backend_type::standard ) );
+    };
+
+    SECTION( "to the end" )
+    {
+        compare( make_reader, { depth, color }, 0, nullptr );
+    }
+    SECTION( "after seeking back" )
+    {
+        compare( make_reader, { depth, color }, 1, seek_to_start );
+    }
+    SECTION( "after enabling a stream" )
+    {
+        compare( make_reader, { depth }, 1, enable_color );
+    }
+    SECTION( "after disabling a stream" )
+    {
+        compare( make_reader, { depth, color }, 1, disable_color );
+        compare( make_reader, { depth, color }, 2, disable_color );
+    }
+}
+
+
+TEST_CASE( "read-ahead does not play again what shares a timestamp with what it drops", "[playback][read-ahead]" )
+{
+    reader_factory make_reader = []() {
+        return std::make_shared< scripted_reader >();
+    };
+
+    // Each depth frame shares its timestamp with a color one, and the last timestamp is past the duration
+    for( size_t after_frames = 1; after_frames <= 7; ++after_frames )
+    {
+        CAPTURE( after_frames );
+        compare( make_reader, { depth, color }, after_frames, seek_to_start );
+        compare( make_reader, { depth }, ( after_frames + 1 ) / 2, enable_color );
+        compare( make_reader, { depth, color }, after_frames, disable_color );
+    }
+}
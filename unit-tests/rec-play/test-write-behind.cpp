@@ -0,0 +1,187 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/context.h>
+#include <src/environment.h>
+#include <src/media/ros/ros_reader_factory.h>
+#include <src/media/ros/ros_writer_factory.h>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace librealsense;
+using namespace librealsense::device_serializer;
+
+// Records the frames of single_depth_color_640x480.bag again, several times over so the recording has many chunks,
+// with chunks written behind and as they are filled, and with each compression, and reads the recordings back.
+
+namespace {
+
+std::string const bag = std::string( __FILE__ ).substr( 0, std::string( __FILE__ ).find_last_of( "/\\" ) + 1 )
+                      + "../resources/single_depth_color_640x480.bag";
+
+stream_identifier const depth{ 0, 0, RS2_STREAM_DEPTH, 0 };
+stream_identifier const color{ 0, 1, RS2_STREAM_COLOR, 0 };
+
+int const LOOPS = 10;
+uint32_t const PENDING_CHUNKS = 8;  // as recordings are written
+nanoseconds const LOOP_DURATION = std::chrono::milliseconds( 200 );
+
+
+std::shared_ptr< context > make_context()
+{
+    return std::make_shared< context >( backend_type::standard );
+}
+
+
+// What a frame is made of, its data included
+std::string describe( serialized_frame const & frame, nanoseconds timestamp )
+{
+    auto const data = reinterpret_cast< const char * >( frame.frame->get_frame_data() );
+    std::ostringstream os;
+    os << rs2_stream_to_string( frame.stream_id.stream_type ) << " #" << frame.frame->get_frame_number() << " @"
+       << timestamp.count() << " "
+       << std::hash< std::string >()( std::string( data, data + frame.frame->get_frame_data_size() ) );
+    return os.str();
+}
+
+
+// Returns what was recorded
+std::vector< std::string > record( std::string const & filename, rs2_record_compression compression, int level,
+                                   uint32_t pending_chunks, int loops = LOOPS )
+{
+    auto ctx = make_context();
+    auto reader = make_ros_reader( bag, ctx );
+    auto writer = make_ros_writer( filename, compression, level, pending_chunks );
+    // Frames are recorded with the sensor and the profile they come from, which a playback of the same file has
+    auto device = std::make_shared< playback_device >( ctx, make_ros_reader( bag, ctx ) );
+    writer->write_device_description( reader->query_device_description( nanoseconds( 0 ) ) );
+    reader->enable_stream( { depth, color } );
+
+    std::vector< std::string > recorded;
+    for( int loop = 0; loop < loops; ++loop )
+    {
+        reader->seek_to_time( nanoseconds( 0 ) );
+        for( auto data = reader->read_next_data(); ! data->is< serialized_end_of_file >(); data = reader->read_next_data() )
+        {
+            auto frame = data->as< serialized_frame >();
+            if( ! frame )
+                continue;
+            auto & sensor = dynamic_cast< playback_sensor & >( device->get_sensor( frame->stream_id.sensor_index ) );
+            frame->frame->set_sensor( sensor.shared_from_this() );
+            for( auto & profile : sensor.get_stream_profiles() )
+                if( profile->get_stream_type() == frame->stream_id.stream_type
+                    && profile->get_stream_index() == int( frame->stream_id.stream_index ) )
+                    frame->frame->set_stream( profile );
+            auto const timestamp = frame->get_timestamp() + loop * LOOP_DURATION;
+            recorded.push_back( describe( *frame, timestamp ) );
+            writer->write_frame( frame->stream_id, timestamp, std::move( frame->frame ) );
+        }
+    }
+    return recorded;
+}
+
+
+std::vector< std::string > play( std::string const & filename )
+{
+    auto reader = make_ros_reader( filename, make_context() );
+    reader->enable_stream( { depth, color } );
+
+    std::vector< std::string > played;
+    for( auto data = reader->read_next_data(); ! data->is< serialized_end_of_file >(); data = reader->read_next_data() )
+        if( auto frame = data->as< serialized_frame >() )
+            played.push_back( describe( *frame, frame->get_timestamp() ) );
+    return played;
+}
+
+
+std::string read_file( std::string const & filename )
+{
+    std::ifstream file( filename, std::ios::binary );
+    std::ostringstream os;
+    os << file.rdbuf();
+    return os.str();
+}
+
+
+void use_threads()
+{
+    // Several chunks are then compressed at once, even on a single CPU
+    auto pool = environment::get_instance().get_task_pool();
+    auto settings = pool->get_settings();
+    settings.size = 7;
+    REQUIRE( pool->configure( settings ) );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "recordings written behind are those written as chunks are filled", "[record][write-behind]" )
+{
+    use_threads();
+
+    for( auto compression : { RS2_RECORD_COMPRESSION_NONE, RS2_RECORD_COMPRESSION_LZ4 } )
+    {
+        CAPTURE( compression );
+        std::string const filename = "test-write-behind.bag";
+        std::string const filename_sync = "test-write-behind-sync.bag";
+
+        auto const recorded = record( filename_sync, compression, 0, 0 );
+        REQUIRE( recorded.size() == 3 * LOOPS );
+        auto const written = read_file( filename_sync );
+        CHECK( play( filename_sync ) == recorded );
+
+        for( uint32_t pending_chunks : { uint32_t( 1 ), PENDING_CHUNKS } )
+        {
+            CAPTURE( pending_chunks );
+            CHECK( record( filename, compression, 0, pending_chunks ) == recorded );
+            // Chunks are compressed in any order, but must end up where they would have been written
+            auto const written_behind = read_file( filename );
+            CHECK( written_behind.size() == written.size() );
+            CHECK( ( written_behind == written ) );
+            CHECK( play( filename ) == recorded );
+        }
+
+        std::remove( filename.c_str() );
+        std::remove( filename_sync.c_str() );
+    }
+}
+
+
+TEST_CASE( "LZ4-HC and Zstandard recordings read back", "[record][compression]" )
+{
+    use_threads();
+    std::string const filename = "test-compression.bag";
+
+    for( int level : { 0, 1, 12 } )
+    {
+        CAPTURE( level );
+        auto const recorded = record( filename, RS2_RECORD_COMPRESSION_LZ4_HC, level, PENDING_CHUNKS, 2 );
+        CHECK( play( filename ) == recorded );
+    }
+    CHECK_THROWS_AS( make_ros_writer( filename, RS2_RECORD_COMPRESSION_LZ4_HC, -1, 0 ), invalid_value_exception );
+    CHECK_THROWS_AS( make_ros_writer( filename, RS2_RECORD_COMPRESSION_LZ4_HC, 13, 0 ), invalid_value_exception );
+
+#ifdef RS2_USE_ZSTD
+    for( int level : { 0, 1, 22 } )
+    {
+        CAPTURE( level );
+        auto const recorded = record( filename, RS2_RECORD_COMPRESSION_ZSTD, level, PENDING_CHUNKS, 2 );
+        CHECK( play( filename ) == recorded );
+    }
+    CHECK_THROWS_AS( make_ros_writer( filename, RS2_RECORD_COMPRESSION_ZSTD, -1, 0 ), invalid_value_exception );
+    CHECK_THROWS_AS( make_ros_writer( filename, RS2_RECORD_COMPRESSION_ZSTD, 23, 0 ), invalid_value_exception );
+#else
+    CHECK_THROWS_AS( make_ros_writer( filename, RS2_RECORD_COMPRESSION_ZSTD, 0, 0 ), not_implemented_exception );
+#endif
+
+    std::remove( filename.c_str() );
+}
@@ -0,0 +1,199 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <rsutils/time/timer.h>
+#include <rsutils/time/stopwatch.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace rsutils::time;
+
+TEST_CASE( "ring: enqueue drops the oldest item when full" )
+{
+    std::vector< int > dropped;
+    single_consumer_ring_queue< int > q( 3, [&]( int const & i ) { dropped.push_back( i ); } );
+
+    for( int i = 0; i < 5; ++i )
+        REQUIRE( q.enqueue( std::move( i ) ) );
+    REQUIRE( q.size() == 3 );
+    REQUIRE( dropped == std::vector< int >{ 0, 1 } );
+
+    int val;
+    REQUIRE( q.try_dequeue( &val ) );
+    REQUIRE( val == 2 );
+    REQUIRE( q.peek( [&]( int const & i ) { val = i; } ) );
+    REQUIRE( val == 3 );
+    REQUIRE( q.size() == 2 );
+}
+
+TEST_CASE( "ring: holds move-only items without a default constructor" )
+{
+    typedef std::unique_ptr< int, void ( * )( int * ) > item_t;
+    static int deleted = 0;
+    auto deleter = []( int * p ) { ++deleted; delete p; };
+
+    {
+        single_consumer_ring_queue< item_t > q( 2 );
+        for( int i = 0; i < 4; ++i )
+            q.enqueue( item_t( new int( i ), deleter ) );
+        REQUIRE( deleted == 2 );
+
+        item_t item( nullptr, deleter );
+        REQUIRE( q.dequeue( &item, 100 ) );
+        REQUIRE( *item == 2 );
+    }
+    // The dequeued item, and the one left in the queue, are released when going out of scope
+    REQUIRE( deleted == 4 );
+}
+
+TEST_CASE( "ring: dequeue doesn't wait after stop" )
+{
+    single_consumer_ring_queue< int > q;
+    q.enqueue( 1 );
+    q.stop();
+
+    REQUIRE( q.stopped() );
+    REQUIRE( q.empty() );
+    REQUIRE_FALSE( q.enqueue( 2 ) );
+
+    timer t( std::chrono::seconds( 1 ) );
+    t.start();
+    int val;
+    REQUIRE_FALSE( q.dequeue( &val, 2000 ) );
+    REQUIRE_FALSE( t.has_expired() );
+
+    q.start();
+    REQUIRE( q.enqueue( 3 ) );
+    REQUIRE( q.dequeue( &val, 0 ) );
+    REQUIRE( val == 3 );
+}
+
+TEST_CASE( "ring: dequeue wait when queue is empty" )
+{
+    single_consumer_ring_queue< int > q;
+    timer t( std::chrono::milliseconds( 900 ) );
+
+    int val;
+    t.start();
+    REQUIRE_FALSE( q.dequeue( &val, 1000 ) );
+    REQUIRE( t.has_expired() );
+}
+
+TEST_CASE( "ring: blocking enqueue" )
+{
+    single_consumer_ring_queue< int > q;
+    stopwatch sw;
+
+    int val;
+    std::thread dequeue_thread( [&]() {
+        std::this_thread::sleep_for( std::chrono::seconds( 2 ) );
+        q.dequeue( &val, 1000 );
+    } );
+
+    for( int i = 0; i < 10; ++i )
+        q.blocking_enqueue( std::move( i ) );
+    REQUIRE( sw.get_elapsed_ms() < 1000 );
+    REQUIRE( q.size() == 10 );  // verify queue is full (default capacity is 10)
+    q.blocking_enqueue( 10 );   // waits for the dequeue
+    REQUIRE( sw.get_elapsed_ms() > 2000 );
+    REQUIRE( sw.get_elapsed_ms() < 3000 );
+    REQUIRE( val == 0 );
+
+    dequeue_thread.join();
+}
+
+TEST_CASE( "ring: multiple producers lose nothing with blocking enqueue" )
+{
+    single_consumer_ring_queue< int > q( 4 );
+
+    const int PRODUCERS = 4;
+    const int ITEMS_PER_PRODUCER = 10000;
+    std::vector< std::thread > producers;
+    for( int p = 0; p < PRODUCERS; ++p )
+        producers.emplace_back( [&, p]() {
+            for( int i = 0; i < ITEMS_PER_PRODUCER; ++i )
+                q.blocking_enqueue( p * ITEMS_PER_PRODUCER + i );
+        } );
+
+    std::vector< int > all_values;
+    std::vector< int > last_per_producer( PRODUCERS, -1 );
+    bool in_order = true;
+    while( all_values.size() < PRODUCERS * ITEMS_PER_PRODUCER )
+    {
+        int val;
+        if( ! q.dequeue( &val, 1000 ) )
+            break;
+        // Items of each producer must arrive in the order they were enqueued
+        int & last = last_per_producer[val / ITEMS_PER_PRODUCER];
+        in_order = in_order && val > last;
+        last = val;
+        all_values.push_back( val );
+    }
+    for( auto & t : producers )
+        t.join();
+
+    REQUIRE( in_order );
+    REQUIRE( all_values.size() == PRODUCERS * ITEMS_PER_PRODUCER );
+    std::sort( all_values.begin(), all_values.end() );
+    for( int i = 0; i < (int)all_values.size(); ++i )
+        REQUIRE( all_values[i] == i );
+}
+
+TEST_CASE( "ring: multiple blocking producers never exceed the capacity" )
+{
+    single_consumer_ring_queue< int > q( 3 );
+
+    const int PRODUCERS = 8;
+    const int ITEMS_PER_PRODUCER = 5000;
+    std::vector< std::thread > producers;
+    for( int p = 0; p < PRODUCERS; ++p )
+        producers.emplace_back( [&]() {
+            for( int i = 0; i < ITEMS_PER_PRODUCER; ++i )
+                q.blocking_enqueue( std::move( i ) );
+        } );
+
+    size_t max_size = 0;
+    int received = 0;
+    int val;
+    while( received < PRODUCERS * ITEMS_PER_PRODUCER && q.dequeue( &val, 1000 ) )
+    {
+        max_size = std::max( max_size, q.size() );
+        ++received;
+    }
+    for( auto & t : producers )
+        t.join();
+
+    REQUIRE( received == PRODUCERS * ITEMS_PER_PRODUCER );
+    REQUIRE( max_size <= q.capacity() );
+}
+
+TEST_CASE( "ring: multiple producers with drops account for every item" )
+{
+    std::atomic< int > dropped( 0 );
+    single_consumer_ring_queue< int > q( 2, [&]( int const & ) { ++dropped; } );
+
+    const int PRODUCERS = 4;
+    const int ITEMS_PER_PRODUCER = 10000;
+    std::atomic< int > done( 0 );
+    std::vector< std::thread > producers;
+    for( int p = 0; p < PRODUCERS; ++p )
+        producers.emplace_back( [&]() {
+            for( int i = 0; i < ITEMS_PER_PRODUCER; ++i )
+                q.enqueue( std::move( i ) );
+            ++done;
+        } );
+
+    int received = 0;
+    int val;
+    while( done < PRODUCERS || ! q.empty() )
+        if( q.dequeue( &val, 10 ) )
+            ++received;
+    for( auto & t : producers )
+        t.join();
+
+    REQUIRE( received + dropped == PRODUCERS * ITEMS_PER_PRODUCER );
+}
@@ -0,0 +1,91 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/task-pool.h>
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+TEST_CASE( "task pool: submitted tasks all run" )
+{
+    std::atomic< int > ran( 0 );
+    {
+        task_pool pool( 3 );
+        for( int i = 0; i < 1000; ++i )
+            pool.submit( [&]() { ++ran; } );
+    }
+    // The pool runs whatever was submitted before its threads stop
+    REQUIRE( ran == 1000 );
+
+    task_pool none( 0 );
+    none.submit( [&]() { ++ran; } );
+    REQUIRE( ran == 1001 );
+}
+
+TEST_CASE( "task pool: concurrent parallel_for calls share the threads" )
+{
+    auto pool = std::make_shared< task_pool >( 4 );
+    std::vector< std::thread > clients;
+    std::atomic< int > failures( 0 );
+    for( int c = 0; c < 8; ++c )
+    {
+        clients.emplace_back( [&, c]() {
+            worker_pool workers( 3, pool );
+            for( int i = 0; i < 200; ++i )
+            {
+                size_t const count = 50 + c * 10 + i;
+                std::vector< std::atomic< int > > hits( count );
+                for( auto & h : hits )
+                    h = 0;
+                workers.parallel_for( count, [&]( size_t begin, size_t end ) {
+                    for( size_t j = begin; j < end; ++j )
+                        ++hits[j];
+                } );
+                for( auto & h : hits )
+                    if( h != 1 )
+                        ++failures;
+            }
+        } );
+    }
+    for( auto & t : clients )
+        t.join();
+    REQUIRE( failures == 0 );
+}
+
+TEST_CASE( "task pool: nested parallel_for" )
+{
+    task_pool pool( 2 );
+    std::atomic< size_t > total( 0 );
+    pool.parallel_for(
+        16,
+        [&]( size_t begin, size_t end ) {
+            for( size_t i = begin; i < end; ++i )
+                pool.parallel_for( 100, [&]( size_t b, size_t e ) { total += e - b; }, 3 );
+        },
+        3 );
+    REQUIRE( total == 1600 );
+}
+
+TEST_CASE( "task pool: configure" )
+{
+    task_pool pool( 1 );
+    task_pool::settings s;
+    s.size = 3;
+    pool.configure( s );
+    REQUIRE( pool.size() == 3 );
+    REQUIRE( pool.get_settings().size == 3 );
+
+#ifdef __linux__
+    // Every thread may run on CPU 0
+    s.cpus = { 0 };
+    REQUIRE( pool.configure( s ) );
+#endif
+
+    std::atomic< size_t > total( 0 );
+    pool.parallel_for( 1000, [&]( size_t begin, size_t end ) { total += end - begin; }, 4 );
+    REQUIRE( total == 1000 );
+}
@@ -0,0 +1,98 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+TEST_CASE( "worker pool: bands cover the whole range exactly once" )
+{
+    for( size_t size : { 1, 2, 3, 8 } )
+    {
+        worker_pool pool( size );
+        REQUIRE( pool.size() == size );
+
+        for( size_t count : { 1, 7, 100, 1000 } )
+        {
+            std::vector< std::atomic< int > > hits( count );
+            for( auto & h : hits )
+                h = 0;
+            pool.parallel_for( count, [&]( size_t begin, size_t end ) {
+                REQUIRE( begin < end );
+                for( size_t i = begin; i < end; ++i )
+                    ++hits[i];
+            } );
+            for( size_t i = 0; i < count; ++i )
+                REQUIRE( hits[i] == 1 );
+        }
+    }
+}
+
+TEST_CASE( "worker pool: bands are no smaller than requested" )
+{
+    worker_pool pool( 4 );
+    std::atomic< size_t > smallest( 1000 );
+    std::atomic< int > bands( 0 );
+    pool.parallel_for(
+        100,
+        [&]( size_t begin, size_t end ) {
+            ++bands;
+            if( end != 100 && end - begin < smallest )
+                smallest = end - begin;
+        },
+        30 );
+    REQUIRE( smallest >= 30 );
+    REQUIRE( bands == 4 );
+}
+
+TEST_CASE( "worker pool: single thread runs on the caller" )
+{
+    worker_pool pool( 1 );
+    auto const caller = std::this_thread::get_id();
+    int calls = 0;
+    pool.parallel_for( 1000, [&]( size_t begin, size_t end ) {
+        REQUIRE( std::this_thread::get_id() == caller );
+        REQUIRE( begin == 0 );
+        REQUIRE( end == 1000 );
+        ++calls;
+    } );
+    REQUIRE( calls == 1 );
+}
+
+TEST_CASE( "worker pool: resize" )
+{
+    worker_pool pool( 2 );
+    pool.resize( 6 );
+    REQUIRE( pool.size() == 6 );
+    pool.resize( 0 );
+    REQUIRE( pool.size() == 1 );
+
+    std::atomic< size_t > total( 0 );
+    pool.resize( 3 );
+    for( int i = 0; i < 100; ++i )
+        pool.parallel_for( 64, [&]( size_t begin, size_t end ) { total += end - begin; } );
+    REQUIRE( total == 6400 );
+}
+
+TEST_CASE( "worker pool: exceptions reach the caller after all bands are done" )
+{
+    worker_pool pool( 4 );
+    std::atomic< size_t > done( 0 );
+    REQUIRE_THROWS_AS( pool.parallel_for( 100,
+                                          [&]( size_t begin, size_t end ) {
+                                              done += end - begin;
+                                              if( begin == 0 )
+                                                  throw std::runtime_error( "band failed" );
+                                          } ),
+                       std::runtime_error );
+    REQUIRE( done == 100 );
+
+    // The pool is still usable
+    done = 0;
+    pool.parallel_for( 100, [&]( size_t begin, size_t end ) { done += end - begin; } );
+    REQUIRE( done == 100 );
+}
@@ -0,0 +1,125 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+
+
+# Two software devices, each with a depth stream, synced by the global timestamps of their frames
+fps = 60
+gap = 1000 / fps
+w = 640
+h = 480
+bpp = 2
+pixels = bytearray( b'\x00' * ( w * h * bpp ))
+
+syncer = rs.multi_device_syncer( 100 )
+devices = []
+sensors = []
+profiles = []
+for i in range( 2 ):
+    device = rs.software_device()
+    device.create_matcher( rs.matchers.default )
+    sensor = device.add_sensor( "Depth" )
+    stream = rs.video_stream()
+    stream.type = rs.stream.depth
+    stream.uid = 10 + i
+    stream.width = w
+    stream.height = h
+    stream.bpp = bpp
+    stream.fmt = rs.format.z16
+    stream.fps = fps
+    profile = rs.video_stream_profile( sensor.add_video_stream( stream ))
+    sensor.open( profile )
+    sensor.start( syncer )
+    devices.append( device )
+    sensors.append( sensor )
+    profiles.append( profile )
+
+
+def generate( device, frame_number, timestamp ):
+    frame = rs.software_video_frame()
+    frame.pixels = pixels
+    frame.stride = w * bpp
+    frame.bpp = bpp
+    frame.frame_number = frame_number
+    frame.timestamp = timestamp
+    frame.domain = rs.timestamp_domain.global_time
+    frame.profile = profiles[device]
+    log.d( "-->", device, frame )
+    sensors[device].on_video_frame( frame )
+
+
+def expect( *frames ):
+    """
+    Expects the next frameset to hold exactly the given (device, frame-number) frames
+    """
+    fs = syncer.poll_for_frames()
+    test.check( fs )
+    if not fs:
+        return
+    log.d( "Got", fs )
+    actual = sorted( ( f.get_profile().unique_id() - 10, f.get_frame_number() ) for f in fs )
+    test.check_equal_lists( actual, sorted( frames ))
+
+
+def expect_nothing():
+    fs = syncer.poll_for_frames()
+    test.info( "Expected nothing; actual", fs )
+    test.check( not fs )
+
+
+#############################################################################################
+#
+test.start( "Each device's first frame is released on its own" )
+
+generate( 0, 0, 0 )
+expect( (0, 0) )
+generate( 1, 0, 1 )
+expect( (1, 0) )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Frames within half a frame of each other are matched" )
+
+generate( 0, 1, gap )
+expect_nothing()                   # device 1 is expected at 1+gap
+generate( 1, 1, gap + 1 )
+expect( (0, 1), (1, 1) )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "With a tolerance of 0.5 ms, the same frames are not matched" )
+
+syncer.get_options().set_option( rs.option.sync_tolerance, 0.5 )
+generate( 0, 2, gap * 2 )
+expect( (0, 2) )
+generate( 1, 2, gap * 2 + 1 )
+expect( (1, 2) )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Statistics" )
+
+options = syncer.get_options()
+test.check_equal( options.get_option( rs.option.sync_framesets ), 5 )
+# The first frame of device 1, and both of the last ones, were released without the other device
+test.check_equal( options.get_option( rs.option.sync_incomplete_framesets ), 3 )
+test.check( options.get_option( rs.option.sync_latency ) >= 0 )
+
+test.finish()
+#
+#############################################################################################
+for sensor in sensors:
+    sensor.stop()
+    sensor.close()
+test.print_results_and_exit()
@@ -0,0 +1,161 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <rsutils/time/stopwatch.h>
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace rsutils::time;
+
+// Feeds the syncer of a software device with tiny frames as fast as it takes them: depth and two IRs with the same
+// frame number, color, and gyro and accel in between, all on synthetic timestamps. The syncer is drained as it goes,
+// so what is measured is the syncer itself.
+
+namespace {
+
+int const FPS = 50;
+int const GYRO_PER_FRAME = 4;   // 200 fps
+int const ACCEL_PER_FRAME = 2;  // 100 fps
+int const W = 4, H = 4, BPP = 2;
+
+struct stream_counts
+{
+    int delivered = 0;
+    unsigned long long last = 0;
+    bool in_order = true;
+};
+
+
+void sync_rate( rs2_matchers matcher, bool motion, int frames )
+{
+    rs2::software_device dev;
+    dev.create_matcher( matcher );
+
+    rs2_intrinsics intrinsics{ W, H, 0, 0, 1, 1, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    auto stereo = dev.add_sensor( "Stereo" );
+    auto depth = stereo.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, FPS, BPP, RS2_FORMAT_Z16, intrinsics } );
+    auto ir1 = stereo.add_video_stream( { RS2_STREAM_INFRARED, 1, 1, W, H, FPS, 1, RS2_FORMAT_Y8, intrinsics } );
+    auto ir2 = stereo.add_video_stream( { RS2_STREAM_INFRARED, 2, 2, W, H, FPS, 1, RS2_FORMAT_Y8, intrinsics } );
+    auto rgb = dev.add_sensor( "RGB" );
+    auto color = rgb.add_video_stream( { RS2_STREAM_COLOR, 0, 3, W, H, FPS, BPP, RS2_FORMAT_YUYV, intrinsics } );
+
+    auto imu = dev.add_sensor( "Motion" );
+    rs2_motion_device_intrinsic imu_intrinsics{};
+    rs2::stream_profile gyro, accel;
+    if( motion )
+    {
+        gyro = imu.add_motion_stream(
+            { RS2_STREAM_GYRO, 0, 4, FPS * GYRO_PER_FRAME, RS2_FORMAT_MOTION_XYZ32F, imu_intrinsics } );
+        accel = imu.add_motion_stream(
+            { RS2_STREAM_ACCEL, 0, 5, FPS * ACCEL_PER_FRAME, RS2_FORMAT_MOTION_XYZ32F, imu_intrinsics } );
+    }
+
+    rs2::syncer sync( 100 );
+    stereo.open( { depth, ir1, ir2 } );
+    stereo.start( sync );
+    rgb.open( color );
+    rgb.start( sync );
+    if( motion )
+    {
+        imu.open( { gyro, accel } );
+        imu.start( sync );
+    }
+
+    std::vector< uint8_t > pixels( W * H * BPP, 0 );
+    float xyz[3] = { 0, 0, 0 };
+    std::map< int, stream_counts > counts;  // by stream unique ID
+    int framesets = 0, fed = 0;
+    bool consistent = true;
+
+    auto drain = [&]() {
+        rs2::frameset fs;
+        while( sync.poll_for_frames( &fs ) )
+        {
+            ++framesets;
+            std::map< int, unsigned long long > numbers;
+            for( auto && f : fs )
+            {
+                auto uid = f.get_profile().unique_id();
+                auto & c = counts[uid];
+                if( c.delivered && f.get_frame_number() <= c.last )
+                    c.in_order = false;
+                c.last = f.get_frame_number();
+                ++c.delivered;
+                numbers[uid] = f.get_frame_number();
+            }
+            // Depth and the IRs are matched by frame number, when the matcher does so; the first depth frame comes
+            // before the syncer knows of the IRs, and is released on its own
+            if( matcher == RS2_MATCHER_DLR_C && numbers.count( 0 ) )
+                for( int ir : { 1, 2 } )
+                    if( numbers.count( ir ) && numbers[ir] != numbers[0] )
+                        consistent = false;
+        }
+    };
+
+    stopwatch sw;
+    for( int n = 1; n <= frames; ++n )
+    {
+        double const t = n * 1000. / FPS;
+        stereo.on_video_frame( { pixels.data(), []( void * ) {}, W * BPP, BPP, t, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth } );
+        stereo.on_video_frame( { pixels.data(), []( void * ) {}, W, 1, t, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, ir1 } );
+        stereo.on_video_frame( { pixels.data(), []( void * ) {}, W, 1, t, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, ir2 } );
+        rgb.on_video_frame( { pixels.data(), []( void * ) {}, W * BPP, BPP, t, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, color } );
+        fed += 4;
+        if( motion )
+        {
+            for( int g = 0; g < GYRO_PER_FRAME; ++g )
+                imu.on_motion_frame( { xyz, []( void * ) {}, t + g * 1000. / ( FPS * GYRO_PER_FRAME ),
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, ( n - 1 ) * GYRO_PER_FRAME + g + 1, gyro } );
+            for( int a = 0; a < ACCEL_PER_FRAME; ++a )
+                imu.on_motion_frame( { xyz, []( void * ) {}, t + a * 1000. / ( FPS * ACCEL_PER_FRAME ),
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, ( n - 1 ) * ACCEL_PER_FRAME + a + 1, accel } );
+            fed += GYRO_PER_FRAME + ACCEL_PER_FRAME;
+        }
+        drain();
+    }
+    auto const ms = sw.get_elapsed_ms();
+
+    std::cout << rs2_matchers_to_string( matcher ) << ( motion ? " + IMU" : "" ) << ": " << fed << " frames in "
+              << ms << " ms = " << int( fed / ms * 1000 ) << " frames/s, " << framesets << " framesets" << std::endl;
+
+    if( motion )
+    {
+        imu.stop();
+        imu.close();
+    }
+    rgb.stop();
+    rgb.close();
+    stereo.stop();
+    stereo.close();
+
+    CHECK( consistent );
+    int delivered = 0;
+    for( auto & uc : counts )
+    {
+        CAPTURE( uc.first );
+        CHECK( uc.second.in_order );
+        delivered += uc.second.delivered;
+    }
+    // Only the last few frames may still be waiting for their match
+    CHECK( delivered <= fed );
+    CHECK( delivered >= fed - 2 * int( counts.size() ) );
+}
+
+}  // namespace
+
+
+TEST_CASE( "sync rate: default matcher" )
+{
+    sync_rate( RS2_MATCHER_DEFAULT, false, 20000 );
+    sync_rate( RS2_MATCHER_DEFAULT, true, 20000 );
+}
+
+TEST_CASE( "sync rate: depth + IRs by frame number, with color" )
+{
+    sync_rate( RS2_MATCHER_DLR_C, false, 20000 );
+}
@@ -0,0 +1,90 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "../catch.h"
+
+//#cmake:add-file ../../src/frame-buffer-lender.cpp
+#include <src/frame-buffer-lender.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+
+
+TEST_CASE( "buffers are given back while the stream is open", "[frame-buffer-lender]" )
+{
+    auto lender = std::make_shared< frame_buffer_lender >();
+    std::vector< int > queued;
+
+    lender->open( 2 );
+    auto a = lender->lend( [&]() { queued.push_back( 0 ); } );
+    auto b = lender->lend( [&]() { queued.push_back( 1 ); } );
+    REQUIRE( a );
+    REQUIRE( b );
+    // The stream lends all it may: the next frame is copied
+    CHECK( ! lender->lend( [&]() { queued.push_back( 2 ); } ) );
+    CHECK( lender->lent() == 2 );
+
+    b();
+    CHECK( queued == std::vector< int >{ 1 } );
+    CHECK( lender->lent() == 1 );
+    CHECK( lender->lend( [&]() { queued.push_back( 3 ); } ) );
+
+    // Nothing is lent unless asked for
+    lender->open( 0 );
+    CHECK( ! lender->lend( [&]() { queued.push_back( 4 ); } ) );
+}
+
+TEST_CASE( "a frame held across close and reopen does not give its buffer to the new stream", "[frame-buffer-lender]" )
+{
+    auto lender = std::make_shared< frame_buffer_lender >();
+    std::vector< std::string > queued;
+
+    lender->open( 1 );
+    auto held = lender->lend( [&]() { queued.push_back( "old" ); } );
+    REQUIRE( held );
+
+    lender->close();
+    CHECK( lender->lent() == 0 );
+
+    // The reopened stream may lend all its buffers, regardless of the frame still held
+    lender->open( 1 );
+    auto fresh = lender->lend( [&]() { queued.push_back( "new" ); } );
+    REQUIRE( fresh );
+
+    held();  // the user finally releases the old frame
+    CHECK( queued.empty() );
+    CHECK( lender->lent() == 1 );
+
+    fresh();
+    CHECK( queued == std::vector< std::string >{ "new" } );
+    CHECK( lender->lent() == 0 );
+}
+
+TEST_CASE( "nothing is given back once close returns", "[frame-buffer-lender]" )
+{
+    auto lender = std::make_shared< frame_buffer_lender >();
+    lender->open( 1000 );
+
+    std::atomic< bool > closed( false );
+    std::atomic< int > late( 0 );
+    std::vector< std::function< void() > > frames;
+    for( int i = 0; i < 1000; ++i )
+        frames.push_back( lender->lend( [&]() {
+            if( closed )
+                ++late;
+        } ) );
+
+    std::thread releasing( [&]() {
+        for( auto & frame : frames )
+            frame();
+    } );
+    lender->close();
+    closed = true;
+    releasing.join();
+
+    CHECK( late == 0 );
+}
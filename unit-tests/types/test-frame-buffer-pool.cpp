@@ -0,0 +1,209 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2023 Intel Corporation. All Rights Reserved.
+
+#include "../catch.h"
+
+//#cmake:add-file ../../src/frame-buffer-pool.cpp
+#include <src/frame-buffer-pool.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace librealsense;
+
+typedef std::vector< uint8_t, frame_buffer_allocator< uint8_t > > buffer_t;
+
+
+TEST_CASE( "size classes", "[frame-buffer-pool]" )
+{
+    CHECK( frame_buffer_pool::size_class( 1 ) == 64 );
+    CHECK( frame_buffer_pool::size_class( 64 ) == 64 );
+    CHECK( frame_buffer_pool::size_class( 65 ) == 128 );
+    CHECK( frame_buffer_pool::size_class( 4096 ) == 4096 );
+    CHECK( frame_buffer_pool::size_class( 4097 ) == 8192 );
+    CHECK( frame_buffer_pool::size_class( 640 * 480 * 2 ) == 640 * 480 * 2 );
+    CHECK( frame_buffer_pool::size_class( 640 * 480 * 2 - 100 ) == 640 * 480 * 2 );
+}
+
+TEST_CASE( "buffers are recycled within their size class", "[frame-buffer-pool]" )
+{
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 1 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb );
+
+    uint8_t const * first;
+    {
+        buffer_t data( 100000, frame_buffer_allocator< uint8_t >( pool ) );
+        first = data.data();
+        CHECK( reinterpret_cast< uintptr_t >( first ) % frame_buffer_pool::ALIGNMENT == 0 );
+        CHECK( pool->get_stats().misses == 1 );
+        CHECK( pool->get_stats().bytes_resident == 0 );
+    }
+    CHECK( pool->get_stats().bytes_resident == frame_buffer_pool::size_class( 100000 ) );
+
+    // Same size class: the buffer is reused
+    buffer_t data( 100001, frame_buffer_allocator< uint8_t >( pool ) );
+    CHECK( data.data() == first );
+    CHECK( data.size() == 100001 );
+    auto stats = pool->get_stats();
+    CHECK( stats.hits == 1 );
+    CHECK( stats.misses == 1 );
+    CHECK( stats.bytes_resident == 0 );
+
+    // Different size class: a new buffer is allocated
+    buffer_t other( 200000, frame_buffer_allocator< uint8_t >( pool ) );
+    CHECK( pool->get_stats().misses == 2 );
+}
+
+TEST_CASE( "the pool does not hold more than the high-water mark", "[frame-buffer-pool]" )
+{
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 1 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb );
+    size_t const size = 400 * 1024;
+
+    {
+        std::vector< buffer_t > buffers;
+        for( int i = 0; i < 4; ++i )
+            buffers.emplace_back( size, frame_buffer_allocator< uint8_t >( pool ) );
+    }
+    // Only two fit within 1MB
+    CHECK( pool->get_stats().bytes_resident == 2 * size );
+
+    *high_water_mark_mb = 0;
+    {
+        buffer_t a( size, frame_buffer_allocator< uint8_t >( pool ) );
+        buffer_t b( size, frame_buffer_allocator< uint8_t >( pool ) );
+        buffer_t c( size, frame_buffer_allocator< uint8_t >( pool ) );
+    }
+    CHECK( pool->get_stats().bytes_resident == 0 );
+    CHECK( pool->get_stats().hits == 2 );
+}
+
+TEST_CASE( "the pool keeps its high-water mark after the source is gone", "[frame-buffer-pool]" )
+{
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 1 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb );
+    size_t const size = 400 * 1024;
+
+    // A frame outlives the source that owned the setting, and is released after
+    buffer_t held( size, frame_buffer_allocator< uint8_t >( pool ) );
+    high_water_mark_mb.reset();
+    held = buffer_t();
+    CHECK( pool->get_stats().bytes_resident == size );
+}
+
+TEST_CASE( "flush frees idle buffers until restarted", "[frame-buffer-pool]" )
+{
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 16 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb );
+
+    buffer_t held( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    {
+        buffer_t data( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    }
+    CHECK( pool->get_stats().bytes_resident == 1024 );
+
+    pool->flush();
+    CHECK( pool->get_stats().bytes_resident == 0 );
+    held = buffer_t();
+    CHECK( pool->get_stats().bytes_resident == 0 );
+
+    pool->start();
+    {
+        buffer_t data( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    }
+    CHECK( pool->get_stats().bytes_resident == 1024 );
+}
+
+TEST_CASE( "buffers outlive the frames that moved them", "[frame-buffer-pool]" )
+{
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 16 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb );
+
+    buffer_t data( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    auto const ptr = data.data();
+
+    // Moving frames around (e.g., into the published frames heap) moves the pool along
+    buffer_t moved;
+    moved = std::move( data );
+    CHECK( moved.data() == ptr );
+    CHECK( moved.get_allocator().get_pool() == pool );
+
+    pool.reset();  // the archive is gone
+    moved = buffer_t();
+}
+
+TEST_CASE( "buffers come from the user allocator", "[frame-buffer-pool]" )
+{
+    struct counting_allocator : rs2_frame_allocator
+    {
+        int allocated = 0;
+        int freed = 0;
+        void * allocate( int size ) override { ++allocated; return frame_buffer_pool::aligned_alloc( size ); }
+        void deallocate( void * buffer, int size ) override { ++freed; frame_buffer_pool::aligned_free( buffer ); }
+        void release() override {}
+    };
+    auto allocator = std::make_shared< counting_allocator >();
+
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 16 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb, allocator );
+    {
+        buffer_t a( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    }
+    buffer_t b( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+    CHECK( allocator->allocated == 1 );
+    CHECK( allocator->freed == 0 );
+
+    // Replacing the pool (as when the allocator is changed) leaves outstanding buffers with their allocator
+    pool.reset();
+    CHECK( allocator->freed == 0 );
+    b = buffer_t();
+    CHECK( allocator->freed == 1 );
+}
+
+TEST_CASE( "buffers the user allocator does not provide come from the heap", "[frame-buffer-pool]" )
+{
+    // Fails every other allocation, and misaligns every third
+    struct flaky_allocator : rs2_frame_allocator
+    {
+        int calls = 0;
+        std::vector< void * > allocated;
+        int freed = 0;
+        void * allocate( int size ) override
+        {
+            if( ++calls % 2 == 0 )
+                return nullptr;
+            auto buffer = static_cast< uint8_t * >( frame_buffer_pool::aligned_alloc( size + frame_buffer_pool::ALIGNMENT ) );
+            allocated.push_back( buffer );
+            return calls % 3 == 0 ? buffer + 8 : buffer;
+        }
+        void deallocate( void * buffer, int size ) override
+        {
+            ++freed;
+            auto it = std::find_if( allocated.begin(), allocated.end(), [&]( void * b ) {
+                return buffer >= b && buffer < static_cast< uint8_t * >( b ) + frame_buffer_pool::ALIGNMENT;
+            } );
+            REQUIRE( it != allocated.end() );
+            frame_buffer_pool::aligned_free( *it );
+            allocated.erase( it );
+        }
+        void release() override {}
+    };
+    auto allocator = std::make_shared< flaky_allocator >();
+
+    auto high_water_mark_mb = std::make_shared< std::atomic< uint32_t > >( 0 );
+    auto pool = std::make_shared< frame_buffer_pool >( high_water_mark_mb, allocator );
+    {
+        std::vector< buffer_t > buffers;
+        for( int i = 0; i < 6; ++i )
+        {
+            buffers.emplace_back( 1000, frame_buffer_allocator< uint8_t >( pool ) );
+            CHECK( reinterpret_cast< uintptr_t >( buffers.back().data() ) % frame_buffer_pool::ALIGNMENT == 0 );
+        }
+        // Calls 1 and 5 were used; 3 was misaligned and given right back
+        CHECK( allocator->allocated.size() == 2 );
+        CHECK( allocator->freed == 1 );
+    }
+    // Each buffer was freed where it came from
+    CHECK( allocator->allocated.empty() );
+    CHECK( allocator->freed == 3 );
+}
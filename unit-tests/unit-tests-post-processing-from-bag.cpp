@@ -445,6 +445,131 @@ void compare_processed_frames_vs_recorded_frames(processing_recordable_block& re
     }
 }
 
+typedef std::function<void(rs2::filter&)> filter_configuration;
+
+// One configuration per combination of the option values, e.g. { { RS2_OPTION_HOLES_FILL, { 0, 2 } }, ... }
+std::vector<filter_configuration> option_combinations(const std::vector<std::pair<rs2_option, std::vector<float>>>& options)
+{
+    std::vector<filter_configuration> configurations = { [](rs2::filter&) {} };
+    for (auto& option : options)
+    {
+        std::vector<filter_configuration> combined;
+        for (auto& configuration : configurations)
+            for (auto value : option.second)
+                combined.push_back([=](rs2::filter& block)
+                {
+                    configuration(block);
+                    block.set_option(option.first, value);
+                });
+        configurations = combined;
+    }
+    return configurations;
+}
+
+// Runs 'block' over all the recorded depth frames, first single-threaded and then split between several
+// threads, once per configuration. The multi-threaded results must be identical to the serial ones.
+void compare_parallel_vs_serial_processing(rs2::filter& block,
+    const std::vector<filter_configuration>& configurations,
+    std::function<rs2::frame(const rs2::frameset&)> prepare)
+{
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    auto dev = ctx.load_device(folder_name + "all_combinations_depth_color.bag");
+    dev.set_real_time(false);
+
+    std::vector<rs2::sensor> sensors = dev.query_sensors();
+    auto frames = get_composite_frames(sensors);
+    REQUIRE(frames.size() > 0);
+
+    for (int c = 0; c < configurations.size(); c++)
+    {
+        CAPTURE(c);
+        configurations[c](block);
+        for (int i = 0; i < frames.size(); i++)
+        {
+            CAPTURE(i);
+            auto input = prepare(frames[i]);
+            REQUIRE(input);
+
+            block.set_option(RS2_OPTION_PROCESSING_THREADS, 1);
+            auto serial = block.process(input);
+            REQUIRE(serial);
+
+            for (auto threads : { 2, 3, 8 })
+            {
+                CAPTURE(threads);
+                block.set_option(RS2_OPTION_PROCESSING_THREADS, float(threads));
+                auto parallel = block.process(input);
+                REQUIRE(parallel);
+                validate_ppf_results(parallel, serial);
+            }
+        }
+    }
+}
+
+std::vector<filter_configuration> spatial_filter_configurations()
+{
+    return option_combinations({ { RS2_OPTION_HOLES_FILL, { 0, 2, 5 } }, { RS2_OPTION_FILTER_MAGNITUDE, { 1, 5 } } });
+}
+
+TEST_CASE("Test multi-threaded spatial filter from recording", "[software-device][spatial-filter]")
+{
+    rs2::spatial_filter spatial;
+    compare_parallel_vs_serial_processing(spatial, spatial_filter_configurations(),
+        [](const rs2::frameset& fs) { return fs.get_depth_frame(); });
+}
+
+TEST_CASE("Test multi-threaded spatial filter in disparity domain from recording", "[software-device][spatial-filter]")
+{
+    rs2::spatial_filter spatial;
+    rs2::disparity_transform to_disparity(true);
+    compare_parallel_vs_serial_processing(spatial, spatial_filter_configurations(),
+        [&](const rs2::frameset& fs) { return to_disparity.process(fs.get_depth_frame()); });
+}
+
+std::vector<filter_configuration> decimation_filter_configurations()
+{
+    return option_combinations({ { RS2_OPTION_FILTER_MAGNITUDE, { 1, 2, 3, 4, 5, 6, 7, 8 } } });
+}
+
+TEST_CASE("Test multi-threaded decimation filter from recording", "[software-device][decimation-filter]")
+{
+    rs2::decimation_filter decimation;
+    compare_parallel_vs_serial_processing(decimation, decimation_filter_configurations(),
+        [](const rs2::frameset& fs) { return fs.get_depth_frame(); });
+}
+
+TEST_CASE("Test multi-threaded decimation filter on color from recording", "[software-device][decimation-filter]")
+{
+    rs2::decimation_filter decimation;
+    decimation.set_option(RS2_OPTION_STREAM_FILTER, RS2_STREAM_COLOR);
+    decimation.set_option(RS2_OPTION_STREAM_FORMAT_FILTER, RS2_FORMAT_ANY);
+    compare_parallel_vs_serial_processing(decimation, decimation_filter_configurations(),
+        [](const rs2::frameset& fs) { return fs.get_color_frame(); });
+}
+
+TEST_CASE("Test multi-threaded colorizer from recording", "[software-device][colorizer]")
+{
+    rs2::colorizer colorizer;
+    compare_parallel_vs_serial_processing(colorizer,
+        option_combinations({ { RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, { 1, 0 } }, { RS2_OPTION_COLOR_SCHEME, { 0, 2, 9 } } }),
+        [](const rs2::frameset& fs) { return fs.get_depth_frame(); });
+}
+
+TEST_CASE("Test multi-threaded occlusion removal from recording", "[software-device][point-cloud]")
+{
+    rs2::pointcloud pc;
+    compare_parallel_vs_serial_processing(pc, option_combinations({ { RS2_OPTION_FILTER_MAGNITUDE, { 2 } } }),
+        [&](const rs2::frameset& fs)
+        {
+            pc.map_to(fs.get_color_frame());
+            return fs.get_depth_frame();
+        });
+}
+
 TEST_CASE("Record software-device all resolutions", "[record-bag]")
 {
     rs2::context ctx;
@@ -558,3 +683,86 @@ TEST_CASE("Test point cloud from recording", "[software-device][point-cloud]")
     auto record_block = pointcloud_record_block();
     compare_processed_frames_vs_recorded_frames(record_block, "[pointcloud]_all_combinations_depth_color.bag");
 }
+
+float half_to_float(uint16_t h)
+{
+    float const magnitude = (h & 0x7c00) ? std::ldexp(float(1024 + (h & 0x3ff)), ((h >> 10) & 0x1f) - 25)
+                                         : std::ldexp(float(h & 0x3ff), -24);
+    return (h & 0x8000) ? -magnitude : magnitude;
+}
+
+TEST_CASE("Test packed point cloud layouts from recording", "[software-device][point-cloud]")
+{
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    auto dev = ctx.load_device(folder_name + "all_combinations_depth_color.bag");
+    dev.set_real_time(false);
+
+    std::vector<rs2::sensor> sensors = dev.query_sensors();
+    auto frames = get_composite_frames(sensors);
+    REQUIRE(frames.size() > 0);
+
+    const rs2_format vertex_formats[] = { RS2_FORMAT_XYZ32F, RS2_FORMAT_XYZ16F, RS2_FORMAT_XYZ16 };
+    rs2::pointcloud organized_pc, packed_pc;
+    for (auto vertex_format : { 0, 1, 2 })
+    for (auto valid_only : { 0, 1 })
+    for (auto texture_coordinates : { 1, 0 })
+    {
+        CAPTURE(vertex_format);
+        CAPTURE(valid_only);
+        CAPTURE(texture_coordinates);
+        // The organized cloud to compare with goes through the same texture mapping (or not)
+        organized_pc.set_option(RS2_OPTION_TEXTURE_COORDINATES, float(texture_coordinates));
+        packed_pc.set_option(RS2_OPTION_TEXTURE_COORDINATES, float(texture_coordinates));
+        packed_pc.set_option(RS2_OPTION_VERTEX_FORMAT, float(vertex_format));
+        packed_pc.set_option(RS2_OPTION_VALID_POINTS_ONLY, float(valid_only));
+
+        for (int i = 0; i < frames.size(); i++)
+        {
+            CAPTURE(i);
+            auto depth = frames[i].get_depth_frame();
+            rs2::points organized = organized_pc.calculate(depth);
+            rs2::points packed = packed_pc.calculate(depth);
+            REQUIRE(organized.get_profile().format() == RS2_FORMAT_XYZ32F);
+            REQUIRE(packed.get_profile().format() == vertex_formats[vertex_format]);
+            REQUIRE((packed.get_texture_coordinates() != nullptr) == bool(texture_coordinates));
+            REQUIRE((packed.get_points_mask() != nullptr) == bool(valid_only));
+
+            auto vertices = organized.get_vertices();
+            auto texcoords = organized.get_texture_coordinates();
+            auto packed_texcoords = packed.get_texture_coordinates();
+            auto mask = packed.get_points_mask();
+            size_t n = 0;
+            for (size_t p = 0; p < organized.size(); ++p)
+            {
+                bool const has_depth = vertices[p].z != 0;
+                if (valid_only)
+                {
+                    REQUIRE(bool(mask[p / 8] & (1 << (p % 8))) == has_depth);
+                    if (!has_depth)
+                        continue;
+                }
+                float const* v = &vertices[p].x;
+                for (int c = 0; c < 3; ++c)
+                {
+                    switch (vertex_format)
+                    {
+                    case 0: REQUIRE(((const float*)packed.get_data())[3 * n + c] == v[c]); break;
+                    case 1: REQUIRE(std::abs(half_to_float(((const uint16_t*)packed.get_data())[3 * n + c]) - v[c]) <= std::abs(v[c]) / 2048 + 1e-7f); break;
+                    case 2: REQUIRE(std::abs(((const int16_t*)packed.get_data())[3 * n + c] - std::min(std::max(v[c] * 1000, -32768.f), 32767.f)) <= 0.5f); break;
+                    }
+                }
+                if (texture_coordinates)
+                {
+                    REQUIRE(packed_texcoords[n].u == texcoords[p].u);
+                    REQUIRE(packed_texcoords[n].v == texcoords[p].v);
+                }
+                ++n;
+            }
+            REQUIRE(packed.size() == n);
+        }
+    }
+}
@@ -37,7 +37,9 @@ PYBIND11_MODULE(NAME, m) {
         .def_property_readonly_static("option_ply_mesh", [](py::object) { return rs2::save_to_ply::OPTION_PLY_MESH; })
         .def_property_readonly_static("option_ply_binary", [](py::object) { return rs2::save_to_ply::OPTION_PLY_BINARY; })
         .def_property_readonly_static("option_ply_normals", [](py::object) { return rs2::save_to_ply::OPTION_PLY_NORMALS; })
-        .def_property_readonly_static("option_ply_threshold", [](py::object) { return rs2::save_to_ply::OPTION_PLY_THRESHOLD; });
+        .def_property_readonly_static("option_ply_threshold", [](py::object) { return rs2::save_to_ply::OPTION_PLY_THRESHOLD; })
+        .def_property_readonly_static("option_ply_async", [](py::object) { return rs2::save_to_ply::OPTION_PLY_ASYNC; })
+        .def("flush", &rs2::save_to_ply::flush, "Wait for the frames queued by option_ply_async to be saved", py::call_guard<py::gil_scoped_release>());
 
     m.def("log_to_console", &rs2::log_to_console, "min_severity"_a);
     m.def("log_to_file", &rs2::log_to_file, "min_severity"_a, "file_path"_a);
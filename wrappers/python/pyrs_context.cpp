@@ -18,6 +18,8 @@ void init_context(py::module &m) {
 
     py::class_<rs2::context> context(m, "context", "Librealsense context class. Includes realsense API version.");
     context.def(py::init<>())
+        .def(py::init<std::string const &>(), "Create a context with settings, given as a JSON string, e.g. "
+             "'{ \"thread-pool\": { \"size\": 8, \"cpus\": [ 4, 5, 6, 7 ] } }'", "json_settings"_a)
         .def("query_devices", (rs2::device_list(rs2::context::*)() const) &rs2::context::query_devices, "Create a static"
              " snapshot of all connected devices at the time of the call.")
         .def( "query_devices", ( rs2::device_list( rs2::context::* )(int) const ) & rs2::context::query_devices, "Create a static"
@@ -67,6 +67,8 @@ void init_pipeline(py::module &m) {
              "The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the stream configuration.", "stream"_a, "index"_a = -1)
         .def("disable_all_streams", &rs2::config::disable_all_streams, "Disable all device stream explicitly, to remove any requests on the streams profiles.\n"
              "The streams can still be enabled due to pipeline computer vision module request. This call removes any filter on the streams configuration.")
+        .def("enable_low_latency", &rs2::config::enable_low_latency, "Keep only the newest complete frames set for wait_for_frames(), poll_for_frames() "
+             "and try_wait_for_frames(), dropping the ones the application did not take in time rather than ever blocking the device for them.", "enable"_a = true)
         .def("resolve", [](rs2::config* c, pipeline_wrapper pw) -> rs2::pipeline_profile { return c->resolve(pw._ptr); }, "Resolve the configuration filters, "
              "to find a matching device and streams profiles.\n"
              "The method resolves the user configuration filters for the device and streams, and combines them with the requirements of the computer vision modules "
@@ -160,6 +162,10 @@ void init_pipeline(py::module &m) {
             auto success = self.try_wait_for_frames(&fs, timeout_ms);
             return std::make_tuple(success, fs);
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>())
+        .def("get_frames_latency", &rs2::pipeline::get_frames_latency, "Return the end-to-end latency, in milliseconds, of the frames set last returned: "
+             "the time from the backend timestamp of its oldest frame until it was returned.")
+        .def("get_dropped_framesets", &rs2::pipeline::get_dropped_framesets, "Return the number of frames sets dropped since start(), as of the frames set "
+             "last returned, because a newer frames set replaced them before the application took them.")
         .def("get_active_profile", &rs2::pipeline::get_active_profile); // No docstring in C++
     /** end rs_pipeline.hpp **/
 }
@@ -133,6 +133,33 @@ void init_processing(py::module &m) {
               py::call_guard< py::gil_scoped_release >() );
       /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
+    py::class_<rs2::multi_device_syncer> multi_device_syncer(m, "multi_device_syncer", "Sync instance to match the frames of several devices, by their global timestamps, into one frameset");
+    auto md_poll_for_frames = []( const rs2::multi_device_syncer & self ) {
+        rs2::frameset frames;
+        self.poll_for_frames( &frames );
+        return frames;
+    };
+    auto md_try_wait_for_frames = []( const rs2::multi_device_syncer & self, unsigned int timeout_ms ) {
+        rs2::frameset fs;
+        auto success = self.try_wait_for_frames( &fs, timeout_ms );
+        return std::make_tuple( success, fs );
+    };
+    multi_device_syncer.def( py::init< int >(), "queue_size"_a = 1 )
+        .def( "wait_for_frames",
+              &rs2::multi_device_syncer::wait_for_frames,
+              "Wait until a coherent set of frames becomes available",
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "poll_for_frames", md_poll_for_frames, "Check if a coherent set of frames is available" )
+        .def( "try_wait_for_frames",
+              md_try_wait_for_frames,
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "get_options",
+              &rs2::multi_device_syncer::get_options,
+              "The tolerance and statistics options of the syncer",
+              py::return_value_policy::reference_internal );
+
     py::class_<rs2::align, rs2::filter> align(m, "align", "Performs alignment between depth image and another image.");
     align.def(py::init<rs2_stream>(), "To perform alignment of a depth image to the other, set the align_to parameter with the other stream type.\n"
               "To perform alignment of a non depth image to a depth image, set the align_to parameter to RS2_STREAM_DEPTH.\n"
@@ -8,6 +8,13 @@ void init_record_playback(py::module &m) {
     /** rs_record_playback.hpp **/
 // Not binding status_changed_callback, templated
 
+    py::class_<rs2_playback_read_ahead_stats> read_ahead_stats(m, "playback_read_ahead_stats", "Read-ahead counters of a playback device");
+    read_ahead_stats.def(py::init<>())
+        .def_readwrite("queued_frames", &rs2_playback_read_ahead_stats::queued_frames, "Number of frames read ahead and waiting to be played")
+        .def_readwrite("queued_bytes", &rs2_playback_read_ahead_stats::queued_bytes, "Bytes of frame data read ahead and waiting to be played")
+        .def_readwrite("stalls", &rs2_playback_read_ahead_stats::stalls, "Number of times playback had to wait for the file to be read")
+        .def_readwrite("full", &rs2_playback_read_ahead_stats::full, "Number of times reading ahead paused because the read-ahead depth was reached");
+
     py::class_<rs2::playback, rs2::device> playback(m, "playback"); // No docstring in C++
     playback.def(py::init<rs2::device>(), "device"_a)
         .def("pause", &rs2::playback::pause, "Pauses the playback. Calling pause() in \"Paused\" status does nothing. If "
@@ -23,6 +30,9 @@ void init_record_playback(py::module &m) {
              "mode, playback will wait for each callback to finish handling the data before reading the next frame. In this mode no frames will be dropped, "
              "and the application controls the framerate of playback via callback duration.", "real_time"_a)
         // set_playback_speed?
+        .def("set_read_ahead", &rs2::playback::set_read_ahead, "Read the file ahead of playback, on other threads, while the frames already "
+             "read are played. Up to 16 frames may be read ahead; 0 stops reading ahead. A limit of 0 megabytes means no limit.", "frames"_a, "megabytes"_a = 0)
+        .def("get_read_ahead_stats", &rs2::playback::get_read_ahead_stats, "Retrieve the read-ahead counters, for tuning the read-ahead depth.")
         .def("set_status_changed_callback", [](rs2::playback& self, std::function<void(rs2_playback_status)> callback) {
             self.set_status_changed_callback(callback);
         }, "Register to receive callback from playback device upon its status changes. Callbacks are invoked from the reading thread, "
@@ -30,11 +40,24 @@ void init_record_playback(py::module &m) {
         .def("current_status", &rs2::playback::current_status, "Returns the current state of the playback device");
     // Stop?
 
+    py::class_<rs2_record_write_stats> write_stats(m, "record_write_stats", "Write counters of a recording device");
+    write_stats.def(py::init<>())
+        .def_readwrite("pending_chunks", &rs2_record_write_stats::pending_chunks, "Number of filled chunks of the file waiting to be compressed and written")
+        .def_readwrite("chunks_written", &rs2_record_write_stats::chunks_written, "Number of chunks written to the file")
+        .def_readwrite("bytes_in", &rs2_record_write_stats::bytes_in, "Bytes of chunk data written, before compression")
+        .def_readwrite("bytes_written", &rs2_record_write_stats::bytes_written, "Bytes of chunk data written, after compression")
+        .def_readwrite("stalls", &rs2_record_write_stats::stalls, "Number of times recording had to wait for pending chunks to be written")
+        .def_readwrite("stall_ms", &rs2_record_write_stats::stall_ms, "Time recording spent waiting for pending chunks to be written")
+        .def_readwrite("write_ms", &rs2_record_write_stats::write_ms, "Time spent writing chunks to the file");
+
     py::class_<rs2::recorder, rs2::device> recorder(m, "recorder", "Records the given device and saves it to the given file as rosbag format.");
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
+        .def(py::init<const std::string&, rs2::device, rs2_record_compression, int>(), "file"_a, "device"_a, "compression"_a, "level"_a = 0)
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("get_write_stats", &rs2::recorder::get_write_stats, "Retrieve the write counters. Stalls mean the disk (or compression) "
+             "does not keep up with the recording.");
     // filename?
     /** end rs_record_playback.hpp **/
 }
@@ -58,6 +58,9 @@ void init_sensor(py::module &m) {
         .def("start", [](const rs2::sensor& self, rs2::syncer& syncer) {
             self.start(syncer);
         }, "Start passing frames into user provided syncer.", "syncer"_a)
+        .def("start", [](const rs2::sensor& self, rs2::multi_device_syncer& syncer) {
+            self.start(syncer);
+        }, "Start passing frames into user provided multi-device syncer.", "syncer"_a)
         .def("start", [](const rs2::sensor& self, rs2::frame_queue& queue) {
             self.start(queue);
         }, "start passing frames into specified frame_queue", "queue"_a)